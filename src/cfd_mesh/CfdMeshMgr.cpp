@@ -20,6 +20,10 @@
 #include "SubSurface.h"
 #include "APIDefines.h"
 #include "SurfCore.h"
+#include "PntNodeMerge.h"
+#include "ResultsMgr.h"
+
+#include <chrono>
 
 #ifdef DEBUG_CFD_MESH
 #include <direct.h>
@@ -83,16 +87,56 @@ void Wake::MatchBorderCurve( ICurve* curve )
     uw = curve->m_SCurve_A->CompPntUW( 1.0 );
     vec3d p1 = s->CompPnt( uw.x(), uw.y() );
 
-    double dist_p0 = DistToClosestLeadingEdgePnt( p0 );
-    double dist_p1 = DistToClosestLeadingEdgePnt( p1 );
-
     double tol = 1.0e-08;
-    if ( fabs( dist_p0 ) < tol && fabs( dist_p1 ) < tol )
+    if ( OnLeadingEdge( p0, tol ) && OnLeadingEdge( p1, tol ) )
     {
         m_LeadingCurves.push_back( curve );
     }
 }
 
+//==== Hash Leading Edge Points So Border Curve Ends Only Check Nearby Points ====//
+void Wake::BuildLeadingEdgeCells()
+{
+    m_LeadingEdgeCells.clear();
+    for ( int i = 0 ; i < ( int )m_LeadingEdge.size() ; i++ )
+    {
+        int ix, iy, iz;
+        IPntGrid::ComputeCell( m_LeadingEdge[i], ix, iy, iz );
+        m_LeadingEdgeCells[ IPntGrid::ComputeKey( ix, iy, iz ) ].push_back( i );
+    }
+}
+
+bool Wake::OnLeadingEdge( const vec3d & pnt, double tol )
+{
+    int ix, iy, iz;
+    IPntGrid::ComputeCell( pnt, ix, iy, iz );
+
+    for ( int i = -1 ; i <= 1 ; i++ )
+    {
+        for ( int j = -1 ; j <= 1 ; j++ )
+        {
+            for ( int k = -1 ; k <= 1 ; k++ )
+            {
+                unordered_map< long long, vector< int > >::const_iterator iter;
+                iter = m_LeadingEdgeCells.find( IPntGrid::ComputeKey( ix + i, iy + j, iz + k ) );
+                if ( iter == m_LeadingEdgeCells.end() )
+                {
+                    continue;
+                }
+
+                for ( int n = 0 ; n < ( int )iter->second.size() ; n++ )
+                {
+                    if ( dist( m_LeadingEdge[ iter->second[n] ], pnt ) < tol )
+                    {
+                        return true;
+                    }
+                }
+            }
+        }
+    }
+    return false;
+}
+
 void Wake::BuildSurfs(  )
 {
     //==== Find Comp ID & Build Surf ====//
@@ -173,6 +217,7 @@ void WakeMgr::CreateWakesAppendBorderCurves( vector< ICurve* > & border_curves )
         Wake* w = new Wake( this );
         m_WakeVec.push_back( w );
         w->m_LeadingEdge = m_LeadingEdgeVec[i];
+        w->BuildLeadingEdgeCells();
     }
 
     //==== Match Wake To Border Curves From Model ====//
@@ -208,10 +253,16 @@ void WakeMgr::CreateWakesAppendBorderCurves( vector< ICurve* > & border_curves )
     }
 
     //==== Match Leading Edge SCurves With Wake SCurves ====//
+    SCurveMatchHash le_hash;
+    le_hash.Build( leading_edge_scurves );
+
+    vector< int > cand_vec;
     for ( i = 0 ; i < ( int )scurve_vec.size() ; i++ )
     {
-        for ( j = 0 ; j < ( int )leading_edge_scurves.size() ; j++ )
+        le_hash.FindCandidates( scurve_vec[i], cand_vec );
+        for ( int k = 0 ; k < ( int )cand_vec.size() ; k++ )
         {
+            j = cand_vec[k];
             ICurve* icrv = new ICurve;
             if ( icrv->Match( leading_edge_scurves[j], scurve_vec[i] ) )
             {
@@ -225,21 +276,7 @@ void WakeMgr::CreateWakesAppendBorderCurves( vector< ICurve* > & border_curves )
     }
 
     //==== Match Border Curves ====//
-    for ( i = 0 ; i < ( int )scurve_vec.size() ; i++ )
-    {
-        for ( j = i + 1 ; j < ( int )scurve_vec.size() ; j++ )
-        {
-            ICurve* icrv = new ICurve;
-            if ( icrv->Match( scurve_vec[i], scurve_vec[j] ) )
-            {
-                border_curves.push_back( icrv );
-            }
-            else
-            {
-                delete icrv;
-            }
-        }
-    }
+    MatchSCurvePairs( scurve_vec, border_curves );
 
     //==== Check For SCurves Not Matched ====//
     for ( i = 0 ; i < ( int )scurve_vec.size() ; i++ )
@@ -366,10 +403,15 @@ CfdMeshMgrSingleton::CfdMeshMgrSingleton() : ParmContainer()
 
     m_CurrMainSurfIndx = 0;
 
+    m_NumChainPairs = 0;
+    m_NumChainCandidates = 0;
+
     // Array allocated to (m_NumComps + 6) later, so if this isn't reset by then, the
     // allocation will fail with a negative argument.
     m_NumComps = -10;
 
+    m_NumGlobalBodyTris = 0;
+
 #ifdef DEBUG_CFD_MESH
     m_DebugDir  = Stringc( "MeshDebug/" );
     _mkdir( m_DebugDir.get_char_star() );
@@ -448,6 +490,8 @@ void CfdMeshMgrSingleton::GenerateMesh()
 
     SubSurfaceMgr.BuildSingleTagMap();
 
+    CfdMeshMgr.BuildGlobalMesh();
+
     CfdMeshMgr.addOutputText( "Exporting Files\n" );
     CfdMeshMgr.ExportFiles();
 
@@ -540,9 +584,11 @@ void CfdMeshMgrSingleton::CleanUp()
     }
     m_BadTris.clear();
 
-    m_BinMap.clear();
+    m_IPntGrid.Clear();
     m_PossCoPlanarSurfMap.clear();
 
+    ClearGlobalMesh();
+
     debugPnts.clear();
 
 }
@@ -1146,7 +1192,7 @@ void CfdMeshMgrSingleton::DeleteDuplicateSurfs()
 void CfdMeshMgrSingleton::BuildGrid()
 {
 
-    int i, j;
+    int i;
     vector< SCurve* > scurve_vec;
     for ( i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
     {
@@ -1156,21 +1202,8 @@ void CfdMeshMgrSingleton::BuildGrid()
         m_SurfVec[i]->LoadSCurves( scurve_vec );
     }
 
-    for ( i = 0 ; i < ( int )scurve_vec.size() ; i++ )
-    {
-        for ( j = i + 1 ; j < ( int )scurve_vec.size() ; j++ )
-        {
-            ICurve* icrv = new ICurve;
-            if ( icrv->Match( scurve_vec[i], scurve_vec[j] ) )
-            {
-                m_ICurveVec.push_back( icrv );
-            }
-            else
-            {
-                delete icrv;
-            }
-        }
-    }
+    //==== Exact Match Only On Curves Whose End Points Hash Together ====//
+    MatchSCurvePairs( scurve_vec, m_ICurveVec );
 
 
     //==== Check For SCurves Not Matched ====//
@@ -1208,13 +1241,31 @@ void CfdMeshMgrSingleton::BuildTargetMap( int output_type )
     MSCloud ms_cloud;
     vector< MapSource* > allsources;
 
-    int i;
-    for ( i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
+    int nsurf = ( int )m_SurfVec.size();
+    vector< vector< MapSource* > > surf_sources( nsurf );
+    vector< double > surf_time( nsurf, 0.0 );
+
+    std::chrono::steady_clock::time_point t_start = std::chrono::steady_clock::now();
+
+    //==== Each Surf Owns Its Map - Build And Limit In Parallel, Gather In Order ====//
+    #pragma omp parallel for schedule( dynamic )
+    for ( int isurf = 0 ; isurf < nsurf ; isurf++ )
     {
-        m_SurfVec[i]->BuildTargetMap( allsources, i );
-        m_SurfVec[i]->LimitTargetMap();
+        std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+        m_SurfVec[isurf]->BuildTargetMap( surf_sources[isurf], isurf );
+        m_SurfVec[isurf]->LimitTargetMap();
+        surf_time[isurf] = std::chrono::duration< double >( std::chrono::steady_clock::now() - t0 ).count();
     }
 
+    for ( int isurf = 0 ; isurf < nsurf ; isurf++ )
+    {
+        allsources.insert( allsources.end(), surf_sources[isurf].begin(), surf_sources[isurf].end() );
+    }
+
+    std::chrono::steady_clock::time_point t_map = std::chrono::steady_clock::now();
+
+    int i;
+
     // Set up split sources to provide a source at the endpoint of curves where
     // mesh information is hard to transfer.
     list< MapSource* > splitSources;
@@ -1259,29 +1310,40 @@ void CfdMeshMgrSingleton::BuildTargetMap( int output_type )
             addOutputText( " Rigorous 3D Limiting\n", output_type );
         }
 
-        for ( i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
+        //==== Limit Against A Snapshot Of All Maps So Surfs Can Run Concurrently ====//
+        vector< MapSource > snapshot( allsources.size() );
+        vector< double > surf_min( nsurf, numeric_limits<double>::max( ) );
+
+        ms_cloud.sources.resize( allsources.size() );
+        for( int j = 0; j < ( int )allsources.size(); j++ )
         {
-            ms_cloud.sources.clear();
-            ms_cloud.sources.reserve( allsources.size() );
+            snapshot[j] = *allsources[j];
+            ms_cloud.sources[j] = &snapshot[j];
 
-            double minmap = numeric_limits<double>::max( );
+            int sid = snapshot[j].m_surfid;
+            surf_min[ sid ] = min( surf_min[ sid ], snapshot[j].m_str );
+        }
+
+        // One tree over every surface, each surf skips its own sources
+        MSTree ms_tree( 3, ms_cloud, KDTreeSingleIndexAdaptorParams( 10 ) );
+        ms_tree.buildIndex();
+
+        #pragma omp parallel for schedule( dynamic )
+        for ( int isurf = 0 ; isurf < nsurf ; isurf++ )
+        {
+            std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
 
-            for( int j = 0; j < ( int )allsources.size(); j++ )
+            double minmap = numeric_limits<double>::max( );
+            for ( int j = 0 ; j < nsurf ; j++ )
             {
-                if( allsources[j]->m_surfid != i )
+                if ( j != isurf )
                 {
-                    if( allsources[j]->m_str < minmap )
-                    {
-                        minmap = allsources[j]->m_str;
-                    }
-                    ms_cloud.sources.push_back( allsources[j] );
+                    minmap = min( minmap, surf_min[j] );
                 }
             }
 
-            MSTree ms_tree( 3, ms_cloud, KDTreeSingleIndexAdaptorParams( 10 ) );
-            ms_tree.buildIndex();
-
-            m_SurfVec[i]->LimitTargetMap( ms_cloud, ms_tree, minmap );
+            m_SurfVec[isurf]->LimitTargetMap( ms_cloud, ms_tree, minmap );
+            surf_time[isurf] += std::chrono::duration< double >( std::chrono::steady_clock::now() - t0 ).count();
         }
 
         for ( c = m_ISegChainList.begin() ; c != m_ISegChainList.end(); c++ )
@@ -1290,6 +1352,24 @@ void CfdMeshMgrSingleton::BuildTargetMap( int output_type )
         }
     }
 
+    std::chrono::steady_clock::time_point t_end = std::chrono::steady_clock::now();
+
+    //==== Target Map Timing And Walk Stack Use Per Surf ====//
+    vector< int > surf_stack( nsurf );
+    for ( int isurf = 0 ; isurf < nsurf ; isurf++ )
+    {
+        surf_stack[isurf] = m_SurfVec[isurf]->GetWalkPeakStack();
+    }
+
+    Results* res = ResultsMgr.CreateResults( "CFD_Target_Map" );
+    res->Add( NameValData( "Num_Surfs", nsurf ) );
+    res->Add( NameValData( "Num_Map_Cells", ( int )allsources.size() ) );
+    res->Add( NameValData( "Surf_Time", surf_time ) );
+    res->Add( NameValData( "Surf_Peak_Stack", surf_stack ) );
+    res->Add( NameValData( "Map_Time", std::chrono::duration< double >( t_map - t_start ).count() ) );
+    res->Add( NameValData( "Limit_Time", std::chrono::duration< double >( t_end - t_map ).count() ) );
+    res->Add( NameValData( "Total_Time", std::chrono::duration< double >( t_end - t_start ).count() ) );
+
     // Clean up split sources.
     list< MapSource* >::iterator ss;
     for ( ss = splitSources.begin(); ss != splitSources.end(); ss++ )
@@ -1428,144 +1508,277 @@ void CfdMeshMgrSingleton::PrintQual()
 {
 }
 
-void CfdMeshMgrSingleton::ExportFiles()
+//==== Open Export File With A Large Write Buffer ====//
+static FILE* OpenExportFile( const string &filename )
 {
-    if ( GetCfdSettingsPtr()->GetExportFileFlag( vsp::CFD_STL_FILE_NAME )->Get() )
+    FILE* fp = fopen( filename.c_str(), "w" );
+    if ( fp )
     {
-        if ( !m_Vehicle->m_STLMultiSolid() )
-        {
-            WriteSTL( GetCfdSettingsPtr()->GetExportFileName( vsp::CFD_STL_FILE_NAME ) );
-        }
-        else
+        setvbuf( fp, NULL, _IOFBF, 1 << 20 );
+    }
+    return fp;
+}
+
+void CfdMeshMgrSingleton::ClearGlobalMesh()
+{
+    m_GlobalPntVec.clear();
+    m_GlobalTriVec.clear();
+    m_GlobalTriTagVec.clear();
+    m_GlobalTriSurfVec.clear();
+    m_NumGlobalBodyTris = 0;
+
+    m_GlobalSplitPntVec.clear();
+    m_GlobalBodyPntInd.clear();
+    m_GlobalWakePntInd.clear();
+}
+
+//==== Merge All Surface Meshes Into One Indexed Mesh ====//
+void CfdMeshMgrSingleton::BuildGlobalMesh()
+{
+    ClearGlobalMesh();
+
+#ifdef DEBUG_CFD_MESH
+    //==== Find Smallest Edge ====//
+    double small_edge = 1.0e12;
+    for ( int i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
+    {
+        vector < SimpTri >& sTriVec = m_SurfVec[i]->GetMesh()->GetSimpTriVec();
+        vector< vec3d >& sPntVec = m_SurfVec[i]->GetMesh()->GetSimpPntVec();
+        for ( int t = 0 ; t <  ( int )sTriVec.size() ; t++ )
         {
-            WriteTaggedSTL( GetCfdSettingsPtr()->GetExportFileName( vsp::CFD_STL_FILE_NAME ) );
+            double el0 = dist_squared( sPntVec[sTriVec[t].ind0], sPntVec[sTriVec[t].ind1] );
+            double el1 = dist_squared( sPntVec[sTriVec[t].ind1], sPntVec[sTriVec[t].ind2] );
+            double el2 = dist_squared( sPntVec[sTriVec[t].ind2], sPntVec[sTriVec[t].ind0] );
+            small_edge = min( small_edge, min( el0, min( el1, el2 ) ) );
         }
     }
-    if ( GetCfdSettingsPtr()->GetExportFileFlag( vsp::CFD_POLY_FILE_NAME )->Get() )
+
+    fprintf( m_DebugFile, "CfdMeshMgr::BuildGlobalMesh Small Edge Length = %f \n", sqrt( small_edge ) );
+#endif
+
+    //==== Gather Surface Points ====//
+    PntNodeCloud pnCloud;
+    vector< int > pntOffset( m_SurfVec.size() + 1, 0 );
+    int numTris = 0;
+    for ( int i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
     {
-        WriteTetGen( GetCfdSettingsPtr()->GetExportFileName( vsp::CFD_POLY_FILE_NAME ) );
+        vector< vec3d >& sPntVec = m_SurfVec[i]->GetMesh()->GetSimpPntVec();
+        pnCloud.AddPntNodes( sPntVec );
+        pntOffset[i + 1] = pntOffset[i] + ( int )sPntVec.size();
+        numTris += ( int )m_SurfVec[i]->GetMesh()->GetSimpTriVec().size();
     }
 
-    string dat_fn;
-    if (  GetCfdSettingsPtr()->GetExportFileFlag( vsp::CFD_DAT_FILE_NAME )->Get() )
+    if ( pnCloud.m_PntNodes.empty() )
     {
-        dat_fn = GetCfdSettingsPtr()->GetExportFileName( vsp::CFD_DAT_FILE_NAME );
+        return;
     }
-    string key_fn;
-    if (  GetCfdSettingsPtr()->GetExportFileFlag( vsp::CFD_KEY_FILE_NAME )->Get() )
+
+    //==== Merge Coincident Points ====//
+    double tol = max( m_Domain.GetLargestDist(), 1.0 ) * 1.0e-12;
+    IndexPntNodes( pnCloud, tol * tol ); // Radius search is on squared distance
+
+    for ( int i = 0 ; i < ( int )pnCloud.m_PntNodes.size() ; i++ )
     {
-        key_fn = GetCfdSettingsPtr()->GetExportFileName( vsp::CFD_KEY_FILE_NAME );
+        if ( pnCloud.UsedNode( i ) )
+        {
+            m_GlobalPntVec.push_back( pnCloud.m_PntNodes[i].m_Pnt );
+        }
     }
-    string obj_fn;
-    if (  GetCfdSettingsPtr()->GetExportFileFlag( vsp::CFD_OBJ_FILE_NAME )->Get() )
+
+    //==== Body Tris Then Wake Tris ====//
+    m_GlobalTriVec.reserve( numTris );
+    m_GlobalTriTagVec.reserve( numTris );
+    m_GlobalTriSurfVec.reserve( numTris );
+
+    m_GlobalBodyPntInd.assign( m_GlobalPntVec.size(), -1 );
+    m_GlobalWakePntInd.assign( m_GlobalPntVec.size(), -1 );
+
+    for ( int wake = 0 ; wake < 2 ; wake++ )
     {
-        obj_fn = GetCfdSettingsPtr()->GetExportFileName( vsp::CFD_OBJ_FILE_NAME );
+        vector< int > & splitInd = wake ? m_GlobalWakePntInd : m_GlobalBodyPntInd;
+
+        for ( int i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
+        {
+            if ( ( int )m_SurfVec[i]->GetWakeFlag() != wake )
+            {
+                continue;
+            }
+
+            int n = pntOffset[i + 1] - pntOffset[i];
+            for ( int v = 0 ; v < n ; v++ )
+            {
+                int ind = pnCloud.GetNodeUsedIndex( pntOffset[i] + v );
+                if ( splitInd[ind] < 0 )
+                {
+                    splitInd[ind] = ( int )m_GlobalSplitPntVec.size();
+                    m_GlobalSplitPntVec.push_back( ind );
+                }
+            }
+
+            vector < SimpTri >& sTriVec = m_SurfVec[i]->GetMesh()->GetSimpTriVec();
+            for ( int t = 0 ; t < ( int )sTriVec.size() ; t++ )
+            {
+                SimpTri stri;
+                stri.ind0 = pnCloud.GetNodeUsedIndex( pntOffset[i] + sTriVec[t].ind0 );
+                stri.ind1 = pnCloud.GetNodeUsedIndex( pntOffset[i] + sTriVec[t].ind1 );
+                stri.ind2 = pnCloud.GetNodeUsedIndex( pntOffset[i] + sTriVec[t].ind2 );
+                m_GlobalTriVec.push_back( stri );
+                m_GlobalTriTagVec.push_back( SubSurfaceMgr.GetTag( sTriVec[t].m_Tags ) );
+                m_GlobalTriSurfVec.push_back( i );
+            }
+        }
+
+        if ( !wake )
+        {
+            m_NumGlobalBodyTris = ( int )m_GlobalTriVec.size();
+        }
     }
-    string tri_fn;
-    if (  GetCfdSettingsPtr()->GetExportFileFlag( vsp::CFD_TRI_FILE_NAME )->Get() )
+}
+
+void CfdMeshMgrSingleton::ExportFiles()
+{
+    //==== Mesh Formats Only Read The Global Mesh, So Write Them Concurrently ====//
+    int mesh_types[] = { vsp::CFD_STL_FILE_NAME, vsp::CFD_POLY_FILE_NAME, vsp::CFD_DAT_FILE_NAME,
+                         vsp::CFD_OBJ_FILE_NAME, vsp::CFD_TRI_FILE_NAME, vsp::CFD_GMSH_FILE_NAME };
+    const char* mesh_names[] = { "STL", "POLY", "DAT", "OBJ", "TRI", "GMSH" };
+
+    vector< int > type_vec;
+    vector< string > name_vec;
+    vector< string > fn_vec;
+    for ( int i = 0 ; i < ( int )( sizeof( mesh_types ) / sizeof( int ) ) ; i++ )
     {
-        tri_fn = GetCfdSettingsPtr()->GetExportFileName( vsp::CFD_TRI_FILE_NAME );
+        if ( GetCfdSettingsPtr()->GetExportFileFlag( mesh_types[i] )->Get() )
+        {
+            type_vec.push_back( mesh_types[i] );
+            name_vec.push_back( mesh_names[i] );
+            fn_vec.push_back( GetCfdSettingsPtr()->GetExportFileName( mesh_types[i] ) );
+        }
     }
-    string gmsh_fn;
-    if (  GetCfdSettingsPtr()->GetExportFileFlag( vsp::CFD_GMSH_FILE_NAME )->Get() )
+
+    int num_files = ( int )type_vec.size();
+    vector< double > time_vec( num_files, 0.0 );
+
+    #pragma omp parallel for schedule( dynamic, 1 )
+    for ( int i = 0 ; i < num_files ; i++ )
     {
-        gmsh_fn = GetCfdSettingsPtr()->GetExportFileName( vsp::CFD_GMSH_FILE_NAME );
+        std::chrono::high_resolution_clock::time_point t0 = std::chrono::high_resolution_clock::now();
+        ExportMeshFile( type_vec[i], fn_vec[i] );
+        std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+        time_vec[i] = std::chrono::duration< double >( t1 - t0 ).count();
     }
 
-    WriteNASCART_Obj_Tri_Gmsh( dat_fn, key_fn, obj_fn, tri_fn, gmsh_fn );
+    //==== Key And Surface Files ====//
+    if ( GetCfdSettingsPtr()->GetExportFileFlag( vsp::CFD_KEY_FILE_NAME )->Get() )
+    {
+        SubSurfaceMgr.WriteNascartKeyFile( GetCfdSettingsPtr()->GetExportFileName( vsp::CFD_KEY_FILE_NAME ) );
+    }
 
     if ( GetCfdSettingsPtr()->GetExportFileFlag( vsp::CFD_SRF_FILE_NAME )->Get() )
     {
+        std::chrono::high_resolution_clock::time_point t0 = std::chrono::high_resolution_clock::now();
         WriteSurfsIntCurves( GetCfdSettingsPtr()->GetExportFileName( vsp::CFD_SRF_FILE_NAME ) );
+        std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+
+        name_vec.push_back( "SRF" );
+        time_vec.push_back( std::chrono::duration< double >( t1 - t0 ).count() );
     }
 
     if ( GetCfdSettingsPtr()->GetExportFileFlag( vsp::CFD_TKEY_FILE_NAME )->Get() )
     {
         SubSurfaceMgr.WriteKeyFile( GetCfdSettingsPtr()->GetExportFileName( vsp::CFD_TKEY_FILE_NAME ) );
     }
+
+    for ( int i = 0 ; i < ( int )time_vec.size() ; i++ )
+    {
+        char str[256];
+        sprintf( str, "  %s: %.3f sec\n", name_vec[i].c_str(), time_vec[i] );
+        addOutputText( str );
+    }
 }
 
-void CfdMeshMgrSingleton::WriteTaggedSTL( const string &filename )
+void CfdMeshMgrSingleton::ExportMeshFile( int file_type, const string &filename )
 {
-    //==== Find All Points and Tri Counts ====//
-    vector< vec3d* > allPntVec;
-    for ( int i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
+    switch ( file_type )
     {
-        vector< vec3d >& sPntVec = m_SurfVec[i]->GetMesh()->GetSimpPntVec();
-        for ( int v = 0 ; v < ( int )sPntVec.size() ; v++ )
+    case vsp::CFD_STL_FILE_NAME:
+        if ( !m_Vehicle->m_STLMultiSolid() )
         {
-            allPntVec.push_back( &sPntVec[v] );
+            WriteSTL( filename );
         }
+        else
+        {
+            WriteTaggedSTL( filename );
+        }
+        break;
+    case vsp::CFD_POLY_FILE_NAME:
+        WriteTetGen( filename );
+        break;
+    case vsp::CFD_DAT_FILE_NAME:
+        WriteNASCART( filename );
+        break;
+    case vsp::CFD_OBJ_FILE_NAME:
+        WriteObj( filename );
+        break;
+    case vsp::CFD_TRI_FILE_NAME:
+        WriteTRI( filename );
+        break;
+    case vsp::CFD_GMSH_FILE_NAME:
+        WriteGmsh( filename );
+        break;
     }
+}
 
-    //==== Build Map ====//
-    map< int, vector< int > > indMap;
-    vector< int > pntShift;
-    BuildIndMap( allPntVec, indMap, pntShift );
+//==== Write One STL Facet ====//
+static void WriteSTLFacet( FILE* file_id, const vec3d & p0, const vec3d & p1, const vec3d & p2 )
+{
+    vec3d v10 = p1 - p0;
+    vec3d v20 = p2 - p1;
+    vec3d norm = cross( v10, v20 );
+    norm.normalize();
 
-    //==== Assemble Normal Tris ====//
-    vector< SimpTri > allTriVec;
-    for ( int i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
+    fprintf( file_id, " facet normal  %2.10le %2.10le %2.10le\n",  norm.x(), norm.y(), norm.z() );
+    fprintf( file_id, "   outer loop\n" );
+
+    fprintf( file_id, "     vertex %2.10le %2.10le %2.10le\n", p0.x(), p0.y(), p0.z() );
+    fprintf( file_id, "     vertex %2.10le %2.10le %2.10le\n", p1.x(), p1.y(), p1.z() );
+    fprintf( file_id, "     vertex %2.10le %2.10le %2.10le\n", p2.x(), p2.y(), p2.z() );
+
+    fprintf( file_id, "   endloop\n" );
+    fprintf( file_id, " endfacet\n" );
+}
+
+void CfdMeshMgrSingleton::WriteTaggedSTL( const string &filename )
+{
+    FILE* file_id = OpenExportFile( filename );
+    if ( file_id )
     {
-        vector < SimpTri >& sTriVec = m_SurfVec[i]->GetMesh()->GetSimpTriVec();
-        vector< vec3d >& sPntVec = m_SurfVec[i]->GetMesh()->GetSimpPntVec();
-        for ( int t = 0 ; t <  ( int )sTriVec.size() ; t++ )
+        //==== Group Tris By Tag ====//
+        std::vector< int > tags = SubSurfaceMgr.GetAllTags();
+        map< int, int > tagIndMap;
+        for ( int i = 0; i < ( int ) tags.size(); i++ )
         {
-            int i0 = FindPntIndex( sPntVec[sTriVec[t].ind0], allPntVec, indMap );
-            int i1 = FindPntIndex( sPntVec[sTriVec[t].ind1], allPntVec, indMap );
-            int i2 = FindPntIndex( sPntVec[sTriVec[t].ind2], allPntVec, indMap );
-            SimpTri stri;
-            stri.ind0 = pntShift[i0];
-            stri.ind1 = pntShift[i1];
-            stri.ind2 = pntShift[i2];
-            stri.m_Tags = sTriVec[t].m_Tags;
-            allTriVec.push_back( stri );
+            tagIndMap[ tags[i] ] = i;
         }
-    }
-    //==== Assemble All Used Points ====//
-    vector< vec3d* > allUsedPntVec;
-    for ( int i = 0 ; i < ( int )allPntVec.size() ; i++ )
-    {
-        if ( pntShift[i] >= 0 )
+
+        vector< vector< int > > tagTriVec( tags.size() );
+        for ( int j = 0; j < ( int ) m_GlobalTriVec.size(); j++ )
         {
-            allUsedPntVec.push_back( allPntVec[i] );
+            map< int, int >::iterator mi = tagIndMap.find( m_GlobalTriTagVec[j] );
+            if ( mi != tagIndMap.end() )
+            {
+                tagTriVec[ mi->second ].push_back( j );
+            }
         }
-    }
 
-    FILE* file_id = fopen( filename.c_str(), "w" );
-    if ( file_id )
-    {
-        std::vector< int > tags = SubSurfaceMgr.GetAllTags();
         for ( int i = 0; i < ( int ) tags.size(); i++ )
         {
             std::string tagname = SubSurfaceMgr.GetTagNames( i );
             fprintf( file_id, "solid %s\n", tagname.c_str() );
 
-            for ( int j = 0; j < ( int ) allTriVec.size(); j++ )
+            for ( int j = 0; j < ( int ) tagTriVec[i].size(); j++ )
             {
-                SimpTri* stri = &allTriVec[j];
-                int t = SubSurfaceMgr.GetTag( stri->m_Tags );
-
-                if ( t == tags[i] )
-                {
-                    vec3d* p0 = allUsedPntVec[stri->ind0];
-                    vec3d* p1 = allUsedPntVec[stri->ind1];
-                    vec3d* p2 = allUsedPntVec[stri->ind2];
-                    vec3d v10 = *p1 - *p0;
-                    vec3d v20 = *p2 - *p1;
-                    vec3d norm = cross( v10, v20 );
-                    norm.normalize();
-
-                    fprintf( file_id, " facet normal  %2.10le %2.10le %2.10le\n",  norm.x(), norm.y(), norm.z() );
-                    fprintf( file_id, "   outer loop\n" );
-
-                    fprintf( file_id, "     vertex %2.10le %2.10le %2.10le\n", p0->x(), p0->y(), p0->z() );
-                    fprintf( file_id, "     vertex %2.10le %2.10le %2.10le\n", p1->x(), p1->y(), p1->z() );
-                    fprintf( file_id, "     vertex %2.10le %2.10le %2.10le\n", p2->x(), p2->y(), p2->z() );
-
-                    fprintf( file_id, "   endloop\n" );
-                    fprintf( file_id, " endfacet\n" );
-                }
+                SimpTri* stri = &m_GlobalTriVec[ tagTriVec[i][j] ];
+                WriteSTLFacet( file_id, m_GlobalPntVec[stri->ind0], m_GlobalPntVec[stri->ind1], m_GlobalPntVec[stri->ind2] );
             }
             fprintf( file_id, "endsolid %s\n", tagname.c_str() );
         }
@@ -1576,33 +1789,24 @@ void CfdMeshMgrSingleton::WriteTaggedSTL( const string &filename )
 
 void CfdMeshMgrSingleton::WriteSTL( const string &filename )
 {
-    FILE* file_id = fopen( filename.c_str(), "w" );
+    FILE* file_id = OpenExportFile( filename );
     if ( file_id )
     {
-        int numwake = 0;
         fprintf( file_id, "solid\n" );
-        for ( int i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
+        for ( int i = 0 ; i < m_NumGlobalBodyTris ; i++ )
         {
-            if ( !m_SurfVec[i]->GetWakeFlag() )
-            {
-                m_SurfVec[i]->GetMesh()->WriteSTL( file_id );
-            }
-            else
-            {
-                numwake++;
-            }
+            SimpTri* stri = &m_GlobalTriVec[i];
+            WriteSTLFacet( file_id, m_GlobalPntVec[stri->ind0], m_GlobalPntVec[stri->ind1], m_GlobalPntVec[stri->ind2] );
         }
         fprintf( file_id, "endsolid\n" );
 
-        if( numwake > 0 )
+        if ( m_NumGlobalBodyTris < ( int )m_GlobalTriVec.size() )
         {
             fprintf( file_id, "solid wake\n" );
-            for ( int i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
+            for ( int i = m_NumGlobalBodyTris ; i < ( int )m_GlobalTriVec.size() ; i++ )
             {
-                if ( m_SurfVec[i]->GetWakeFlag() )
-                {
-                    m_SurfVec[i]->GetMesh()->WriteSTL( file_id );
-                }
+                SimpTri* stri = &m_GlobalTriVec[i];
+                WriteSTLFacet( file_id, m_GlobalPntVec[stri->ind0], m_GlobalPntVec[stri->ind1], m_GlobalPntVec[stri->ind2] );
             }
             fprintf( file_id, "endsolid wake\n" );
         }
@@ -1612,62 +1816,30 @@ void CfdMeshMgrSingleton::WriteSTL( const string &filename )
 
 void CfdMeshMgrSingleton::WriteTetGen( const string &filename )
 {
-    FILE* fp = fopen( filename.c_str(), "w" );
+    FILE* fp = OpenExportFile( filename );
     if ( !fp )
     {
         return;
     }
 
-    int tri_cnt = 0;
-    vector< vec3d* > allPntVec;
-    for ( int i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
-    {
-        vector< vec3d >& sPntVec = m_SurfVec[i]->GetMesh()->GetSimpPntVec();
-        for ( int v = 0 ; v < ( int )sPntVec.size() ; v++ )
-        {
-            allPntVec.push_back( &sPntVec[v] );
-        }
-        tri_cnt += m_SurfVec[i]->GetMesh()->GetSimpTriVec().size();
-    }
-
-    //==== Build Map ====//
-    map< int, vector< int > > indMap;
-    vector< int > pntShift;
-    int numPnts = BuildIndMap( allPntVec, indMap, pntShift );
-
     //===== Write Num Pnts and Tris ====//
     fprintf( fp, "# Part 1 - node list\n" );
-    fprintf( fp, "%d 3 0 0\n", numPnts );
+    fprintf( fp, "%d 3 0 0\n", ( int )m_GlobalPntVec.size() );
 
     //==== Write Model Pnts ====//
-    for ( int i = 0 ; i < ( int )allPntVec.size() ; i++ )
+    for ( int i = 0 ; i < ( int )m_GlobalPntVec.size() ; i++ )
     {
-        if ( pntShift[i] >= 0 )
-        {
-            fprintf( fp, "%d %.16g %.16g %.16g\n", i + 1, allPntVec[i]->x(), allPntVec[i]->y(), allPntVec[i]->z() );
-        }
+        fprintf( fp, "%d %.16g %.16g %.16g\n", i + 1, m_GlobalPntVec[i].x(), m_GlobalPntVec[i].y(), m_GlobalPntVec[i].z() );
     }
 
     //==== Write Tris ====//
     fprintf( fp, "# Part 2 - facet list\n" );
-    fprintf( fp, "%d 0\n", tri_cnt );
+    fprintf( fp, "%d 0\n", ( int )m_GlobalTriVec.size() );
 
-    for ( int i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
+    for ( int i = 0 ; i < ( int )m_GlobalTriVec.size() ; i++ )
     {
-        vector < SimpTri >& sTriVec = m_SurfVec[i]->GetMesh()->GetSimpTriVec();
-        vector< vec3d >& sPntVec = m_SurfVec[i]->GetMesh()->GetSimpPntVec();
-        for ( int t = 0 ; t <  ( int )sTriVec.size() ; t++ )
-        {
-            int i0 = FindPntIndex( sPntVec[sTriVec[t].ind0], allPntVec, indMap );
-            int i1 = FindPntIndex( sPntVec[sTriVec[t].ind1], allPntVec, indMap );
-            int i2 = FindPntIndex( sPntVec[sTriVec[t].ind2], allPntVec, indMap );
-            int ind1 = pntShift[i0] + 1;
-            int ind2 = pntShift[i1] + 1;
-            int ind3 = pntShift[i2] + 1;
-
-            fprintf( fp, "1\n" );
-            fprintf( fp, "3 %d %d %d\n", ind1, ind2, ind3 );
-        }
+        fprintf( fp, "1\n" );
+        fprintf( fp, "3 %d %d %d\n", m_GlobalTriVec[i].ind0 + 1, m_GlobalTriVec[i].ind1 + 1, m_GlobalTriVec[i].ind2 + 1 );
     }
 
     fprintf( fp, "# Part 3 - Hole List\n" );
@@ -1727,272 +1899,137 @@ void CfdMeshMgrSingleton::WriteTetGen( const string &filename )
     fclose( fp );
 }
 
-void CfdMeshMgrSingleton::WriteNASCART_Obj_Tri_Gmsh( const string &dat_fn, const string &key_fn, const string &obj_fn, const string &tri_fn, const string &gmsh_fn )
+//=====================================================================================//
+//==== Write NASCART File =============================================================//
+//=====================================================================================//
+void CfdMeshMgrSingleton::WriteNASCART( const string &filename )
 {
-#ifdef DEBUG_CFD_MESH
-    //==== Find Smallest Edge ====//
-    double small_edge = 1.0e12;
-    for ( int i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
+    FILE* fp = OpenExportFile( filename );
+
+    if ( fp )
     {
-        vector < SimpTri >& sTriVec = m_SurfVec[i]->GetMesh()->GetSimpTriVec();
-        vector< vec3d >& sPntVec = m_SurfVec[i]->GetMesh()->GetSimpPntVec();
-        for ( int t = 0 ; t <  ( int )sTriVec.size() ; t++ )
+        //===== Write Num Pnts and Tris ====//
+        fprintf( fp, "%d %d\n", ( int )m_GlobalSplitPntVec.size(), ( int )m_GlobalTriVec.size() );
+
+        //==== Write Pnts ====//
+        for ( int i = 0 ; i < ( int )m_GlobalSplitPntVec.size() ; i++ )
         {
-            double el0 = dist_squared( sPntVec[sTriVec[t].ind0], sPntVec[sTriVec[t].ind1] );
-            double el1 = dist_squared( sPntVec[sTriVec[t].ind1], sPntVec[sTriVec[t].ind2] );
-            double el2 = dist_squared( sPntVec[sTriVec[t].ind2], sPntVec[sTriVec[t].ind0] );
-            if ( el0 < small_edge )
-            {
-                small_edge = el0;
-            }
-            if ( el1 < small_edge )
-            {
-                small_edge = el1;
-            }
-            if ( el2 < small_edge )
-            {
-                small_edge = el2;
-            }
+            vec3d & p = m_GlobalPntVec[ m_GlobalSplitPntVec[i] ];
+            fprintf( fp, "%.16g %.16g %.16g\n", p.x(), p.z(), -p.y() );
         }
-    }
-
-    fprintf( m_DebugFile, "CfdMeshMgr::WriteNASCART Small Edge Length = %f \n", sqrt( small_edge ) );
-#endif
-
-//  //==== Any Files To Write? ====//
-//  if ( !dat_fn && !key_fn && !obj_fn && !tri_fn )
-//      return;
 
-    //==== Find All Points and Tri Counts ====//
-    vector< vec3d* > allPntVec;
-    vector< vec3d* > wakeAllPntVec;
-    for ( int i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
-    {
-        vector< vec3d >& sPntVec = m_SurfVec[i]->GetMesh()->GetSimpPntVec();
-        for ( int v = 0 ; v < ( int )sPntVec.size() ; v++ )
+        //==== Write Tris ====//
+        for ( int i = 0 ; i < ( int )m_GlobalTriVec.size() ; i++ )
         {
-            if ( m_SurfVec[i]->GetWakeFlag() )
-            {
-                wakeAllPntVec.push_back( &sPntVec[v] );
-            }
-            else
-            {
-                allPntVec.push_back( &sPntVec[v] );
-            }
+            vector< int > & splitInd = ( i < m_NumGlobalBodyTris ) ? m_GlobalBodyPntInd : m_GlobalWakePntInd;
+            fprintf( fp, "%d %d %d %d.0\n",
+                     splitInd[ m_GlobalTriVec[i].ind0 ] + 1, splitInd[ m_GlobalTriVec[i].ind2 ] + 1, splitInd[ m_GlobalTriVec[i].ind1 ] + 1,
+                     m_GlobalTriTagVec[i] );
         }
+        fclose( fp );
     }
+}
 
-    //==== Build Map ====//
-    map< int, vector< int > > indMap;
-    vector< int > pntShift;
-    BuildIndMap( allPntVec, indMap, pntShift );
-
-    //==== Build Wake Map If Available ====//
-    map< int, vector< int > > wakeIndMap;
-    vector< int > wakePntShift;
-    int wakeNumPnts = 0;
-    if ( wakeAllPntVec.size() )
-    {
-        wakeNumPnts = BuildIndMap( wakeAllPntVec, wakeIndMap, wakePntShift );
-    }
+//=====================================================================================//
+//==== Write OBJ File =================================================================//
+//=====================================================================================//
+void CfdMeshMgrSingleton::WriteObj( const string &filename )
+{
+    FILE* fp = OpenExportFile( filename );
 
-    //==== Assemble Normal Tris ====//
-    vector< SimpTri > allTriVec;
-    vector< int > allSurfIDVec;
-    for ( int i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
+    if ( fp )
     {
-        if ( !m_SurfVec[i]->GetWakeFlag() )
+        //==== Write Pnts ====//
+        for ( int i = 0 ; i < ( int )m_GlobalSplitPntVec.size() ; i++ )
         {
-            vector < SimpTri >& sTriVec = m_SurfVec[i]->GetMesh()->GetSimpTriVec();
-            vector< vec3d >& sPntVec = m_SurfVec[i]->GetMesh()->GetSimpPntVec();
-            for ( int t = 0 ; t <  ( int )sTriVec.size() ; t++ )
-            {
-                int i0 = FindPntIndex( sPntVec[sTriVec[t].ind0], allPntVec, indMap );
-                int i1 = FindPntIndex( sPntVec[sTriVec[t].ind1], allPntVec, indMap );
-                int i2 = FindPntIndex( sPntVec[sTriVec[t].ind2], allPntVec, indMap );
-                SimpTri stri;
-                stri.ind0 = pntShift[i0] + 1;
-                stri.ind1 = pntShift[i1] + 1;
-                stri.ind2 = pntShift[i2] + 1;
-                stri.m_Tags = sTriVec[t].m_Tags;
-                allTriVec.push_back( stri );
-                allSurfIDVec.push_back( m_SurfVec[i]->GetSurfID() );
-            }
+            vec3d & p = m_GlobalPntVec[ m_GlobalSplitPntVec[i] ];
+            fprintf( fp, "v %16.10f %16.10f %16.10f\n", p.x(), p.z(), -p.y() );
         }
-    }
-    //==== Assemble All Used Points ====//
-    vector< vec3d* > allUsedPntVec;
-    for ( int i = 0 ; i < ( int )allPntVec.size() ; i++ )
-    {
-        if ( pntShift[i] >= 0 )
+        fprintf( fp, "\n" );
+
+        //==== Write Tris ====//
+        for ( int i = 0 ; i < ( int )m_GlobalTriVec.size() ; i++ )
         {
-            allUsedPntVec.push_back( allPntVec[i] );
+            vector< int > & splitInd = ( i < m_NumGlobalBodyTris ) ? m_GlobalBodyPntInd : m_GlobalWakePntInd;
+            fprintf( fp, "f %d %d %d \n", splitInd[ m_GlobalTriVec[i].ind0 ] + 1, splitInd[ m_GlobalTriVec[i].ind1 ] + 1,
+                     splitInd[ m_GlobalTriVec[i].ind2 ] + 1 );
         }
+        fclose( fp );
     }
+}
 
-    //==== Assemble Wake Tris ====//
-    int wakeIndOffset = allUsedPntVec.size();
-    for ( int i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
+//=====================================================================================//
+//==== Write TRI File for Cart3D ======================================================//
+//=====================================================================================//
+void CfdMeshMgrSingleton::WriteTRI( const string &filename )
+{
+    FILE* fp = OpenExportFile( filename );
+
+    if ( fp )
     {
-        if ( m_SurfVec[i]->GetWakeFlag() )
+        //==== Write Pnt Count and Tri Count ====//
+        fprintf( fp, "%d %d\n", ( int )m_GlobalSplitPntVec.size(), ( int )m_GlobalTriVec.size() );
+
+        //==== Write Pnts ====//
+        for ( int i = 0 ; i < ( int )m_GlobalSplitPntVec.size() ; i++ )
         {
-            vector < SimpTri >& sTriVec = m_SurfVec[i]->GetMesh()->GetSimpTriVec();
-            vector< vec3d >& sPntVec = m_SurfVec[i]->GetMesh()->GetSimpPntVec();
-            for ( int t = 0 ; t <  ( int )sTriVec.size() ; t++ )
-            {
-                int i0 = FindPntIndex( sPntVec[sTriVec[t].ind0], wakeAllPntVec, wakeIndMap );
-                int i1 = FindPntIndex( sPntVec[sTriVec[t].ind1], wakeAllPntVec, wakeIndMap );
-                int i2 = FindPntIndex( sPntVec[sTriVec[t].ind2], wakeAllPntVec, wakeIndMap );
-                SimpTri stri;
-                stri.ind0 = wakePntShift[i0] + 1 + wakeIndOffset;
-                stri.ind1 = wakePntShift[i1] + 1 + wakeIndOffset;
-                stri.ind2 = wakePntShift[i2] + 1 + wakeIndOffset;
-                stri.m_Tags = sTriVec[t].m_Tags;
-                allTriVec.push_back( stri );
-                allSurfIDVec.push_back( m_SurfVec[i]->GetSurfID() );
-            }
+            vec3d & p = m_GlobalPntVec[ m_GlobalSplitPntVec[i] ];
+            fprintf( fp, "%16.10g %16.10g %16.10g\n", p.x(), p.y(), p.z() );
         }
-    }
 
-    //==== Assemble All Used Points ====//
-    for ( int i = 0 ; i < ( int )wakeAllPntVec.size() ; i++ )
-    {
-        if ( wakePntShift[i] >= 0 )
+        //==== Write Tris ====//
+        for ( int i = 0 ; i < ( int )m_GlobalTriVec.size() ; i++ )
         {
-            allUsedPntVec.push_back( wakeAllPntVec[i] );
+            vector< int > & splitInd = ( i < m_NumGlobalBodyTris ) ? m_GlobalBodyPntInd : m_GlobalWakePntInd;
+            fprintf( fp, "%d %d %d \n", splitInd[ m_GlobalTriVec[i].ind0 ] + 1, splitInd[ m_GlobalTriVec[i].ind1 ] + 1,
+                     splitInd[ m_GlobalTriVec[i].ind2 ] + 1 );
         }
-    }
 
-    //=====================================================================================//
-    //==== Write NASCART File =================================================================//
-    //=====================================================================================//
-    if ( dat_fn.length() != 0 )
-    {
-        FILE* fp = fopen( dat_fn.c_str(), "w" );
-
-        if ( fp )
+        //==== Write Component ID ====//
+        for ( int i = 0 ; i < ( int )m_GlobalTriVec.size() ; i++ )
         {
-            //===== Write Num Pnts and Tris ====//
-            fprintf( fp, "%d %d\n", ( int )allUsedPntVec.size(), ( int )allTriVec.size() );
-
-            //==== Write Pnts ====//
-            for ( int i = 0 ; i < ( int )allUsedPntVec.size() ; i++ )
-            {
-                fprintf( fp, "%.16g %.16g %.16g\n", allUsedPntVec[i]->x(), allUsedPntVec[i]->z(), -allUsedPntVec[i]->y() );
-            }
-
-            //==== Write Tris ====//
-            for ( int i = 0 ; i < ( int )allTriVec.size() ; i++ )
-            {
-                fprintf( fp, "%d %d %d %d.0\n",
-                         allTriVec[i].ind0, allTriVec[i].ind2, allTriVec[i].ind1,
-                         SubSurfaceMgr.GetTag( allTriVec[i].m_Tags ) );
-            }
-            fclose( fp );
+            fprintf( fp, "%d \n", m_GlobalTriTagVec[i] );
         }
-    }
 
-    if ( key_fn.length() != 0 )
-    {
-        SubSurfaceMgr.WriteNascartKeyFile( key_fn );
+        fclose( fp );
     }
+}
 
-    //=====================================================================================//
-    //==== Write OBJ File =================================================================//
-    //=====================================================================================//
-    if ( obj_fn.length() != 0 )
+//=====================================================================================//
+//==== Write gmsh File           ======================================================//
+//=====================================================================================//
+void CfdMeshMgrSingleton::WriteGmsh( const string &filename )
+{
+    FILE* fp = OpenExportFile( filename );
+    if ( fp )
     {
-        FILE* fp = fopen( obj_fn.c_str(), "w" );
+        fprintf( fp, "$MeshFormat\n" );
+        fprintf( fp, "2.2 0 %d\n", ( int )sizeof( double ) );
+        fprintf( fp, "$EndMeshFormat\n" );
 
-        if ( fp )
+        //==== Write Nodes ====//
+        fprintf( fp, "$Nodes\n" );
+        fprintf( fp, "%d\n", ( int )m_GlobalSplitPntVec.size() );
+        for ( int i = 0 ; i < ( int )m_GlobalSplitPntVec.size() ; i++ )
         {
-            //==== Write Pnts ====//
-            for ( int i = 0 ; i < ( int )allUsedPntVec.size() ; i++ )
-            {
-                fprintf( fp, "v %16.10f %16.10f %16.10f\n", allUsedPntVec[i]->x(), allUsedPntVec[i]->z(), -allUsedPntVec[i]->y() );
-            }
-            fprintf( fp, "\n" );
-
-            //==== Write Tris ====//
-            for ( int i = 0 ; i < ( int )allTriVec.size() ; i++ )
-            {
-                fprintf( fp, "f %d %d %d \n", allTriVec[i].ind0, allTriVec[i].ind1, allTriVec[i].ind2 );
-            }
-            fclose( fp );
+            vec3d & p = m_GlobalPntVec[ m_GlobalSplitPntVec[i] ];
+            fprintf( fp, "%d %16.10f %16.10f %16.10f\n", i + 1, p.x(), p.y(), p.z() );
         }
-    }
-
+        fprintf( fp, "$EndNodes\n" );
 
-    //=====================================================================================//
-    //==== Write TRI File for Cart3D ======================================================//
-    //=====================================================================================//
-    if ( tri_fn.length() != 0 )
-    {
-        FILE* fp = fopen( tri_fn.c_str(), "w" );
+        //==== Write Tris ====//
+        fprintf( fp, "$Elements\n" );
+        fprintf( fp, "%d\n", ( int )m_GlobalTriVec.size() );
 
-        if ( fp )
+        for ( int i = 0 ; i < ( int )m_GlobalTriVec.size() ; i++ )
         {
-            //==== Write Pnt Count and Tri Count ====//
-            fprintf( fp, "%d %d\n", ( int )allUsedPntVec.size(), ( int )allTriVec.size() );
-
-            //==== Write Pnts ====//
-            for ( int i = 0 ; i < ( int )allUsedPntVec.size() ; i++ )
-            {
-                fprintf( fp, "%16.10g %16.10g %16.10g\n", allUsedPntVec[i]->x(), allUsedPntVec[i]->y(), allUsedPntVec[i]->z() );
-            }
-
-            //==== Write Tris ====//
-            for ( int i = 0 ; i < ( int )allTriVec.size() ; i++ )
-            {
-                fprintf( fp, "%d %d %d \n", allTriVec[i].ind0, allTriVec[i].ind1, allTriVec[i].ind2 );
-            }
-
-            //==== Write Component ID ====//
-            for ( int i = 0 ; i < ( int )allTriVec.size() ; i++ )
-            {
-                fprintf( fp, "%d \n", SubSurfaceMgr.GetTag( allTriVec[i].m_Tags ) );
-            }
-
-            fclose( fp );
+            vector< int > & splitInd = ( i < m_NumGlobalBodyTris ) ? m_GlobalBodyPntInd : m_GlobalWakePntInd;
+            fprintf( fp, "%d 2 0 %d %d %d \n", i + 1, splitInd[ m_GlobalTriVec[i].ind0 ] + 1, splitInd[ m_GlobalTriVec[i].ind1 ] + 1,
+                     splitInd[ m_GlobalTriVec[i].ind2 ] + 1 );
         }
-    }
-
-    //=====================================================================================//
-    //==== Write gmsh File           ======================================================//
-    //=====================================================================================//
-    if ( gmsh_fn.length() != 0 )
-    {
-        FILE* fp = fopen( gmsh_fn.c_str(), "w" );
-        if ( fp )
-        {
-            fprintf( fp, "$MeshFormat\n" );
-            fprintf( fp, "2.2 0 %d\n", ( int )sizeof( double ) );
-            fprintf( fp, "$EndMeshFormat\n" );
-
-            //==== Write Nodes ====//
-            fprintf( fp, "$Nodes\n" );
-            fprintf( fp, "%d\n", ( int )allUsedPntVec.size() );
-            for ( int i = 0 ; i < ( int )allUsedPntVec.size() ; i++ )
-            {
-                fprintf( fp, "%d %16.10f %16.10f %16.10f\n", i + 1,
-                         allUsedPntVec[i]->x(), allUsedPntVec[i]->y(), allUsedPntVec[i]->z() );
-            }
-            fprintf( fp, "$EndNodes\n" );
-
-            //==== Write Tris ====//
-            fprintf( fp, "$Elements\n" );
-            fprintf( fp, "%d\n", ( int )allTriVec.size() );
 
-            int ele_cnt = 1;
-            for ( int i = 0 ; i < ( int )allTriVec.size() ; i++ )
-            {
-                fprintf( fp, "%d 2 0 %d %d %d \n", ele_cnt, allTriVec[i].ind0, allTriVec[i].ind1, allTriVec[i].ind2 );
-                ele_cnt++;
-            }
-
-            fprintf( fp, "$EndElements\n" );
-            fclose( fp );
-        }
+        fprintf( fp, "$EndElements\n" );
+        fclose( fp );
     }
 }
 
@@ -2188,82 +2225,52 @@ string CfdMeshMgrSingleton::CheckWaterTight()
 {
     vector< Tri* > triVec;
 
-    int tri_cnt = 0;
-    vector< vec3d* > allPntVec;
-    for ( int i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
-    {
-        if( m_SurfVec[i]->GetSurfaceCfdType() != vsp::CFD_TRANSPARENT || m_SurfVec[i]->GetFarFlag() || m_SurfVec[i]->GetSymPlaneFlag() )
-        {
-            vector< vec3d >& sPntVec = m_SurfVec[i]->GetMesh()->GetSimpPntVec();
-            for ( int v = 0 ; v < ( int )sPntVec.size() ; v++ )
-            {
-                allPntVec.push_back( &sPntVec[v] );
-            }
-            tri_cnt += m_SurfVec[i]->GetMesh()->GetSimpTriVec().size();
-        }
-    }
-
-    //==== Build Map ====//
-    map< int, vector< int > > indMap;
-    vector< int > pntShift;
-    BuildIndMap( allPntVec, indMap, pntShift );
-
     //==== Create Nodes ====//
-    for ( int i = 0 ; i < ( int )allPntVec.size() ; i++ )
+    for ( int i = 0 ; i < ( int )m_GlobalPntVec.size() ; i++ )
     {
-        if ( pntShift[i] >= 0 )
-        {
-            Node* n = new Node();
-            n->pnt = *allPntVec[i];
-            m_nodeStore.push_back( n );
-        }
+        Node* n = new Node();
+        n->pnt = m_GlobalPntVec[i];
+        m_nodeStore.push_back( n );
     }
 
     //==== Create Edges and Tris ====//
     int moreThanTwoTriPerEdge = 0;
     map< int, vector<Edge*> > edgeMap;
-    for ( int i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
+    for ( int t = 0 ; t < ( int )m_GlobalTriVec.size() ; t++ )
     {
-        if( m_SurfVec[i]->GetSurfaceCfdType() != vsp::CFD_TRANSPARENT || m_SurfVec[i]->GetFarFlag() || m_SurfVec[i]->GetSymPlaneFlag() )
+        Surf* surf = m_SurfVec[ m_GlobalTriSurfVec[t] ];
+        if( surf->GetSurfaceCfdType() != vsp::CFD_TRANSPARENT || surf->GetFarFlag() || surf->GetSymPlaneFlag() )
         {
-            vector < SimpTri >& sTriVec = m_SurfVec[i]->GetMesh()->GetSimpTriVec();
-            vector< vec3d >& sPntVec = m_SurfVec[i]->GetMesh()->GetSimpPntVec();
-            for ( int t = 0 ; t <  ( int )sTriVec.size() ; t++ )
-            {
-                int i0 = FindPntIndex( sPntVec[sTriVec[t].ind0], allPntVec, indMap );
-                int i1 = FindPntIndex( sPntVec[sTriVec[t].ind1], allPntVec, indMap );
-                int i2 = FindPntIndex( sPntVec[sTriVec[t].ind2], allPntVec, indMap );
-                int ind1 = pntShift[i0];
-                int ind2 = pntShift[i1];
-                int ind3 = pntShift[i2];
+            int ind1 = m_GlobalTriVec[t].ind0;
+            int ind2 = m_GlobalTriVec[t].ind1;
+            int ind3 = m_GlobalTriVec[t].ind2;
 
-                Edge* e0 = FindAddEdge( edgeMap, m_nodeStore, ind1, ind2 );
-                Edge* e1 = FindAddEdge( edgeMap, m_nodeStore, ind2, ind3 );
-                Edge* e2 = FindAddEdge( edgeMap, m_nodeStore, ind3, ind1 );
+            Edge* e0 = FindAddEdge( edgeMap, m_nodeStore, ind1, ind2 );
+            Edge* e1 = FindAddEdge( edgeMap, m_nodeStore, ind2, ind3 );
+            Edge* e2 = FindAddEdge( edgeMap, m_nodeStore, ind3, ind1 );
 
-                Tri* tri = new Tri( m_nodeStore[ind1], m_nodeStore[ind2], m_nodeStore[ind3], e0, e1, e2 );
+            Tri* tri = new Tri( m_nodeStore[ind1], m_nodeStore[ind2], m_nodeStore[ind3], e0, e1, e2 );
 
-                if ( !e0->SetTri( tri ) )
-                {
-                    tri->debugFlag = true;
-                    moreThanTwoTriPerEdge++;
-                }
-                if ( !e1->SetTri( tri ) )
-                {
-                    tri->debugFlag = true;
-                    moreThanTwoTriPerEdge++;
-                }
-                if ( !e2->SetTri( tri ) )
-                {
-                    tri->debugFlag = true;
-                    moreThanTwoTriPerEdge++;
-                }
-                triVec.push_back( tri );
+            if ( !e0->SetTri( tri ) )
+            {
+                tri->debugFlag = true;
+                moreThanTwoTriPerEdge++;
+            }
+            if ( !e1->SetTri( tri ) )
+            {
+                tri->debugFlag = true;
+                moreThanTwoTriPerEdge++;
+            }
+            if ( !e2->SetTri( tri ) )
+            {
+                tri->debugFlag = true;
+                moreThanTwoTriPerEdge++;
+            }
+            triVec.push_back( tri );
 
-                if ( tri->debugFlag == true )
-                {
-                    m_BadTris.push_back( tri );
-                }
+            if ( tri->debugFlag == true )
+            {
+                m_BadTris.push_back( tri );
             }
         }
     }
@@ -2449,6 +2456,8 @@ void CfdMeshMgrSingleton::Intersect()
 
     if ( GetCfdSettingsPtr()->GetIntersectSubSurfs() ) BuildSubSurfIntChains();
 
+    std::chrono::steady_clock::time_point t_start = std::chrono::steady_clock::now();
+
     //==== Quad Tree Intersection - Intersection Segments Get Loaded at AddIntersectionSeg ===//
     for ( int i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
         for ( int j = i + 1 ; j < ( int )m_SurfVec.size() ; j++ )
@@ -2456,18 +2465,36 @@ void CfdMeshMgrSingleton::Intersect()
             m_SurfVec[i]->Intersect( m_SurfVec[j] );
         }
 
+    std::chrono::steady_clock::time_point t_surf = std::chrono::steady_clock::now();
 
     BuildChains();
 
+    std::chrono::steady_clock::time_point t_chain = std::chrono::steady_clock::now();
+
     LoadBorderCurves();
 
     MergeInteriorChainIPnts();
 
     SplitBorderCurves();
 
+    std::chrono::steady_clock::time_point t_border = std::chrono::steady_clock::now();
+
     IntersectSplitChains();
 
+    std::chrono::steady_clock::time_point t_split = std::chrono::steady_clock::now();
+
     BuildCurves();
+
+    //==== Binning And Broad Phase Counts ====//
+    Results* res = ResultsMgr.CreateResults( "CFD_Intersect" );
+    res->Add( NameValData( "Num_IPnt_Bins", m_IPntGrid.GetNumBins() ) );
+    res->Add( NameValData( "Num_IPnt_Compares", ( double )m_IPntGrid.GetNumCompares() ) );
+    res->Add( NameValData( "Num_Chains", ( int )m_ISegChainList.size() ) );
+    res->Add( NameValData( "Num_Chain_Pairs", ( double )m_NumChainPairs ) );
+    res->Add( NameValData( "Num_Chain_Candidates", ( double )m_NumChainCandidates ) );
+    res->Add( NameValData( "Surf_Intersect_Time", std::chrono::duration< double >( t_surf - t_start ).count() ) );
+    res->Add( NameValData( "Build_Chains_Time", std::chrono::duration< double >( t_chain - t_surf ).count() ) );
+    res->Add( NameValData( "Split_Chains_Time", std::chrono::duration< double >( t_split - t_border ).count() ) );
 }
 
 vector< Surf* > CfdMeshMgrSingleton::CreateDomainSurfs()
@@ -2778,13 +2805,8 @@ void CfdMeshMgrSingleton::AddIntersectionSeg( SurfPatch& pA, SurfPatch& pB, vec3
 
     new ISeg( pA.get_surf_ptr(), pB.get_surf_ptr(), ipnt0, ipnt1 );
 
-    int id0 = IPntBin::ComputeID( ipnt0->m_Pnt );
-    m_BinMap[id0].m_ID = id0;
-    m_BinMap[id0].m_IPnts.push_back( ipnt0 );
-
-    int id1 = IPntBin::ComputeID( ipnt1->m_Pnt );
-    m_BinMap[id1].m_ID = id1;
-    m_BinMap[id1].m_IPnts.push_back( ipnt1 );
+    m_IPntGrid.Add( ipnt0 );
+    m_IPntGrid.Add( ipnt1 );
 
 #ifdef DEBUG_CFD_MESH
 
@@ -2855,30 +2877,15 @@ ISeg* CfdMeshMgrSingleton::CreateSurfaceSeg(  Surf* surfA, vec2d & uwA0, vec2d &
 
 void CfdMeshMgrSingleton::BuildChains()
 {
-    //==== Load Adjoining Bins =====//
-    map< int, IPntBin >::const_iterator iter;
-    for ( iter = m_BinMap.begin() ; iter != m_BinMap.end() ; iter++ )
-    {
-        int id = ( *iter ).second.m_ID;
-        map< int, IPntBin >::const_iterator adj;
-        for ( int i = -3 ; i < 4 ; i++ )        // Check All Nearby Bins
-        {
-            if ( i != 0 &&  m_BinMap.find( id + i ) != m_BinMap.end()  )
-            {
-                m_BinMap[id].m_AdjBins.push_back( id + i );
-            }
-        }
-    }
-
     //==== Create Chains ====//
-    for ( iter = m_BinMap.begin() ; iter != m_BinMap.end() ; iter++ )
+    for ( int b = 0 ; b < m_IPntGrid.GetNumBins() ; b++ )
     {
-        int id = ( *iter ).second.m_ID;
-        for ( int i = 0 ; i < ( int )m_BinMap[id].m_IPnts.size() ; i++ )
+        IPntBin & bin = m_IPntGrid.GetBin( b );
+        for ( int i = 0 ; i < ( int )bin.m_IPnts.size() ; i++ )
         {
-            if ( !m_BinMap[id].m_IPnts[i]->m_UsedFlag )
+            if ( !bin.m_IPnts[i]->m_UsedFlag )
             {
-                ISeg* seg = m_BinMap[id].m_IPnts[i]->m_Segs[0];
+                ISeg* seg = bin.m_IPnts[i]->m_Segs[0];
                 seg->m_IPnt[0]->m_UsedFlag = true;
                 seg->m_IPnt[1]->m_UsedFlag = true;
                 ISegChain* chain = new ISegChain;           // Create New Chain
@@ -2901,13 +2908,11 @@ void CfdMeshMgrSingleton::BuildChains()
 
 #ifdef DEBUG_CFD_MESH
 
-    int num_bins = 0;
+    int num_bins = m_IPntGrid.GetNumBins();
     int total_num_segs = 0;
-    for ( iter = m_BinMap.begin() ; iter != m_BinMap.end() ; iter++ )
+    for ( int b = 0 ; b < num_bins ; b++ )
     {
-        num_bins++;
-        int id = ( *iter ).second.m_ID;
-        total_num_segs += m_BinMap[id].m_IPnts.size();
+        total_num_segs += m_IPntGrid.GetBin( b ).m_IPnts.size();
     }
 
     double avg_num_segs = ( double )total_num_segs / ( double )num_bins;
@@ -2937,9 +2942,7 @@ void CfdMeshMgrSingleton::ExpandChain( ISegChain* chain )
             testIPnt = chain->m_ISegDeque.back()->m_IPnt[1];
         }
 
-        int binID = IPntBin::ComputeID( testIPnt->m_Pnt );
-
-        IPnt* matchIPnt = m_BinMap[binID].Match( testIPnt, m_BinMap );
+        IPnt* matchIPnt = m_IPntGrid.Match( testIPnt );
 
         if ( !matchIPnt && !expandFront )   // No more matches in back of chain
         {
@@ -3515,11 +3518,68 @@ void CfdMeshMgrSingleton::IntersectSplitChains()
         chains[i]->BuildBoxes();
     }
 
+    //==== Broad Phase - Tree Of Chain UW Boxes On Each Surf ====//
+    map< Surf*, vector< int > > surf_chains;
+    for ( int i = 0 ; i < ( int )chains.size() ; i++ )
+    {
+        surf_chains[ chains[i]->m_SurfA ].push_back( i );
+        if ( chains[i]->m_SurfB != chains[i]->m_SurfA )
+        {
+            surf_chains[ chains[i]->m_SurfB ].push_back( i );
+        }
+    }
+
+    map< Surf*, BndBoxTree > surf_trees;
+    map< Surf*, vector< int > >::iterator sc;
+    for ( sc = surf_chains.begin() ; sc != surf_chains.end() ; sc++ )
+    {
+        vector< BndBox > box_vec( sc->second.size() );
+        for ( int k = 0 ; k < ( int )sc->second.size() ; k++ )
+        {
+            ISegChain* chain = chains[ sc->second[k] ];
+            box_vec[k] = ( chain->m_SurfA == sc->first ) ? chain->m_ISegBoxA.m_Box : chain->m_ISegBoxB.m_Box;
+        }
+        surf_trees[ sc->first ].Build( box_vec );
+    }
+
+    m_NumChainPairs = ( long long )chains.size() * ( ( long long )chains.size() - 1 ) / 2;
+    m_NumChainCandidates = 0;
+
     //==== Do Intersection ====//
     for ( int i = 0 ; i < ( int )chains.size() ; i++ )
     {
-        for ( int j = i + 1 ; j < ( int )chains.size() ; j++ )
+        // Chains whose box overlaps on a shared surf, the same surf Intersect picks below
+        vector< int > hits, cand;
+        surf_trees[ chains[i]->m_SurfA ].Intersect( chains[i]->m_ISegBoxA.m_Box, hits );
+        for ( int k = 0 ; k < ( int )hits.size() ; k++ )
         {
+            cand.push_back( surf_chains[ chains[i]->m_SurfA ][ hits[k] ] );
+        }
+
+        hits.clear();
+        surf_trees[ chains[i]->m_SurfB ].Intersect( chains[i]->m_ISegBoxB.m_Box, hits );
+        for ( int k = 0 ; k < ( int )hits.size() ; k++ )
+        {
+            int j = surf_chains[ chains[i]->m_SurfB ][ hits[k] ];
+            if ( chains[j]->m_SurfA != chains[i]->m_SurfA && chains[j]->m_SurfB != chains[i]->m_SurfA )
+            {
+                cand.push_back( j );
+            }
+        }
+
+        // Visit in the same order as the all pairs loop so splits are added in the same order
+        sort( cand.begin(), cand.end() );
+        cand.erase( unique( cand.begin(), cand.end() ), cand.end() );
+
+        for ( int k = 0 ; k < ( int )cand.size() ; k++ )
+        {
+            int j = cand[k];
+            if ( j <= i )
+            {
+                continue;
+            }
+            m_NumChainCandidates++;
+
             if ( chains[i]->m_SurfA == chains[j]->m_SurfA || chains[i]->m_SurfA == chains[j]->m_SurfB )
             {
                 chains[i]->Intersect( chains[i]->m_SurfA, chains[j] );
@@ -75,6 +75,7 @@
 
 #include <set>
 #include <map>
+#include <unordered_map>
 #include <vector>
 #include <list>
 #include <string>
@@ -95,9 +96,12 @@ public:
     void MatchBorderCurve( ICurve* curve );
     void BuildSurfs();
     double DistToClosestLeadingEdgePnt( vec3d & p );
+    void BuildLeadingEdgeCells();
+    bool OnLeadingEdge( const vec3d & pnt, double tol );
 
     WakeMgr* m_WakeMgrPtr;
     vector< vec3d > m_LeadingEdge;
+    unordered_map< long long, vector< int > > m_LeadingEdgeCells;      // Hashed m_LeadingEdge Indices
     vector< ICurve* > m_LeadingCurves;
     vector< Surf* > m_SurfVec;
 
@@ -242,13 +246,20 @@ public:
 
     virtual void CleanMergeSurfs();
 
+    virtual void BuildGlobalMesh();
+    virtual void ClearGlobalMesh();
+
     virtual void WriteSTL( const string &filename );
     virtual void WriteTaggedSTL( const string &filename );
     virtual void WriteTetGen( const string &filename );
-    virtual void WriteNASCART_Obj_Tri_Gmsh( const string &dat_fn, const string &key_fn, const string &obj_fn, const string &tri_fn, const string &gmsh_fn );
+    virtual void WriteNASCART( const string &filename );
+    virtual void WriteObj( const string &filename );
+    virtual void WriteTRI( const string &filename );
+    virtual void WriteGmsh( const string &filename );
     virtual void WriteSurfsIntCurves( const string &filename  );
 
     virtual void ExportFiles();
+    virtual void ExportMeshFile( int file_type, const string &filename );
     //virtual void CheckDupOrAdd( Node* node, vector< Node* > & nodeVec );
     virtual int BuildIndMap( vector< vec3d* > & allPntVec, map< int, vector< int > >& indMap, vector< int > & pntShift );
     virtual int  FindPntIndex( vec3d& pnt, vector< vec3d* > & allPntVec,
@@ -275,6 +286,10 @@ public:
     {
         return m_SurfVec[ind];
     }
+    virtual int GetNumSurfs()
+    {
+        return ( int )m_SurfVec.size();
+    }
 
 //  virtual void AddISeg( Surf* sA, Surf* sB, vec2d & sAuw0, vec2d & sAuw1,  vec2d & sBuw0, vec2d & sBuw1 );
     virtual void AddIntersectionSeg( SurfPatch& pA, SurfPatch& pB, vec3d & ip0, vec3d & ip1 );
@@ -385,7 +400,10 @@ protected:
 
     vector< IPnt* > m_IPntVec;
     vector< ISeg* > m_IsegVec;
-    map< int, IPntBin > m_BinMap;
+    IPntGrid m_IPntGrid;
+
+    long long m_NumChainPairs;          // All Pairs Of Non Border Chains
+    long long m_NumChainCandidates;     // Pairs Passing The Broad Phase
 
     //vector< ISegSplit* > m_ISegSplitVec;
 
@@ -409,6 +427,18 @@ protected:
     vector<Tri*> m_BadTris;
     vector< Node* > m_nodeStore;
 
+    //==== Global Indexed Mesh, Built Once After Remesh And Shared By All Exporters ====//
+    vector< vec3d > m_GlobalPntVec;         // Unique points merged over all surfaces
+    vector< SimpTri > m_GlobalTriVec;       // Body tris then wake tris, indices into m_GlobalPntVec
+    vector< int > m_GlobalTriTagVec;        // Single tag of each tri
+    vector< int > m_GlobalTriSurfVec;       // Index into m_SurfVec of each tri
+    int m_NumGlobalBodyTris;
+
+    // Body and wake points numbered separately, body first (NASCART, OBJ, TRI, Gmsh)
+    vector< int > m_GlobalSplitPntVec;      // Split index -> unique point
+    vector< int > m_GlobalBodyPntInd;       // Unique point -> split index for body tris
+    vector< int > m_GlobalWakePntInd;       // Unique point -> split index for wake tris
+
     vector< string > m_GeomIDs;
 
 private:
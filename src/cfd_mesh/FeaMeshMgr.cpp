@@ -13,6 +13,9 @@
 #include "Geom.h"
 #include "Vehicle.h"
 #include "Util.h"
+#include "ResultsMgr.h"
+
+#include <chrono>
 
 
 //=============================================================//
@@ -713,6 +716,8 @@ void FeaMeshMgrSingleton::Build()
 
     BuildClean();
 
+    std::chrono::steady_clock::time_point t_start = std::chrono::steady_clock::now();
+
     if ( !m_BatchFlag )
     {
         addOutputText( "Add Structure Parts\n", FEA_OUTPUT );
@@ -730,7 +735,9 @@ void FeaMeshMgrSingleton::Build()
     {
         addOutputText( "Intersect\n", FEA_OUTPUT );
     }
+    std::chrono::steady_clock::time_point t_isect = std::chrono::steady_clock::now();
     Intersect();
+    double isect_time = std::chrono::duration< double >( std::chrono::steady_clock::now() - t_isect ).count();
 
     if ( !m_BatchFlag )
     {
@@ -770,12 +777,30 @@ void FeaMeshMgrSingleton::Build()
     {
         addOutputText( "Build Spar/Rib Mesh\n", FEA_OUTPUT );
     }
+    std::chrono::steady_clock::time_point t_slice = std::chrono::steady_clock::now();
     BuildSliceMesh();
+    double slice_time = std::chrono::duration< double >( std::chrono::steady_clock::now() - t_slice ).count();
 
     LoadAttachPoints();
 
+    double total_time = std::chrono::duration< double >( std::chrono::steady_clock::now() - t_start ).count();
+
+    //==== Phase Timing ====//
+    Results* res = ResultsMgr.CreateResults( "FEA_Mesh" );
+    if ( res )
+    {
+        res->Add( NameValData( "Num_Slices", ( int )m_SliceVec.size() ) );
+        res->Add( NameValData( "Num_Skins", ( int )m_SkinVec.size() ) );
+        res->Add( NameValData( "Intersect_Time", isect_time ) );
+        res->Add( NameValData( "Slice_Mesh_Time", slice_time ) );
+        res->Add( NameValData( "Total_Time", total_time ) );
+    }
+
     if ( !m_BatchFlag )
     {
+        char str[256];
+        sprintf( str, "Intersect: %f sec, Spar/Rib Mesh: %f sec\n", isect_time, slice_time );
+        addOutputText( str, FEA_OUTPUT );
         addOutputText( "Finished\n", FEA_OUTPUT );
     }
 
@@ -788,9 +813,23 @@ void FeaMeshMgrSingleton::Export()
         addOutputText( "Write Results\n", FEA_OUTPUT );
     }
 
+    std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
     WriteNASTRAN( m_ExportFeaFileNames[NASTRAN_FILE_NAME] );
+    std::chrono::steady_clock::time_point t1 = std::chrono::steady_clock::now();
     WriteCalculix();
+    std::chrono::steady_clock::time_point t2 = std::chrono::steady_clock::now();
     WriteSTL( m_ExportFeaFileNames[STL_FEA_NAME] );
+    std::chrono::steady_clock::time_point t3 = std::chrono::steady_clock::now();
+
+    //==== Phase Timing ====//
+    Results* res = ResultsMgr.CreateResults( "FEA_Export" );
+    if ( res )
+    {
+        res->Add( NameValData( "NASTRAN_Time", std::chrono::duration< double >( t1 - t0 ).count() ) );
+        res->Add( NameValData( "Calculix_Time", std::chrono::duration< double >( t2 - t1 ).count() ) );
+        res->Add( NameValData( "STL_Time", std::chrono::duration< double >( t3 - t2 ).count() ) );
+        res->Add( NameValData( "Export_Time", std::chrono::duration< double >( t3 - t0 ).count() ) );
+    }
 
     if ( !m_BatchFlag )
     {
@@ -1469,31 +1508,44 @@ void FeaMeshMgrSingleton::LoadCapChains( Surf* s0, double u, list< ISegChain* >
 void FeaMeshMgrSingleton::BuildSliceMesh()
 {
     int i;
+    int nslice = ( int )m_SliceVec.size();
+    int nskin = ( int )m_SkinVec.size();
+
+    //==== Partition - Load Each Slice's Chains From The Shared Chain List ====//
+    vector< list< ISegChain* > > upper_chains( nslice );
+    vector< list< ISegChain* > > lower_chains( nslice );
+    for ( i = 0 ; i < nslice ; i++ )
+    {
+        m_SliceVec[i]->LoadUpperLowerChains( upper_chains[i], lower_chains[i] );
+    }
 
     //==== Find Upper/Lower Points ====//
-    for ( i = 0 ; i < ( int )m_SliceVec.size() ; i++ )
+    vector< int > num_divisions( nslice, 0 );
+    #pragma omp parallel for schedule( dynamic )
+    for ( i = 0 ; i < nslice ; i++ )
     {
-        m_SliceVec[i]->FindUpperLowerPoints();
+        m_SliceVec[i]->FindUpperLowerPoints( upper_chains[i], lower_chains[i] );
+        num_divisions[i] = m_SliceVec[i]->ComputeNumDivisions();
     }
 
     //==== Find Max Number of Divisions ====//
     int max_num_divisions = 1;
-    for (  i = 0 ; i < ( int )m_SliceVec.size() ; i++ )
+    for (  i = 0 ; i < nslice ; i++ )
     {
-        int num = m_SliceVec[i]->ComputeNumDivisions();
-        if ( num > max_num_divisions )
+        if ( num_divisions[i] > max_num_divisions )
         {
-            max_num_divisions = num;
+            max_num_divisions = num_divisions[i];
         }
     }
     //==== Set Num Divisions For All Slices (So Elements Line Up ) ====//
-    for (  i = 0 ; i < ( int )m_SliceVec.size() ; i++ )
+    for (  i = 0 ; i < nslice ; i++ )
     {
         m_SliceVec[i]->SetNumDivisions( max_num_divisions );
     }
 
     //==== Build Skin FEA Elements ====//
-    for (  i = 0 ; i < ( int )m_SkinVec.size() ; i++ )
+    #pragma omp parallel for schedule( dynamic )
+    for (  i = 0 ; i < nskin ; i++ )
     {
         m_SkinVec[i]->BuildMesh();
         m_SkinVec[i]->SetNodeThick();
@@ -1501,22 +1553,23 @@ void FeaMeshMgrSingleton::BuildSliceMesh()
 
     //==== Snap Slice Points to Skin Nodes ====//
     vector < FeaNode* > skinNodes;
-    for (  i = 0 ; i < ( int )m_SkinVec.size() ; i++ )
+    for (  i = 0 ; i < nskin ; i++ )
     {
         m_SkinVec[i]->LoadNodes( skinNodes );
     }
-    for (  i = 0 ; i < ( int )m_SliceVec.size() ; i++ )
+    vector< vec3d > skin_pnts( skinNodes.size() );
+    for (  i = 0 ; i < ( int )skinNodes.size() ; i++ )
     {
-        m_SliceVec[i]->SnapUpperLowerToSkin( skinNodes );
+        skin_pnts[i] = skinNodes[i]->m_Pnt;
     }
 
-    //==== Build Slice FEA Elements ====//
-    for (  i = 0 ; i < ( int )m_SliceVec.size() ; i++ )
+    //==== Build Slice FEA Elements - Each Slice Fills Its Own Element List ====//
+    #pragma omp parallel for schedule( dynamic )
+    for (  i = 0 ; i < nslice ; i++ )
     {
+        m_SliceVec[i]->SnapUpperLowerToSkin( skin_pnts );
         m_SliceVec[i]->BuildMesh();
     }
-
-
 }
 
 void FeaMeshMgrSingleton::LoadAttachPoints()
@@ -1589,20 +1642,40 @@ void FeaMeshMgrSingleton::ComputeWriteMass()
     }
 }
 
-FeaNode* FeaMeshMgrSingleton::FindNode(  vector< FeaNode* > nodeVec, int id )
+//==== Append Elements Of One Type To Vector ====//
+static void LoadElementsOfType( const vector< FeaElement* > & elem_vec, int type, vector< FeaElement* > & type_vec )
 {
-    //==== jrg Brute Force for Now ====//
-    for ( int i = 0 ; i < ( int )nodeVec.size() ; i++ )
+    for ( int e = 0 ; e < ( int )elem_vec.size() ; e++ )
     {
-        if ( nodeVec[i]->m_Index == id )
+        if ( elem_vec[e]->GetType() == type )
         {
-            return nodeVec[i];
+            type_vec.push_back( elem_vec[e] );
         }
     }
+}
 
-    return NULL;
+//==== Dense Node Index - First Node With Each Index ====//
+void FeaMeshMgrSingleton::BuildNodeIndex( const vector< FeaNode* > & nodeVec, int numPnts, vector< FeaNode* > & nodeIndex )
+{
+    nodeIndex.assign( numPnts + 1, NULL );
+    for ( int i = 0 ; i < ( int )nodeVec.size() ; i++ )
+    {
+        int id = nodeVec[i]->m_Index;
+        if ( id >= 0 && id < ( int )nodeIndex.size() && !nodeIndex[id] )
+        {
+            nodeIndex[id] = nodeVec[i];
+        }
+    }
 }
 
+FeaNode* FeaMeshMgrSingleton::FindNode( const vector< FeaNode* > & nodeIndex, int id )
+{
+    if ( id < 0 || id >= ( int )nodeIndex.size() )
+    {
+        return NULL;
+    }
+    return nodeIndex[id];
+}
 
 void FeaMeshMgrSingleton::WriteNASTRAN( const string &filename )
 {
@@ -1639,6 +1712,9 @@ void FeaMeshMgrSingleton::WriteNASTRAN( const string &filename )
         nodeVec[i]->m_Index = pntShift[ind] + 1;
     }
 
+    vector< FeaNode* > nodeIndex;
+    BuildNodeIndex( nodeVec, numPnts, nodeIndex );
+
     //Stringc fn( base_filename );
     //fn.concatenate( "NASTRAN.dat" );
 
@@ -1655,18 +1731,15 @@ void FeaMeshMgrSingleton::WriteNASTRAN( const string &filename )
                 rib_cnt++;
                 fprintf( fp, "$Rib,%d\n", r + 1 );
                 FeaRib* rib = m_WingSections[s].m_RibVec[r];
-                for ( int i = 0 ; i < ( int )rib->m_Elements.size() ; i++ )
-                {
-                    elem_id++;
-                    rib->m_Elements[i]->WriteNASTRAN( fp, elem_id );
-                }
+                WriteFeaElements( fp, rib->m_Elements, elem_id + 1, FEA_NASTRAN_CARDS );
+                elem_id += ( int )rib->m_Elements.size();
                 fprintf( fp, "\n" );
 
                 //==== Tag Rib Upper/Lower Nodes ====//
                 for ( int i = 0 ; i < ( int )rib->m_UpperPnts.size() ; i++ )
                 {
                     int ind = CfdMeshMgr.FindPntIndex( rib->m_UpperPnts[i], allPntVec, indMap );
-                    FeaNode* node = FindNode( nodeVec, pntShift[ind] + 1 );
+                    FeaNode* node = FindNode( nodeIndex, pntShift[ind] + 1 );
                     if ( node )
                     {
                         node->AddTag( RIB_UPPER, rib_cnt );
@@ -1675,7 +1748,7 @@ void FeaMeshMgrSingleton::WriteNASTRAN( const string &filename )
                 for ( int i = 0 ; i < ( int )rib->m_LowerPnts.size() ; i++ )
                 {
                     int ind = CfdMeshMgr.FindPntIndex( rib->m_LowerPnts[i], allPntVec, indMap );
-                    FeaNode* node = FindNode( nodeVec, pntShift[ind] + 1 );
+                    FeaNode* node = FindNode( nodeIndex, pntShift[ind] + 1 );
                     if ( node )
                     {
                         node->AddTag( RIB_LOWER, rib_cnt );
@@ -1692,18 +1765,15 @@ void FeaMeshMgrSingleton::WriteNASTRAN( const string &filename )
                 spar_cnt++;
                 fprintf( fp, "$Spar,%d\n", r + 1 );
                 FeaSpar* spar = m_WingSections[s].m_SparVec[r];
-                for ( int i = 0 ; i < ( int )spar->m_Elements.size() ; i++ )
-                {
-                    elem_id++;
-                    spar->m_Elements[i]->WriteNASTRAN( fp, elem_id );
-                }
+                WriteFeaElements( fp, spar->m_Elements, elem_id + 1, FEA_NASTRAN_CARDS );
+                elem_id += ( int )spar->m_Elements.size();
                 fprintf( fp, "\n" );
 
                 //==== Tag Spar Upper/Lower Nodes ====//
                 for ( int i = 0 ; i < ( int )spar->m_UpperPnts.size() ; i++ )
                 {
                     int ind = CfdMeshMgr.FindPntIndex( spar->m_UpperPnts[i], allPntVec, indMap );
-                    FeaNode* node = FindNode( nodeVec, pntShift[ind] + 1 );
+                    FeaNode* node = FindNode( nodeIndex, pntShift[ind] + 1 );
                     if ( node )
                     {
                         node->AddTag( SPAR_UPPER, spar_cnt );
@@ -1712,7 +1782,7 @@ void FeaMeshMgrSingleton::WriteNASTRAN( const string &filename )
                 for ( int i = 0 ; i < ( int )spar->m_LowerPnts.size() ; i++ )
                 {
                     int ind = CfdMeshMgr.FindPntIndex( spar->m_LowerPnts[i], allPntVec, indMap );
-                    FeaNode* node = FindNode( nodeVec, pntShift[ind] + 1 );
+                    FeaNode* node = FindNode( nodeIndex, pntShift[ind] + 1 );
                     if ( node )
                     {
                         node->AddTag( SPAR_LOWER, spar_cnt );
@@ -1725,11 +1795,8 @@ void FeaMeshMgrSingleton::WriteNASTRAN( const string &filename )
         for ( int s = 0 ; s < ( int )m_WingSections.size() ; s++ )
         {
             FeaSkin* skin = &m_WingSections[s].m_UpperSkin;
-            for ( int i = 0 ; i < ( int )skin->m_Elements.size() ; i++ )
-            {
-                elem_id++;
-                skin->m_Elements[i]->WriteNASTRAN( fp, elem_id );
-            }
+            WriteFeaElements( fp, skin->m_Elements, elem_id + 1, FEA_NASTRAN_CARDS );
+            elem_id += ( int )skin->m_Elements.size();
         }
         fprintf( fp, "\n" );
 
@@ -1738,15 +1805,22 @@ void FeaMeshMgrSingleton::WriteNASTRAN( const string &filename )
         for ( int s = 0 ; s < ( int )m_WingSections.size() ; s++ )
         {
             FeaSkin* skin = &m_WingSections[s].m_LowerSkin;
-            for ( int i = 0 ; i < ( int )skin->m_Elements.size() ; i++ )
-            {
-                elem_id++;
-                skin->m_Elements[i]->WriteNASTRAN( fp, elem_id );
-            }
+            WriteFeaElements( fp, skin->m_Elements, elem_id + 1, FEA_NASTRAN_CARDS );
+            elem_id += ( int )skin->m_Elements.size();
         }
         fprintf( fp, "\n" );
         fprintf( fp, "$Gridpoints\n\n" );
 
+        //==== Nodes Shared By More Than One Part ====//
+        vector< FeaNode* > multiTagNodes;
+        for ( int i = 0 ; i < ( int )nodeVec.size() ; i++ )
+        {
+            if ( nodeVec[i]->m_Tags.size() > 1 )
+            {
+                multiTagNodes.push_back( nodeVec[i] );
+            }
+        }
+
         //==== Write Rib Spar Intersections =====//
         for ( int r = 0 ; r < rib_cnt ; r++ )
         {
@@ -1754,18 +1828,15 @@ void FeaMeshMgrSingleton::WriteNASTRAN( const string &filename )
             {
                 FeaNode* upperINode = NULL;
                 FeaNode* lowerINode = NULL;
-                for ( int i = 0 ; i < ( int )nodeVec.size() ; i++ )
+                for ( int i = 0 ; i < ( int )multiTagNodes.size() ; i++ )
                 {
-                    if ( nodeVec[i]->m_Tags.size() > 1 )
+                    if ( multiTagNodes[i]->HasTag( RIB_UPPER, r + 1 ) && multiTagNodes[i]->HasTag( SPAR_UPPER, s + 1 ) )
                     {
-                        if ( nodeVec[i]->HasTag( RIB_UPPER, r + 1 ) && nodeVec[i]->HasTag( SPAR_UPPER, s + 1 ) )
-                        {
-                            upperINode = nodeVec[i];
-                        }
-                        if ( nodeVec[i]->HasTag( RIB_LOWER, r + 1 ) && nodeVec[i]->HasTag( SPAR_LOWER, s + 1 ) )
-                        {
-                            lowerINode = nodeVec[i];
-                        }
+                        upperINode = multiTagNodes[i];
+                    }
+                    if ( multiTagNodes[i]->HasTag( RIB_LOWER, r + 1 ) && multiTagNodes[i]->HasTag( SPAR_LOWER, s + 1 ) )
+                    {
+                        lowerINode = multiTagNodes[i];
                     }
                 }
                 if ( upperINode && lowerINode )
@@ -1781,13 +1852,13 @@ void FeaMeshMgrSingleton::WriteNASTRAN( const string &filename )
         for ( int r = 0 ; r < rib_cnt ; r++ )
         {
             vector< FeaNode* > letenodes;
-            for ( int i = 0 ; i < ( int )nodeVec.size() ; i++ )
+            for ( int i = 0 ; i < ( int )multiTagNodes.size() ; i++ )
             {
-                if ( nodeVec[i]->m_Tags.size() == 2 )
+                if ( multiTagNodes[i]->m_Tags.size() == 2 )
                 {
-                    if ( nodeVec[i]->HasTag( RIB_LOWER, r + 1 ) && nodeVec[i]->HasTag( RIB_UPPER, r + 1 ) )
+                    if ( multiTagNodes[i]->HasTag( RIB_LOWER, r + 1 ) && multiTagNodes[i]->HasTag( RIB_UPPER, r + 1 ) )
                     {
-                        letenodes.push_back( nodeVec[i] );
+                        letenodes.push_back( multiTagNodes[i] );
                     }
                 }
             }
@@ -1814,52 +1885,60 @@ void FeaMeshMgrSingleton::WriteNASTRAN( const string &filename )
         {
             fprintf( fp, "\n" );
             fprintf( fp, "$RibUpperBoundary,%d\n", r + 1 );
+            vector< FeaNode* > boundNodes;
             for ( int i = 0 ; i < ( int )nodeVec.size() ; i++ )
             {
                 if ( nodeVec[i]->HasTag( RIB_UPPER, r + 1 ) && nodeVec[i]->m_Tags.size() == 1 )
                 {
-                    nodeVec[i]->WriteNASTRAN( fp );
+                    boundNodes.push_back( nodeVec[i] );
                 }
             }
+            WriteFeaNodes( fp, boundNodes, FEA_NASTRAN_CARDS );
         }
         //==== Write Spar Upper Boundary =====//
         for ( int s = 0 ; s < spar_cnt ; s++ )
         {
             fprintf( fp, "\n" );
             fprintf( fp, "$SparUpperBoundary,%d\n", s + 1 );
+            vector< FeaNode* > boundNodes;
             for ( int i = 0 ; i < ( int )nodeVec.size() ; i++ )
             {
                 if ( nodeVec[i]->HasTag( SPAR_UPPER, s + 1 ) && nodeVec[i]->m_Tags.size() == 1 )
                 {
-                    nodeVec[i]->WriteNASTRAN( fp );
+                    boundNodes.push_back( nodeVec[i] );
                 }
             }
+            WriteFeaNodes( fp, boundNodes, FEA_NASTRAN_CARDS );
         }
         //==== Write Rib Lower Boundary  =====//
         for ( int r = 0 ; r < rib_cnt ; r++ )
         {
             fprintf( fp, "\n" );
             fprintf( fp, "$RibLowerBoundary,%d\n", r + 1 );
+            vector< FeaNode* > boundNodes;
             for ( int i = 0 ; i < ( int )nodeVec.size() ; i++ )
             {
                 if ( nodeVec[i]->HasTag( RIB_LOWER, r + 1 ) && nodeVec[i]->m_Tags.size() == 1 )
                 {
-                    nodeVec[i]->WriteNASTRAN( fp );
+                    boundNodes.push_back( nodeVec[i] );
                 }
             }
+            WriteFeaNodes( fp, boundNodes, FEA_NASTRAN_CARDS );
         }
         //==== Write Spar Lower Boundary =====//
         for ( int s = 0 ; s < spar_cnt ; s++ )
         {
             fprintf( fp, "\n" );
             fprintf( fp, "$SparLowerBoundary,%d\n", s + 1 );
+            vector< FeaNode* > boundNodes;
             for ( int i = 0 ; i < ( int )nodeVec.size() ; i++ )
             {
                 if ( nodeVec[i]->HasTag( SPAR_LOWER, s + 1 ) && nodeVec[i]->m_Tags.size() == 1 )
                 {
-                    nodeVec[i]->WriteNASTRAN( fp );
+                    boundNodes.push_back( nodeVec[i] );
                 }
             }
+            WriteFeaNodes( fp, boundNodes, FEA_NASTRAN_CARDS );
         }
         //==== Write Point Masses =====//
         for ( int p = 0 ; p < ( int )m_PointMassVec.size() ; p++ )
@@ -1896,13 +1975,15 @@ void FeaMeshMgrSingleton::WriteNASTRAN( const string &filename )
         //==== Remaining Nodes ====//
         fprintf( fp, "\n" );
         fprintf( fp, "$Remainingnodes\n" );
+        vector< FeaNode* > remainNodes;
         for ( int i = 0 ; i < ( int )nodeVec.size() ; i++ )
         {
             if ( pntShift[i] >= 0 && nodeVec[i]->m_Tags.size() == 0 )
             {
-                nodeVec[i]->WriteNASTRAN( fp );
+                remainNodes.push_back( nodeVec[i] );
             }
         }
+        WriteFeaNodes( fp, remainNodes, FEA_NASTRAN_CARDS );
 
         fclose( fp );
     }
@@ -2027,61 +2108,60 @@ void FeaMeshMgrSingleton::WriteCalculix( )
         //==== Upper Skin Nodes ====//
         fprintf( fp, "**%%Upper Skin\n" );
         fprintf( fp, "*NODE, NSET=Nupperskin\n" );
+        vector< FeaNode* > setNodes;
         for ( int i = 0 ; i < ( int )nodeVec.size() ; i++ )
         {
             if ( pntShift[i] >= 0 )
             {
                 if ( nodeVec[i]->HasOnlyType( SKIN_UPPER ) )
                 {
-                    nodeVec[i]->WriteCalculix( fp );
+                    setNodes.push_back( nodeVec[i] );
                 }
                 if ( ( nodeVec[i]->HasTag( SKIN_UPPER ) && nodeVec[i]->HasTag( SKIN_LOWER ) ) &&
                         ( !nodeVec[i]->HasTag( RIB_ALL )    && !nodeVec[i]->HasTag( SPAR_ALL ) ) )
                 {
-                    nodeVec[i]->WriteCalculix( fp );
+                    setNodes.push_back( nodeVec[i] );
                 }
             }
         }
+        WriteFeaNodes( fp, setNodes, FEA_CALCULIX_CARDS );
+
         fprintf( fp, "\n" );
         fprintf( fp, "*ELEMENT, TYPE=S6, ELSET=Eupperskin\n" );
+        vector< FeaElement* > setElems;
         for ( int s = 0 ; s < ( int )upperSkins.size() ; s++ )
         {
-            for ( int e = 0 ; e < ( int )upperSkins[s]->m_Elements.size() ; e++ )
-            {
-                if ( upperSkins[s]->m_Elements[e]->GetType() == FeaElement::FEA_TRI_6 )
-                {
-                    upperSkins[s]->m_Elements[e]->WriteCalculix( fp, elem_id );
-                    elem_id++;
-                }
-            }
+            LoadElementsOfType( upperSkins[s]->m_Elements, FeaElement::FEA_TRI_6, setElems );
         }
+        WriteFeaElements( fp, setElems, elem_id, FEA_CALCULIX_CARDS );
+        elem_id += ( int )setElems.size();
+
         //==== Upper Skin Nodes ====//
         fprintf( fp, "\n" );
         fprintf( fp, "**%%Lower Skin\n" );
         fprintf( fp, "*NODE, NSET=Nlowerskin\n" );
+        setNodes.clear();
         for ( int i = 0 ; i < ( int )nodeVec.size() ; i++ )
         {
             if ( pntShift[i] >= 0 )
             {
                 if ( nodeVec[i]->HasOnlyType( SKIN_LOWER ) )
                 {
-                    nodeVec[i]->WriteCalculix( fp );
+                    setNodes.push_back( nodeVec[i] );
                 }
             }
         }
+        WriteFeaNodes( fp, setNodes, FEA_CALCULIX_CARDS );
+
         fprintf( fp, "\n" );
         fprintf( fp, "*ELEMENT, TYPE=S6, ELSET=Elowerskin\n" );
+        setElems.clear();
         for ( int s = 0 ; s < ( int )lowerSkins.size() ; s++ )
         {
-            for ( int e = 0 ; e < ( int )lowerSkins[s]->m_Elements.size() ; e++ )
-            {
-                if ( lowerSkins[s]->m_Elements[e]->GetType() == FeaElement::FEA_TRI_6 )
-                {
-                    lowerSkins[s]->m_Elements[e]->WriteCalculix( fp, elem_id );
-                    elem_id++;
-                }
-            }
+            LoadElementsOfType( lowerSkins[s]->m_Elements, FeaElement::FEA_TRI_6, setElems );
         }
+        WriteFeaElements( fp, setElems, elem_id, FEA_CALCULIX_CARDS );
+        elem_id += ( int )setElems.size();
 
         //==== Spars ====//
         for ( int s = 0 ; s < ( int )spars.size() ; s++ )
@@ -2090,6 +2170,7 @@ void FeaMeshMgrSingleton::WriteCalculix( )
             fprintf( fp, "**%%Spar %d\n", s );
             fprintf( fp, "*NODE, NSET=Nspar%d\n", s );
 
+            setNodes.clear();
             for ( int i = 0 ; i < ( int )nodeVec.size() ; i++ )
             {
                 if ( pntShift[i] >= 0 && nodeVec[i]->HasTag( SPAR_ALL, s ) )
@@ -2097,31 +2178,25 @@ void FeaMeshMgrSingleton::WriteCalculix( )
                     if ( !nodeVec[i]->HasTag( RIB_ALL ) )
                     {
                         nodeVec[i]->m_Thick = spars[s]->m_Thick();
-                        nodeVec[i]->WriteCalculix( fp );
+                        setNodes.push_back( nodeVec[i] );
                     }
                 }
             }
+            WriteFeaNodes( fp, setNodes, FEA_CALCULIX_CARDS );
 
             fprintf( fp, "\n" );
             fprintf( fp, "*ELEMENT, TYPE=S6, ELSET=Espartri%d\n", s );
-            for ( int e = 0 ; e < ( int )spars[s]->m_Elements.size() ; e++ )
-            {
-                if ( spars[s]->m_Elements[e]->GetType() == FeaElement::FEA_TRI_6 )
-                {
-                    spars[s]->m_Elements[e]->WriteCalculix( fp, elem_id );
-                    elem_id++;
-                }
-            }
+            setElems.clear();
+            LoadElementsOfType( spars[s]->m_Elements, FeaElement::FEA_TRI_6, setElems );
+            WriteFeaElements( fp, setElems, elem_id, FEA_CALCULIX_CARDS );
+            elem_id += ( int )setElems.size();
+
             fprintf( fp, "\n" );
             fprintf( fp, "*ELEMENT, TYPE=S8, ELSET=Esparquad%d\n", s );
-            for ( int e = 0 ; e < ( int )spars[s]->m_Elements.size() ; e++ )
-            {
-                if ( spars[s]->m_Elements[e]->GetType() == FeaElement::FEA_QUAD_8 )
-                {
-                    spars[s]->m_Elements[e]->WriteCalculix( fp, elem_id );
-                    elem_id++;
-                }
-            }
+            setElems.clear();
+            LoadElementsOfType( spars[s]->m_Elements, FeaElement::FEA_QUAD_8, setElems );
+            WriteFeaElements( fp, setElems, elem_id, FEA_CALCULIX_CARDS );
+            elem_id += ( int )setElems.size();
         }
         //==== Ribs ====//
         for ( int r = 0 ; r < ( int )ribs.size() ; r++ )
@@ -2130,6 +2205,7 @@ void FeaMeshMgrSingleton::WriteCalculix( )
             fprintf( fp, "**%%Rib %d\n", r );
             fprintf( fp, "*NODE, NSET=Nrib%d\n", r );
 
+            setNodes.clear();
             for ( int i = 0 ; i < ( int )nodeVec.size() ; i++ )
             {
                 if ( pntShift[i] >= 0 && nodeVec[i]->HasTag( RIB_ALL, r ) )
@@ -2137,31 +2213,25 @@ void FeaMeshMgrSingleton::WriteCalculix( )
                     if ( !nodeVec[i]->HasTag( SPAR_ALL ) )
                     {
                         nodeVec[i]->m_Thick = ribs[r]->m_Thick();
-                        nodeVec[i]->WriteCalculix( fp );
+                        setNodes.push_back( nodeVec[i] );
                     }
                 }
             }
+            WriteFeaNodes( fp, setNodes, FEA_CALCULIX_CARDS );
 
             fprintf( fp, "\n" );
             fprintf( fp, "*ELEMENT, TYPE=S6, ELSET=Eribtri%d\n", r );
-            for ( int e = 0 ; e < ( int )ribs[r]->m_Elements.size() ; e++ )
-            {
-                if ( ribs[r]->m_Elements[e]->GetType() == FeaElement::FEA_TRI_6 )
-                {
-                    ribs[r]->m_Elements[e]->WriteCalculix( fp, elem_id );
-                    elem_id++;
-                }
-            }
+            setElems.clear();
+            LoadElementsOfType( ribs[r]->m_Elements, FeaElement::FEA_TRI_6, setElems );
+            WriteFeaElements( fp, setElems, elem_id, FEA_CALCULIX_CARDS );
+            elem_id += ( int )setElems.size();
+
             fprintf( fp, "\n" );
             fprintf( fp, "*ELEMENT, TYPE=S8, ELSET=Eribquad%d\n", r );
-            for ( int e = 0 ; e < ( int )ribs[r]->m_Elements.size() ; e++ )
-            {
-                if ( ribs[r]->m_Elements[e]->GetType() == FeaElement::FEA_QUAD_8 )
-                {
-                    ribs[r]->m_Elements[e]->WriteCalculix( fp, elem_id );
-                    elem_id++;
-                }
-            }
+            setElems.clear();
+            LoadElementsOfType( ribs[r]->m_Elements, FeaElement::FEA_QUAD_8, setElems );
+            WriteFeaElements( fp, setElems, elem_id, FEA_CALCULIX_CARDS );
+            elem_id += ( int )setElems.size();
         }
 
         //==== Rib Spar Intersections ====//
@@ -2172,6 +2242,7 @@ void FeaMeshMgrSingleton::WriteCalculix( )
                 fprintf( fp, "\n" );
                 fprintf( fp, "**%%Rib-Spar connections %d %d\n", r, s );
                 fprintf( fp, "*NODE, NSET=Nconnections%d%d\n", r, s );
+                setNodes.clear();
                 for ( int i = 0 ; i < ( int )nodeVec.size() ; i++ )
                 {
                     if ( pntShift[i] >= 0 )
@@ -2179,10 +2250,11 @@ void FeaMeshMgrSingleton::WriteCalculix( )
                         if ( nodeVec[i]->HasTag( RIB_ALL, r ) && nodeVec[i]->HasTag( SPAR_ALL, s ) )
                         {
                             nodeVec[i]->m_Thick = 0.5 * ( ribs[r]->m_Thick() + spars[s]->m_Thick() );
-                            nodeVec[i]->WriteCalculix( fp );
+                            setNodes.push_back( nodeVec[i] );
                         }
                     }
                 }
+                WriteFeaNodes( fp, setNodes, FEA_CALCULIX_CARDS );
             }
         }
         fclose( fp );
@@ -168,7 +168,8 @@ public:
     virtual FeaSkin* GetCurrLowerSkin();
     virtual FeaPointMass* GetCurrPointMass();
 
-    virtual FeaNode* FindNode( vector< FeaNode* > nodeVec, int id );
+    virtual void BuildNodeIndex( const vector< FeaNode* > & nodeVec, int numPnts, vector< FeaNode* > & nodeIndex );
+    virtual FeaNode* FindNode( const vector< FeaNode* > & nodeIndex, int id );
 
     virtual void AddRib();
     virtual void DelCurrRib();
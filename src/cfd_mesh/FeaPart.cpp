@@ -17,6 +17,53 @@
 #include "FeaPart.h"
 #include "FeaMeshMgr.h"
 
+#include <stdarg.h>
+
+//==== Number of Chunks Held Per Block ====//
+static const int FEA_CARD_BLOCK = 64;
+
+//==== Append printf Style Formatted Text To String ====//
+static void AppendFormat( string & str, const char* fmt, ... )
+{
+    char buf[256];
+
+    va_list args;
+    va_start( args, fmt );
+    int n = vsnprintf( buf, sizeof( buf ), fmt, args );
+    va_end( args );
+
+    if ( n < 0 )
+    {
+        return;
+    }
+    if ( n < ( int )sizeof( buf ) )
+    {
+        str.append( buf, n );
+        return;
+    }
+
+    //==== Card Longer Than Buffer ====//
+    vector< char > big( n + 1 );
+    va_start( args, fmt );
+    vsnprintf( &big[0], big.size(), fmt, args );
+    va_end( args );
+    str.append( &big[0], n );
+}
+
+//==== NASTRAN Coordinate Format Based On Magnitude ====//
+static const char* NASTRANCoordFormat( double v, bool last )
+{
+    if ( fabs( v ) < 10.0 )
+    {
+        return last ? "%8.5f\n" : "%8.5f,";
+    }
+    else if ( fabs( v ) < 100.0 )
+    {
+        return last ? "%8.4f\n" : "%8.4f,";
+    }
+    return last ? "%8.3f\n" : "%8.3f,";
+}
+
 
 //============================================================================//
 //============================================================================//
@@ -80,56 +127,109 @@ int FeaNode::GetIndex()
 
 void FeaNode::WriteNASTRAN( FILE* fp )
 {
-    fprintf( fp, "GRID,%d,,", m_Index );
+    string str;
+    WriteNASTRAN( str );
+    fputs( str.c_str(), fp );
+}
 
-    double x = m_Pnt.x();
-    double y = m_Pnt.y();
-    double z = m_Pnt.z();
+void FeaNode::WriteCalculix( FILE* fp )
+{
+    string str;
+    WriteCalculix( str );
+    fputs( str.c_str(), fp );
+}
 
-    if ( fabs( x ) < 10.0 )
-    {
-        fprintf( fp, "%8.5f,", x );
-    }
-    else if ( fabs( x ) < 100.0 )
-    {
-        fprintf( fp, "%8.4f,", x );
-    }
-    else
-    {
-        fprintf( fp, "%8.3f,", x );
-    }
+void FeaNode::WriteNASTRAN( string & str )
+{
+    AppendFormat( str, "GRID,%d,,", m_Index );
+    AppendFormat( str, NASTRANCoordFormat( m_Pnt.x(), false ), m_Pnt.x() );
+    AppendFormat( str, NASTRANCoordFormat( m_Pnt.y(), false ), m_Pnt.y() );
+    AppendFormat( str, NASTRANCoordFormat( m_Pnt.z(), true ), m_Pnt.z() );
+}
 
-    if ( fabs( y ) < 10.0 )
-    {
-        fprintf( fp, "%8.5f,", y );
-    }
-    else if ( fabs( y ) < 100.0 )
-    {
-        fprintf( fp, "%8.4f,", y );
-    }
-    else
-    {
-        fprintf( fp, "%8.3f,", y );
-    }
+void FeaNode::WriteCalculix( string & str )
+{
+    AppendFormat( str, "%d,%f,%f,%f\n", m_Index, m_Pnt.x(), m_Pnt.y(), m_Pnt.z() );
+}
 
-    if ( fabs( z ) < 10.0 )
-    {
-        fprintf( fp, "%8.5f\n", z );
-    }
-    else if ( fabs( z ) < 100.0 )
-    {
-        fprintf( fp, "%8.4f\n", z );
-    }
-    else
+//============================================================================//
+//============================================================================//
+void WriteFeaNodes( FILE* fp, const vector< FeaNode* > & node_vec, int format, int chunk_size )
+{
+    int num = ( int )node_vec.size();
+    int num_chunks = ( num + chunk_size - 1 ) / chunk_size;
+    vector< string > chunk_str( min( num_chunks, FEA_CARD_BLOCK ) );
+
+    for ( int b = 0 ; b < num_chunks ; b += FEA_CARD_BLOCK )
     {
-        fprintf( fp, "%8.3f\n", z );
-    }
+        int nc = min( FEA_CARD_BLOCK, num_chunks - b );
 
+        //==== Format Chunks In Parallel ====//
+        #pragma omp parallel for schedule( dynamic )
+        for ( int c = 0 ; c < nc ; c++ )
+        {
+            string & str = chunk_str[c];
+            str.clear();
+            int i0 = ( b + c ) * chunk_size;
+            int i1 = min( i0 + chunk_size, num );
+            for ( int i = i0 ; i < i1 ; i++ )
+            {
+                if ( format == FEA_NASTRAN_CARDS )
+                {
+                    node_vec[i]->WriteNASTRAN( str );
+                }
+                else
+                {
+                    node_vec[i]->WriteCalculix( str );
+                }
+            }
+        }
+
+        //==== Write Chunks In Order ====//
+        for ( int c = 0 ; c < nc ; c++ )
+        {
+            fwrite( chunk_str[c].data(), 1, chunk_str[c].size(), fp );
+        }
+    }
 }
 
-void FeaNode::WriteCalculix( FILE* fp )
+void WriteFeaElements( FILE* fp, const vector< FeaElement* > & elem_vec, int first_id, int format, int chunk_size )
 {
-    fprintf( fp, "%d,%f,%f,%f\n", m_Index, m_Pnt.x(), m_Pnt.y(), m_Pnt.z() );
+    int num = ( int )elem_vec.size();
+    int num_chunks = ( num + chunk_size - 1 ) / chunk_size;
+    vector< string > chunk_str( min( num_chunks, FEA_CARD_BLOCK ) );
+
+    for ( int b = 0 ; b < num_chunks ; b += FEA_CARD_BLOCK )
+    {
+        int nc = min( FEA_CARD_BLOCK, num_chunks - b );
+
+        //==== Format Chunks In Parallel ====//
+        #pragma omp parallel for schedule( dynamic )
+        for ( int c = 0 ; c < nc ; c++ )
+        {
+            string & str = chunk_str[c];
+            str.clear();
+            int i0 = ( b + c ) * chunk_size;
+            int i1 = min( i0 + chunk_size, num );
+            for ( int i = i0 ; i < i1 ; i++ )
+            {
+                if ( format == FEA_NASTRAN_CARDS )
+                {
+                    elem_vec[i]->WriteNASTRAN( str, first_id + i );
+                }
+                else
+                {
+                    elem_vec[i]->WriteCalculix( str, first_id + i );
+                }
+            }
+        }
+
+        //==== Write Chunks In Order ====//
+        for ( int c = 0 ; c < nc ; c++ )
+        {
+            fwrite( chunk_str[c].data(), 1, chunk_str[c].size(), fp );
+        }
+    }
 }
 
 
@@ -192,16 +292,30 @@ void FeaTri::Create( vec3d & p0, vec3d & p1, vec3d & p2 )
 
 void FeaTri::WriteCalculix( FILE* fp, int id )
 {
-    fprintf( fp, "%d,%d,%d,%d,%d,%d,%d\n", id,
-             m_Corners[0]->GetIndex(), m_Corners[1]->GetIndex(), m_Corners[2]->GetIndex(),
-             m_Mids[0]->GetIndex(), m_Mids[1]->GetIndex(), m_Mids[2]->GetIndex() );
+    string str;
+    WriteCalculix( str, id );
+    fputs( str.c_str(), fp );
 }
 
 void FeaTri::WriteNASTRAN( FILE* fp, int id )
 {
-    fprintf( fp, "CTRIA6,%d,1,%d,%d,%d,%d,%d,%d\n", id,
-             m_Corners[0]->GetIndex(), m_Corners[1]->GetIndex(), m_Corners[2]->GetIndex(),
-             m_Mids[0]->GetIndex(),    m_Mids[1]->GetIndex(),    m_Mids[2]->GetIndex() );
+    string str;
+    WriteNASTRAN( str, id );
+    fputs( str.c_str(), fp );
+}
+
+void FeaTri::WriteCalculix( string & str, int id )
+{
+    AppendFormat( str, "%d,%d,%d,%d,%d,%d,%d\n", id,
+                  m_Corners[0]->GetIndex(), m_Corners[1]->GetIndex(), m_Corners[2]->GetIndex(),
+                  m_Mids[0]->GetIndex(), m_Mids[1]->GetIndex(), m_Mids[2]->GetIndex() );
+}
+
+void FeaTri::WriteNASTRAN( string & str, int id )
+{
+    AppendFormat( str, "CTRIA6,%d,1,%d,%d,%d,%d,%d,%d\n", id,
+                  m_Corners[0]->GetIndex(), m_Corners[1]->GetIndex(), m_Corners[2]->GetIndex(),
+                  m_Mids[0]->GetIndex(),    m_Mids[1]->GetIndex(),    m_Mids[2]->GetIndex() );
 }
 
 double FeaTri::ComputeMass( double density )
@@ -243,15 +357,29 @@ void FeaQuad::Create( vec3d & p0, vec3d & p1, vec3d & p2, vec3d & p3 )
 
 void FeaQuad::WriteCalculix( FILE* fp, int id )
 {
-    fprintf( fp, "%d,%d,%d,%d,%d,%d,%d,%d,%d\n", id,
-             m_Corners[0]->GetIndex(), m_Corners[1]->GetIndex(), m_Corners[2]->GetIndex(), m_Corners[3]->GetIndex(),
-             m_Mids[0]->GetIndex(), m_Mids[1]->GetIndex(), m_Mids[2]->GetIndex(), m_Mids[3]->GetIndex() );
+    string str;
+    WriteCalculix( str, id );
+    fputs( str.c_str(), fp );
 }
 void FeaQuad::WriteNASTRAN( FILE* fp, int id )
 {
-    fprintf( fp, "CQUAD8,%d,1,%d,%d,%d,%d,%d,%d,+\n+,%d,%d\n", id,
-             m_Corners[0]->GetIndex(), m_Corners[1]->GetIndex(), m_Corners[2]->GetIndex(), m_Corners[3]->GetIndex(),
-             m_Mids[0]->GetIndex(),    m_Mids[1]->GetIndex(),    m_Mids[2]->GetIndex(), m_Mids[3]->GetIndex() );
+    string str;
+    WriteNASTRAN( str, id );
+    fputs( str.c_str(), fp );
+}
+
+void FeaQuad::WriteCalculix( string & str, int id )
+{
+    AppendFormat( str, "%d,%d,%d,%d,%d,%d,%d,%d,%d\n", id,
+                  m_Corners[0]->GetIndex(), m_Corners[1]->GetIndex(), m_Corners[2]->GetIndex(), m_Corners[3]->GetIndex(),
+                  m_Mids[0]->GetIndex(), m_Mids[1]->GetIndex(), m_Mids[2]->GetIndex(), m_Mids[3]->GetIndex() );
+}
+
+void FeaQuad::WriteNASTRAN( string & str, int id )
+{
+    AppendFormat( str, "CQUAD8,%d,1,%d,%d,%d,%d,%d,%d,+\n+,%d,%d\n", id,
+                  m_Corners[0]->GetIndex(), m_Corners[1]->GetIndex(), m_Corners[2]->GetIndex(), m_Corners[3]->GetIndex(),
+                  m_Mids[0]->GetIndex(),    m_Mids[1]->GetIndex(),    m_Mids[2]->GetIndex(), m_Mids[3]->GetIndex() );
 }
 
 double FeaQuad::ComputeMass( double density )
@@ -848,9 +976,15 @@ void FeaSlice::SetLowerCapSurfs( Surf* s0, Surf* s1 )
 
 void FeaSlice::FindUpperLowerPoints()
 {
-    int num_sections = FeaMeshMgr.GetNumSections();
     list< ISegChain* > upper_chain_list;
     list< ISegChain* > lower_chain_list;
+    LoadUpperLowerChains( upper_chain_list, lower_chain_list );
+    FindUpperLowerPoints( upper_chain_list, lower_chain_list );
+}
+
+void FeaSlice::LoadUpperLowerChains( list< ISegChain* > & upper_chain_list, list< ISegChain* > & lower_chain_list )
+{
+    int num_sections = FeaMeshMgr.GetNumSections();
     if ( IsCap() )
     {
         if ( m_CapUpperSurf[0] != m_CapUpperSurf[1] )   // On Boundry of Two Surfaces
@@ -877,7 +1011,10 @@ void FeaSlice::FindUpperLowerPoints()
             FeaMeshMgr.LoadChains( m_Surf, false, i, lower_chain_list );
         }
     }
+}
 
+void FeaSlice::FindUpperLowerPoints( list< ISegChain* > & upper_chain_list, list< ISegChain* > & lower_chain_list )
+{
     vector< vec3d > upper_pnts;
     MergeChains( upper_chain_list, m_UpperStartChainPnt, upper_pnts );
 
@@ -1188,7 +1325,11 @@ void FeaSlice::SnapUpperLowerToSkin(  vector < FeaNode* > & skinNodes )
     {
         skin_pnts.push_back( skinNodes[i]->m_Pnt );
     }
+    SnapUpperLowerToSkin( skin_pnts );
+}
 
+void FeaSlice::SnapUpperLowerToSkin(  vector < vec3d > & skin_pnts )
+{
     for ( int i = 0 ; i < ( int )m_UpperPnts.size() ; i++ )
     {
         int id = FindClosestPnt( m_UpperPnts[i], skin_pnts );
@@ -22,6 +22,7 @@
 #include "ISegChain.h"
 
 #include <vector>
+#include <string>
 #include <algorithm>
 using namespace std;
 
@@ -69,6 +70,10 @@ public:
     void WriteNASTRAN( FILE* fp );
     void WriteCalculix( FILE* fp );
 
+    //==== Append Card To String Buffer ====//
+    void WriteNASTRAN( string & str );
+    void WriteCalculix( string & str );
+
 };
 
 
@@ -87,6 +92,8 @@ public:
     }
     virtual void WriteCalculix( FILE* fp, int id ) = 0;
     virtual void WriteNASTRAN( FILE* fp, int id ) = 0;
+    virtual void WriteCalculix( string & str, int id ) = 0;
+    virtual void WriteNASTRAN( string & str, int id ) = 0;
     virtual double ComputeMass( double density ) = 0;
 //  virtual void DrawPoly();
 
@@ -107,6 +114,8 @@ public:
     virtual void Create( vec3d & p0, vec3d & p1, vec3d & p2 );
     virtual void WriteCalculix( FILE* fp, int id );
     virtual void WriteNASTRAN( FILE* fp, int id );
+    virtual void WriteCalculix( string & str, int id );
+    virtual void WriteNASTRAN( string & str, int id );
     virtual double ComputeMass( double density );
 };
 
@@ -119,9 +128,19 @@ public:
     virtual void Create( vec3d & p0, vec3d & p1, vec3d & p2, vec3d & p3 );
     virtual void WriteCalculix( FILE* fp, int id );
     virtual void WriteNASTRAN( FILE* fp, int id );
+    virtual void WriteCalculix( string & str, int id );
+    virtual void WriteNASTRAN( string & str, int id );
     virtual double ComputeMass( double density );
 };
 
+//==== Buffered Card Writers ====//
+// Cards are formatted into string chunks of chunk_size cards on multiple threads
+// and the chunks are written to fp in order, so the output matches the serial writers.
+enum { FEA_NASTRAN_CARDS, FEA_CALCULIX_CARDS };
+
+void WriteFeaNodes( FILE* fp, const vector< FeaNode* > & node_vec, int format, int chunk_size = 4096 );
+void WriteFeaElements( FILE* fp, const vector< FeaElement* > & elem_vec, int first_id, int format, int chunk_size = 4096 );
+
 class FeaSplice
 {
 public:
@@ -319,6 +338,10 @@ public:
     }
 
     virtual void FindUpperLowerPoints();
+
+    //==== Chain Loading Reads FeaMeshMgr, Point Finding Only Touches This Slice ====//
+    virtual void LoadUpperLowerChains( list< ISegChain* > & upper_chain_list, list< ISegChain* > & lower_chain_list );
+    virtual void FindUpperLowerPoints( list< ISegChain* > & upper_chain_list, list< ISegChain* > & lower_chain_list );
     virtual int  ComputeNumDivisions();
     virtual void SetNumDivisions( int n )
     {
@@ -346,6 +369,7 @@ public:
 //  virtual void DrawSlicePlane();
 
     virtual void SnapUpperLowerToSkin( vector < FeaNode* > & skinNodes );
+    virtual void SnapUpperLowerToSkin( vector < vec3d > & skin_pnts );
 
     Parm m_Thick;
 
@@ -9,6 +9,9 @@
 
 #include "ICurve.h"
 #include "SCurve.h"
+#include "ISegChain.h"
+
+#include <algorithm>
 
 //////////////////////////////////////////////////////////////////////
 ICurve::ICurve()
@@ -23,7 +26,7 @@ ICurve::~ICurve()
 
 bool ICurve::Match( SCurve* crv_A, SCurve* crv_B )
 {
-    double tol = 1.0e-5;
+    double tol = GetMatchTol();
 
     Bezier_curve xyzcrvA = crv_A->GetUWCrv();
     xyzcrvA.UWCurveToXYZCurve( crv_A->GetSurf() );
@@ -112,3 +115,148 @@ void ICurve::DebugEdgeMatching( FILE* fp )
 
 }
 
+//////////////////////////////////////////////////////////////////////
+//==== SCurve Match Hash ====//
+//////////////////////////////////////////////////////////////////////
+SCurveMatchHash::MatchKey SCurveMatchHash::ComputeKey( SCurve* crv )
+{
+    Bezier_curve xyzcrv = crv->GetUWCrv();
+    xyzcrv.UWCurveToXYZCurve( crv->GetSurf() );
+
+    MatchKey key;
+    key.m_Pnt0 = xyzcrv.FirstPnt();
+    key.m_Pnt1 = xyzcrv.LastPnt();
+    key.m_NumSect = xyzcrv.GetNumSections();
+
+    piecewise_curve_type pwc = xyzcrv.GetCurve();
+    int ncp = 0;
+    for ( int i = 0 ; i < key.m_NumSect ; i++ )
+    {
+        curve_segment_type c;
+        pwc.get( c, i );
+        for ( int j = 0 ; j <= c.degree() ; j++ )
+        {
+            curve_point_type cp = c.get_control_point( j );
+            key.m_Mid = key.m_Mid + vec3d( cp.x(), cp.y(), cp.z() );
+            ncp++;
+        }
+    }
+    if ( ncp > 0 )
+    {
+        key.m_Mid = key.m_Mid / ( double )ncp;
+    }
+
+    return key;
+}
+
+bool SCurveMatchHash::CanMatch( const MatchKey & a, const MatchKey & b )
+{
+    // Small slack so rounding never rejects a pair Match would accept
+    double tol = ICurve::GetMatchTol() * 1.001;
+
+    if ( a.m_NumSect != b.m_NumSect || dist( a.m_Mid, b.m_Mid ) > tol )
+    {
+        return false;
+    }
+
+    bool fwd = dist( a.m_Pnt0, b.m_Pnt0 ) <= tol && dist( a.m_Pnt1, b.m_Pnt1 ) <= tol;
+    bool bkwd = dist( a.m_Pnt0, b.m_Pnt1 ) <= tol && dist( a.m_Pnt1, b.m_Pnt0 ) <= tol;
+
+    return fwd || bkwd;
+}
+
+void SCurveMatchHash::Build( vector< SCurve* > & scurve_vec )
+{
+    m_KeyVec.resize( scurve_vec.size() );
+    m_CellMap.clear();
+
+    for ( int i = 0 ; i < ( int )scurve_vec.size() ; i++ )
+    {
+        m_KeyVec[i] = ComputeKey( scurve_vec[i] );
+
+        // Cells are 1.0e-4, far larger than the match tolerance
+        int ix, iy, iz;
+        IPntGrid::ComputeCell( m_KeyVec[i].m_Pnt0, ix, iy, iz );
+        m_CellMap[ IPntGrid::ComputeKey( ix, iy, iz ) ].push_back( i );
+    }
+}
+
+void SCurveMatchHash::FindCandidates( SCurve* crv, vector< int > & cand_vec )
+{
+    FindCandidates( ComputeKey( crv ), cand_vec );
+}
+
+void SCurveMatchHash::FindCandidates( int ind, vector< int > & cand_vec )
+{
+    FindCandidates( m_KeyVec[ind], cand_vec );
+}
+
+void SCurveMatchHash::FindCandidates( const MatchKey & key, vector< int > & cand_vec )
+{
+    cand_vec.clear();
+
+    // A partner's first end point lies near one of this curve's end points
+    for ( int e = 0 ; e < 2 ; e++ )
+    {
+        int ix, iy, iz;
+        IPntGrid::ComputeCell( e == 0 ? key.m_Pnt0 : key.m_Pnt1, ix, iy, iz );
+
+        for ( int i = -1 ; i <= 1 ; i++ )
+        {
+            for ( int j = -1 ; j <= 1 ; j++ )
+            {
+                for ( int k = -1 ; k <= 1 ; k++ )
+                {
+                    unordered_map< long long, vector< int > >::const_iterator iter;
+                    iter = m_CellMap.find( IPntGrid::ComputeKey( ix + i, iy + j, iz + k ) );
+                    if ( iter == m_CellMap.end() )
+                    {
+                        continue;
+                    }
+
+                    for ( int c = 0 ; c < ( int )iter->second.size() ; c++ )
+                    {
+                        if ( CanMatch( key, m_KeyVec[ iter->second[c] ] ) )
+                        {
+                            cand_vec.push_back( iter->second[c] );
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    std::sort( cand_vec.begin(), cand_vec.end() );
+    cand_vec.erase( std::unique( cand_vec.begin(), cand_vec.end() ), cand_vec.end() );
+}
+
+void MatchSCurvePairs( vector< SCurve* > & scurve_vec, vector< ICurve* > & icurve_vec )
+{
+    SCurveMatchHash match_hash;
+    match_hash.Build( scurve_vec );
+
+    vector< int > cand_vec;
+    for ( int i = 0 ; i < ( int )scurve_vec.size() ; i++ )
+    {
+        match_hash.FindCandidates( i, cand_vec );
+
+        for ( int k = 0 ; k < ( int )cand_vec.size() ; k++ )
+        {
+            int j = cand_vec[k];
+            if ( j <= i )
+            {
+                continue;
+            }
+
+            ICurve* icrv = new ICurve;
+            if ( icrv->Match( scurve_vec[i], scurve_vec[j] ) )
+            {
+                icurve_vec.push_back( icrv );
+            }
+            else
+            {
+                delete icrv;
+            }
+        }
+    }
+}
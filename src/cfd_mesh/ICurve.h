@@ -24,6 +24,7 @@
 #include <vector>
 #include <deque>
 #include <list>
+#include <unordered_map>
 using namespace std;
 
 class ISegChain;
@@ -40,6 +41,10 @@ public:
     virtual ~ICurve();
 
     bool Match( SCurve* crv_A, SCurve* crv_B );
+    static double GetMatchTol()
+    {
+        return 1.0e-5;
+    }
     void BorderTesselate( );
     void PlaneBorderTesselate( SCurve* sca, SCurve* scb );
     void SetACurve( SCurve* crv_A )
@@ -64,5 +69,40 @@ protected:
 
 };
 
+//==== Hash Of SCurve XYZ End Points - Candidate Partners For ICurve::Match ====//
+class SCurveMatchHash
+{
+public:
+
+    void Build( vector< SCurve* > & scurve_vec );
+
+    // Sorted indices into the built vector of curves that can pass ICurve::Match with crv
+    void FindCandidates( SCurve* crv, vector< int > & cand_vec );
+    void FindCandidates( int ind, vector< int > & cand_vec );       // Curve ind of the built vector
+
+protected:
+
+    // Every control point must match within tol, so end points, section count and
+    // control point centroid are necessary conditions in either direction
+    struct MatchKey
+    {
+        vec3d m_Pnt0;
+        vec3d m_Pnt1;
+        vec3d m_Mid;
+        int m_NumSect;
+    };
+
+    static MatchKey ComputeKey( SCurve* crv );
+    static bool CanMatch( const MatchKey & a, const MatchKey & b );
+    void FindCandidates( const MatchKey & key, vector< int > & cand_vec );
+
+    vector< MatchKey > m_KeyVec;
+    unordered_map< long long, vector< int > > m_CellMap;        // Cell Of First End Point -> Curves
+
+};
+
+// Match every pair i < j in index order like the all pairs loop, appending the matches
+void MatchSCurvePairs( vector< SCurve* > & scurve_vec, vector< ICurve* > & icurve_vec );
+
 
 #endif
@@ -31,33 +31,115 @@ Puw::~Puw()
 //////////////////////////////////////////////////////////////////////
 //==== IPnt Bin ====//
 //////////////////////////////////////////////////////////////////////
-int IPntBin::ComputeID( vec3d & pos )
+//==== 1.0e-4 Cells, 21 Bits Per Axis - Wrapped Cells Only Share A Bin, Match Still Checks Distance ====//
+void IPntGrid::ComputeCell( const vec3d & pos, int & ix, int & iy, int & iz )
 {
-    int id =    ( int )( pos.x() * 10000.0 ) +
-                ( int )( pos.y() * 10000.0 ) +
-                ( int )( pos.z() * 10000.0 );
+    ix = ( int )floor( pos.x() * 10000.0 );
+    iy = ( int )floor( pos.y() * 10000.0 );
+    iz = ( int )floor( pos.z() * 10000.0 );
+}
+
+long long IPntGrid::ComputeKey( int ix, int iy, int iz )
+{
+    const long long mask = ( 1LL << 21 ) - 1;
+    return ( ( ( long long )ix & mask ) << 42 ) | ( ( ( long long )iy & mask ) << 21 ) | ( ( long long )iz & mask );
+}
+
+IPntGrid::IPntGrid()
+{
+    m_NumCompares = 0;
+}
+
+void IPntGrid::Clear()
+{
+    m_BinVec.clear();
+    m_SlotKeys.clear();
+    m_SlotBins.clear();
+    m_NumCompares = 0;
+}
+
+//==== Slot Holding Key Or The Empty Slot Where It Belongs ====//
+int IPntGrid::FindSlot( long long key )
+{
+    unsigned long long h = ( unsigned long long )key * 0x9E3779B97F4A7C15ULL;
+    int mask = ( int )m_SlotKeys.size() - 1;
+    int slot = ( int )( h >> 40 ) & mask;
+
+    while ( m_SlotBins[slot] >= 0 && m_SlotKeys[slot] != key )
+    {
+        slot = ( slot + 1 ) & mask;
+    }
+    return slot;
+}
+
+void IPntGrid::Grow()
+{
+    int nslot = max( 1024, 2 * ( int )m_SlotKeys.size() );
+    m_SlotKeys.assign( nslot, 0 );
+    m_SlotBins.assign( nslot, -1 );
+
+    for ( int i = 0 ; i < ( int )m_BinVec.size() ; i++ )
+    {
+        int slot = FindSlot( m_BinVec[i].m_Key );
+        m_SlotKeys[slot] = m_BinVec[i].m_Key;
+        m_SlotBins[slot] = i;
+    }
+}
+
+void IPntGrid::Add( IPnt* ip )
+{
+    // Keep Load Under One Half
+    if ( 2 * ( m_BinVec.size() + 1 ) > m_SlotKeys.size() )
+    {
+        Grow();
+    }
+
+    int ix, iy, iz;
+    ComputeCell( ip->m_Pnt, ix, iy, iz );
+    long long key = ComputeKey( ix, iy, iz );
 
-    return id;
+    int slot = FindSlot( key );
+    if ( m_SlotBins[slot] < 0 )
+    {
+        m_SlotKeys[slot] = key;
+        m_SlotBins[slot] = ( int )m_BinVec.size();
+        m_BinVec.push_back( IPntBin() );
+        m_BinVec.back().m_Key = key;
+    }
+    m_BinVec[ m_SlotBins[slot] ].m_IPnts.push_back( ip );
 }
 
-IPnt* IPntBin::Match( IPnt* ip, map< int, IPntBin > & binMap )
+IPnt* IPntGrid::Match( IPnt* ip )
 {
     IPnt* close_ipnt = NULL;
 
-    if ( ip->m_Puws.size() != 2 )
+    if ( ip->m_Puws.size() != 2 || m_BinVec.empty() )
     {
         return close_ipnt;
     }
 
-    vector< IPnt* > compareIPntVec;
-    AddCompareIPnts( ip, compareIPntVec );                  // Load IPnts From This Bin
+    //==== Load IPnts From This And Adjacent Cells ====//
+    int ix, iy, iz;
+    ComputeCell( ip->m_Pnt, ix, iy, iz );
 
-    for ( int b = 0 ; b < ( int )m_AdjBins.size() ; b++ )   // Load From Adjancent Bins
+    vector< IPnt* > compareIPntVec;
+    for ( int i = -1 ; i <= 1 ; i++ )
     {
-        int id = m_AdjBins[b];
-        binMap[id].AddCompareIPnts( ip, compareIPntVec );
+        for ( int j = -1 ; j <= 1 ; j++ )
+        {
+            for ( int k = -1 ; k <= 1 ; k++ )
+            {
+                int slot = FindSlot( ComputeKey( ix + i, iy + j, iz + k ) );
+                if ( m_SlotBins[slot] >= 0 )
+                {
+                    m_BinVec[ m_SlotBins[slot] ].AddCompareIPnts( ip, compareIPntVec );
+                }
+            }
+        }
     }
 
+    m_NumCompares += compareIPntVec.size();
+
     //==== Find Closest IPnt ====//
     double tol = 1.0e-6 * 1.0e-6;
     double close_d = 1.0e12;
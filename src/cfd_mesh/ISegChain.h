@@ -73,19 +73,50 @@ public:
 class IPntBin
 {
 public:
-    int m_ID;                           // x*1000 + y*1000 + z*1000
+    long long m_Key;                    // Packed x, y, z cell indices
 
     deque< IPnt* > m_IPnts;
-    vector< int > m_AdjBins;            // Adjancent Bins
 
-    deque< ISegChain* > m_Chains;
-
-    IPnt* Match( IPnt* ip, map< int, IPntBin > & binMap );
     void AddCompareIPnts( IPnt* ip, vector< IPnt* > & compareIPntVec );
+};
+
+//==== 3D Hash Grid Of IPnt Bins ====//
+class IPntGrid
+{
+public:
+    IPntGrid();
+
+    void Clear();
+    void Add( IPnt* ip );
+    IPnt* Match( IPnt* ip );            // Closest Unused IPnt On Same Surf Pair In 27 Surrounding Cells
+
+    int GetNumBins()
+    {
+        return ( int )m_BinVec.size();
+    }
+    IPntBin & GetBin( int i )
+    {
+        return m_BinVec[i];
+    }
+
+    long long GetNumCompares()
+    {
+        return m_NumCompares;
+    }
+
+    static long long ComputeKey( int ix, int iy, int iz );
+    static void ComputeCell( const vec3d & pos, int & ix, int & iy, int & iz );
+
+protected:
 
-    static int ComputeID( vec3d & pos );
+    int FindSlot( long long key );
+    void Grow();
 
+    vector< IPntBin > m_BinVec;         // Bins In Order Of Creation
+    vector< long long > m_SlotKeys;     // Open Addressing Table, Power Of Two Size
+    vector< int > m_SlotBins;           // -1 Empty
 
+    long long m_NumCompares;
 };
 
 //==== Intersection Segment ====//
@@ -43,8 +43,6 @@ struct MapSource
 {
     MapSource()
     {
-        m_dominated = false;
-        m_maxvisited = -1;
         m_surfid = -1;
     };
 
@@ -52,15 +50,11 @@ struct MapSource
     {
         m_pt = pt;
         m_str = str;
-        m_dominated = false;
-        m_maxvisited = -1;
         m_surfid = surfid;
     };
 
     vec3d m_pt;
     double m_str;
-    bool m_dominated;
-    int m_maxvisited;
     int m_surfid;
 };
 
@@ -32,6 +32,7 @@ Surf::Surf()
     m_WakeParentSurfID = -1;
     m_Mesh.SetSurfPtr( this );
     m_NumMap = 10;
+    m_WalkPeakStack = 0;
     m_BaseTag = 1;
     m_MainSurfID = 0;
 }
@@ -134,6 +135,8 @@ void Surf::BuildTargetMap( vector< MapSource* > &sources, int sid )
     int nmapu = npatchu * ( m_NumMap - 1 ) + 1;
     int nmapw = npatchw * ( m_NumMap - 1 ) + 1;
 
+    m_WalkPeakStack = 0;
+
     double umin = m_SurfCore.GetMinU();
     double du = m_SurfCore.GetMaxU() - umin;
     double wmin = m_SurfCore.GetMinW();
@@ -204,67 +207,80 @@ void Surf::SetSymPlaneFlag( bool flag )
 }
 
 
-bool indxcompare( const pair < double, pair < int, int > > &a, const pair < double, pair < int, int > > &b )
+//==== Growth Limit Target Map From Seed Cells ====//
+// Each seed floods outward while it still lowers the map.  An explicit stack replaces
+// recursion so deep walks on fine maps can not overflow the call stack.
+void Surf::WalkMap( const vector< int > &seeds )
 {
-    return ( a.first < b.first );
-}
-
-void Surf::WalkMap( int istart, int jstart, int kstart, int icurrent, int jcurrent )
-{
-    static int iadd[] = { -1, 1,  0, 0 };
-    static int jadd[] = {  0, 0, -1, 1 };
+    static const int iadd[] = { -1, 1,  0, 0 };
+    static const int jadd[] = {  0, 0, -1, 1 };
 
-    for( int i = 0; i < 4; i++ )
-    {
-        static int itarget;
-        itarget = icurrent + iadd[i];
-        static int jtarget;
-        jtarget = jcurrent + jadd[i];
+    int nmapu = m_SrcMap.size();
+    int nmapw = m_SrcMap[0].size();
 
-        if( itarget < m_SrcMap.size() && itarget >= 0 && jtarget < m_SrcMap[0].size() && jtarget >= 0 )
-        {
+    double grm1 = m_GridDensityPtr->m_GrowRatio() - 1.0;
 
-            if( m_SrcMap[ itarget ][ jtarget ].m_maxvisited < kstart )
-            {
-                m_SrcMap[ itarget ][ jtarget ].m_maxvisited = kstart;
-                static double targetstr;
-                targetstr = m_SrcMap[ istart ][ jstart ].m_str +
-                          ( m_SrcMap[ itarget ][ jtarget ].m_pt - m_SrcMap[ istart ][ jstart ].m_pt ).mag() *
-                          ( m_GridDensityPtr->m_GrowRatio() - 1.0 );
-                if( m_SrcMap[ itarget ][ jtarget ].m_str > targetstr )
-                {
-                    // Mark dominated as progress is made
-                    m_SrcMap[ itarget ][ jtarget ].m_dominated = true;
-                    m_SrcMap[ itarget ][ jtarget ].m_str = targetstr;
-                    WalkMap( istart, jstart, kstart, itarget, jtarget );
-                }
-            }
-        }
+    // Walk from smallest to largest seed
+    vector< pair < double, int > > index( seeds.size() );
+    for ( int k = 0; k < ( int )seeds.size(); k++ )
+    {
+        int c = seeds[k];
+        index[k] = pair < double, int >( m_SrcMap[ c / nmapw ][ c % nmapw ].m_str, c );
     }
-}
+    std::sort( index.begin(), index.end() );
 
-void Surf::WalkMap( int istart, int jstart, int icurrent, int jcurrent )
-{
-    static const int iadd[] = { -1, 1,  0, 0 };
-    static const int jadd[] = {  0, 0, -1, 1 };
+    // Traversal state lives here, not in the map, so Surfs can be walked concurrently
+    vector< int > visited( nmapu * nmapw, -1 );
+    vector< bool > dominated( nmapu * nmapw, false );
+    vector< int > stack;
 
-    for( int i = 0; i < 4; i++ )
+    for ( int k = 0; k < ( int )index.size(); k++ )
     {
-        static int itarget;
-        itarget = icurrent + iadd[i];
-        static int jtarget;
-        jtarget = jcurrent + jadd[i];
+        int start = index[k].second;
 
-        if( itarget < m_SrcMap.size() && itarget >= 0 && jtarget < m_SrcMap[0].size() && jtarget >= 0 )
+        // Skip if dominated by an earlier walk
+        if ( dominated[ start ] )
         {
-            static double targetstr;
-            targetstr = m_SrcMap[istart][jstart].m_str +
-                    ( m_SrcMap[ itarget ][ jtarget ].m_pt - m_SrcMap[istart][jstart].m_pt ).mag() *
-                    (m_GridDensityPtr->m_GrowRatio() - 1.0);
-            if( m_SrcMap[ itarget ][ jtarget ].m_str > targetstr )
+            continue;
+        }
+
+        const MapSource &src = m_SrcMap[ start / nmapw ][ start % nmapw ];
+
+        stack.push_back( start );
+        while ( !stack.empty() )
+        {
+            m_WalkPeakStack = max( m_WalkPeakStack, ( int )stack.size() );
+
+            int c = stack.back();
+            stack.pop_back();
+
+            int icurrent = c / nmapw;
+            int jcurrent = c % nmapw;
+
+            for ( int n = 0; n < 4; n++ )
             {
-                m_SrcMap[ itarget ][ jtarget ].m_str = targetstr;
-                WalkMap( istart, jstart, itarget, jtarget );
+                int itarget = icurrent + iadd[n];
+                int jtarget = jcurrent + jadd[n];
+
+                if ( itarget < nmapu && itarget >= 0 && jtarget < nmapw && jtarget >= 0 )
+                {
+                    int t = itarget * nmapw + jtarget;
+
+                    if ( visited[t] < k )
+                    {
+                        visited[t] = k;
+
+                        MapSource &target = m_SrcMap[ itarget ][ jtarget ];
+                        double targetstr = src.m_str + ( target.m_pt - src.m_pt ).mag() * grm1;
+                        if ( target.m_str > targetstr )
+                        {
+                            // Mark dominated as progress is made
+                            dominated[t] = true;
+                            target.m_str = targetstr;
+                            stack.push_back( t );
+                        }
+                    }
+                }
             }
         }
     }
@@ -272,46 +288,16 @@ void Surf::WalkMap( int istart, int jstart, int icurrent, int jcurrent )
 
 void Surf::LimitTargetMap()
 {
-    int nmapu = m_SrcMap.size();
-    int nmapw = m_SrcMap[0].size();
-
-    int nmap = nmapu * nmapw;
+    int nmap = m_SrcMap.size() * m_SrcMap[0].size();
 
-    // Create size sortable index of array i,j coordinates
-    vector< pair < double, pair < int, int > > > index;
-    index.resize( nmap );
-
-    int k = 0;
-    for( int i = 0; i < nmapu ; i++ )
+    // Every cell is a seed, the smallest strengths are walked first
+    vector< int > seeds( nmap );
+    for ( int k = 0; k < nmap; k++ )
     {
-        for( int j = 0; j < nmapw ; j++ )
-        {
-            pair< int, int > ij( i, j );
-            pair < double, pair < int, int > > id( m_SrcMap[i][j].m_str, ij );
-            index[k] = id;
-            k++;
-            m_SrcMap[i][j].m_maxvisited = -1;  // Reset traversal limiter.
-        }
+        seeds[k] = k;
     }
 
-    // Sort index
-    std::sort( index.begin(), index.end(), indxcompare );
-
-    // Start from smallest
-    for( int k = 0; k < nmap; k++ )
-    {
-        pair< int, int > ij = index[k].second;
-        int i = ij.first;
-        int j = ij.second;
-
-        MapSource src = m_SrcMap[i][j];
-
-        // Recursively limit from small to large (skip if dominated)
-        if( !src.m_dominated )
-        {
-            WalkMap( i, j, k, i, j );
-        }
-    }
+    WalkMap( seeds );
 }
 
 void Surf::LimitTargetMap( MSCloud &es_cloud, MSTree &es_tree, double minmap )
@@ -326,14 +312,13 @@ void Surf::LimitTargetMap( MSCloud &es_cloud, MSTree &es_tree, double minmap )
     int nmapu = m_SrcMap.size();
     int nmapw = m_SrcMap[0].size();
 
+    vector< int > seeds;
+
     // Loop over surface evaluating source strength and curvature
     for( int i = 0; i < nmapu ; i++ )
     {
-//      double u = ( 1.0 * i ) / ( m_NumMap - 1 );
         for( int j = 0; j < nmapw ; j++ )
         {
-//          double w = ( 1.0 * j ) / ( m_NumMap - 1 );
-
             double *query_pt = m_SrcMap[i][j].m_pt.v;
 
             double t = m_SrcMap[i][j].m_str;
@@ -351,6 +336,13 @@ void Surf::LimitTargetMap( MSCloud &es_cloud, MSTree &es_tree, double minmap )
                 for ( int k = 0; k < nMatches; k++ )
                 {
                     int imatch = es_matches[k].first;
+
+                    // Shared tree holds every surface, only other surfaces limit this one
+                    if ( es_cloud.sources[imatch]->m_surfid == m_SrcMap[i][j].m_surfid )
+                    {
+                        continue;
+                    }
+
                     double r = sqrt( es_matches[k].second );
 
                     double str = es_cloud.sources[imatch]->m_str;
@@ -361,11 +353,13 @@ void Surf::LimitTargetMap( MSCloud &es_cloud, MSTree &es_tree, double minmap )
                 if( t < torig )
                 {
                     m_SrcMap[i][j].m_str = t;
-                    WalkMap( i, j, i, j );
+                    seeds.push_back( i * nmapw + j );
                 }
             }
         }
     }
+
+    WalkMap( seeds );
 }
 
 double Surf::InterpTargetMap( double u, double w )
@@ -437,6 +431,8 @@ void Surf::ApplyES( vec3d uw, double t )
     int iadd[] = { 0, 1, 0, 1 };
     int jadd[] = { 0, 0, 1, 1 };
 
+    vector< int > seeds;
+
     for( int i = 0; i < 4; i++ )
     {
         int itarget = ibase + iadd[i];
@@ -450,10 +446,12 @@ void Surf::ApplyES( vec3d uw, double t )
             if( m_SrcMap[ itarget ][ jtarget ].m_str > targetstr )
             {
                 m_SrcMap[ itarget ][ jtarget ].m_str = targetstr;
-                WalkMap( itarget, jtarget, itarget, jtarget );
+                seeds.push_back( itarget * nmapw + jtarget );
             }
         }
     }
+
+    WalkMap( seeds );
 }
 
 vec2d Surf::ClosestUW( vec3d & pnt_in, double guess_u, double guess_w ) const
@@ -1264,21 +1262,31 @@ void Surf::Subtag( bool tag_subs )
 
     if ( tag_subs ) s_surfs = SubSurfaceMgr.GetSubSurfs( m_GeomID, m_MainSurfID );
 
-    for ( int t = 0 ; t < ( int ) tri_vec.size() ; t++ )
+    SSTagIndex ss_index;
+    ss_index.Build( s_surfs );
+
+    int ntri = ( int ) tri_vec.size();
+
+    #pragma omp parallel
     {
-        SimpTri& tri = tri_vec[t];
-        tri.m_Tags.push_back( m_BaseTag );
-        vec2d center = ( pnts[tri.ind0] + pnts[tri.ind1] + pnts[tri.ind2] ) * 1 / 3.0;
-        vec2d cent2d = center;
+        set< vector< int > > loc_combos;
 
-        for ( int s = 0 ; s < ( int ) s_surfs.size() ; s++ )
+        #pragma omp for schedule( dynamic, 256 )
+        for ( int t = 0 ; t < ntri ; t++ )
         {
-            if ( s_surfs[s]->Subtag( vec3d( cent2d.x(), cent2d.y(), 0 ) ) )
-            {
-                tri.m_Tags.push_back( s_surfs[s]->m_Tag );
-            }
+            SimpTri& tri = tri_vec[t];
+            tri.m_Tags.push_back( m_BaseTag );
+            vec2d center = ( pnts[tri.ind0] + pnts[tri.ind1] + pnts[tri.ind2] ) * 1 / 3.0;
+
+            ss_index.Subtag( vec3d( center.x(), center.y(), 0 ), tri.m_Tags );
+
+            loc_combos.insert( tri.m_Tags );
+        }
+
+        #pragma omp critical
+        {
+            SubSurfaceMgr.m_TagCombos.insert( loc_combos.begin(), loc_combos.end() );
         }
-        SubSurfaceMgr.m_TagCombos.insert( tri.m_Tags );
     }
 }
 
@@ -60,10 +60,13 @@ public:
 
     double TargetLen( double u, double w, double gap, double radfrac );
     void BuildTargetMap( vector< MapSource* > &sources, int sid );
-    void WalkMap( int istart, int jstart, int kstart, int icurrent, int jcurrent);
-    void WalkMap( int istart, int jstart, int icurrent, int jcurrent );
+    void WalkMap( const vector< int > &seeds );
     void LimitTargetMap();
     void LimitTargetMap( MSCloud &es_cloud, MSTree &es_tree, double minmap );
+    int GetWalkPeakStack()
+    {
+        return m_WalkPeakStack;
+    }
     double InterpTargetMap( double u, double w );
     void UWtoTargetMapij( double u, double w, int &i, int &j, double &fraci, double &fracj );
     void UWtoTargetMapij( double u, double w, int &i, int &j );
@@ -291,6 +294,7 @@ protected:
 
     int m_NumMap;
     vector< vector< MapSource > > m_SrcMap;
+    int m_WalkPeakStack;    // Deepest walk stack seen building this map
 
     int m_NumWScalePnts;
     bool m_ScaleUFlag;
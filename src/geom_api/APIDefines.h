@@ -352,6 +352,11 @@ enum VSPAERO_ANALYSIS_METHOD { VORTEX_LATTICE,
                                PANEL
                              };
 
+enum MASS_PROP_MODE { MASS_PROP_SLICE,
+                      MASS_PROP_SURF_INTEGRAL,
+                      NUM_MASS_PROP_MODES
+                    };
+
 }   // Namespace
 
 #endif // !defined(VSPDEFINES__INCLUDED_)
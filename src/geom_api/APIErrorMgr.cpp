@@ -51,24 +51,29 @@ ErrorMgrSingleton::~ErrorMgrSingleton()
 //==== No Error For Last Call ====//
 void ErrorMgrSingleton::NoError()
 {
+    std::lock_guard< std::mutex > lock( m_ErrorMutex );
     m_ErrorLastCallFlag = false;
 }
 
 //==== Was There An Error On The Last API Call? ====//
 bool ErrorMgrSingleton::GetErrorLastCallFlag()
 {
+    std::lock_guard< std::mutex > lock( m_ErrorMutex );
     return m_ErrorLastCallFlag;
 }
 
 //==== How Many Total Errors on Stack? ====//
 int ErrorMgrSingleton::GetNumTotalErrors()
 {
+    std::lock_guard< std::mutex > lock( m_ErrorMutex );
     return m_ErrorStack.size();
 }
 
 //==== Return Error and Pop Off Stack =====//
 ErrorObj ErrorMgrSingleton::PopLastError()
 {
+    std::lock_guard< std::mutex > lock( m_ErrorMutex );
+
     ErrorObj ret_err;
 
     if ( m_ErrorStack.size() == 0 )         // Nothing To Undo
@@ -86,6 +91,8 @@ ErrorObj ErrorMgrSingleton::PopLastError()
 //==== Return Error and Pop Off Stack =====//
 ErrorObj ErrorMgrSingleton::GetLastError()
 {
+    std::lock_guard< std::mutex > lock( m_ErrorMutex );
+
     ErrorObj ret_err;
 
     if ( m_ErrorStack.size() == 0 )         // Nothing To Undo
@@ -103,6 +110,8 @@ ErrorObj ErrorMgrSingleton::GetLastError()
 //==== Add Error To Stack And Set Last Call Flag ====//
 void ErrorMgrSingleton::AddError( ERROR_CODE code, const string & desc )
 {
+    std::lock_guard< std::mutex > lock( m_ErrorMutex );
+
     if ( code == VSP_OK )
     {
         m_ErrorLastCallFlag = false;
@@ -116,6 +125,8 @@ void ErrorMgrSingleton::AddError( ERROR_CODE code, const string & desc )
 //==== Check For Error and Print to Stream if Found ====//
 bool ErrorMgrSingleton::PopErrorAndPrint( FILE* stream )
 {
+    std::lock_guard< std::mutex > lock( m_ErrorMutex );
+
     if ( m_ErrorLastCallFlag == false || m_ErrorStack.size() == 0 )
     {
         return false;
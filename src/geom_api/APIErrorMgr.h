@@ -17,6 +17,7 @@
 #include <string>
 #include <stack>
 #include <vector>
+#include <mutex>
 
 using std::string;
 using std::stack;
@@ -83,6 +84,7 @@ private:
 
     bool m_ErrorLastCallFlag;
     stack< ErrorObj > m_ErrorStack;
+    std::mutex m_ErrorMutex;                    // API calls may come from several threads
 
     ErrorMgrSingleton();
     ~ErrorMgrSingleton();
@@ -9,7 +9,23 @@
 #include "APITestSuite.h"
 #include <stdio.h>
 #include <float.h>
+#include <string.h>
+#include <chrono>
+#include <thread>
+#include <atomic>
+#include <set>
 #include "APIDefines.h"
+#include "LinkMgr.h"
+#include "SubSurfaceMgr.h"
+#include "ResultsMgr.h"
+#include "ParmMgr.h"
+#include "VehicleMgr.h"
+#include "Vehicle.h"
+#include "CfdMeshMgr.h"
+#include "FeaPart.h"
+#include "ScriptMgr.h"
+#include "AnalysisMgr.h"
+#include "MeshGeom.h"
 
 //Default tolerance to use for tests.  Most calculations are done as doubles and choosing single precision FLT_MIN gives some allowance for precision stackup in calculations
 #define TEST_TOL FLT_MIN
@@ -274,81 +290,1942 @@ void APITestSuite::TestAnalysesWithPod()
 
 }
 
+//==== Compare Slice And Surface Integral Mass Properties ====//
+void APITestSuite::TestMassPropModes()
+{
+    printf( "APITestSuite::TestMassPropModes()\n" );
+
+    // make sure setup works
+    vsp::VSPCheckSetup();
+    vsp::VSPRenew();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    //==== Overlapping Pod And Wing So Trimming Is Exercised ====//
+    string pod_id = vsp::AddGeom( "POD" );
+    TEST_ASSERT_DELTA( vsp::SetParmValUpdate( pod_id, "Length", "Design", 10.0 ), 10.0, TEST_TOL );
+    TEST_ASSERT_DELTA( vsp::SetParmValUpdate( pod_id, "FineRatio", "Design", 5.0 ), 5.0, TEST_TOL );
+
+    string wing_id = vsp::AddGeom( "WING" );
+    TEST_ASSERT_DELTA( vsp::SetParmValUpdate( wing_id, "X_Rel_Location", "XForm", 3.0 ), 3.0, TEST_TOL );
+    vsp::Update();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    int num_slices = 200;
+
+    vsp::ComputeMassProps( vsp::SET_ALL, num_slices, vsp::MASS_PROP_SLICE );
+    string slice_id = vsp::FindLatestResultsID( "Mass_Properties" );
+    vsp::ComputeMassProps( vsp::SET_ALL, num_slices, vsp::MASS_PROP_SURF_INTEGRAL );
+    string surf_id = vsp::FindLatestResultsID( "Mass_Properties" );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    double slice_vol = vsp::GetDoubleResults( slice_id, "Total_Volume" )[0];
+    double surf_vol = vsp::GetDoubleResults( surf_id, "Total_Volume" )[0];
+    double slice_mass = vsp::GetDoubleResults( slice_id, "Total_Mass" )[0];
+    double surf_mass = vsp::GetDoubleResults( surf_id, "Total_Mass" )[0];
+    vec3d slice_cg = vsp::GetVec3dResults( slice_id, "Total_CG" )[0];
+    vec3d surf_cg = vsp::GetVec3dResults( surf_id, "Total_CG" )[0];
+    double slice_ixx = vsp::GetDoubleResults( slice_id, "Total_Ixx" )[0];
+    double surf_ixx = vsp::GetDoubleResults( surf_id, "Total_Ixx" )[0];
+    printf( "\tVolume %f %f  Mass %f %f  Ixx %f %f\n", slice_vol, surf_vol, slice_mass, surf_mass, slice_ixx, surf_ixx );
+
+    //==== Slicing Converges To The Closed Form Result ====//
+    TEST_ASSERT( surf_vol > 0.0 );
+    TEST_ASSERT_DELTA( slice_vol / surf_vol, 1.0, 0.02 );
+    TEST_ASSERT_DELTA( slice_mass / surf_mass, 1.0, 0.02 );
+    TEST_ASSERT_DELTA( slice_ixx / surf_ixx, 1.0, 0.05 );
+    TEST_ASSERT_DELTA( slice_cg.x(), surf_cg.x(), 0.05 );
+    TEST_ASSERT_DELTA( slice_cg.y(), surf_cg.y(), 0.05 );
+    TEST_ASSERT_DELTA( slice_cg.z(), surf_cg.z(), 0.05 );
+
+    //==== Mass Properties Settings Are Saved With The Vehicle ====//
+    string veh_id = vsp::FindContainer( "Vehicle", 0 );
+    string mode_id = vsp::FindParm( veh_id, "MassPropMode", "MassProperties" );
+    string slices_id = vsp::FindParm( veh_id, "NumMassSlices", "MassProperties" );
+    vsp::SetParmVal( mode_id, vsp::MASS_PROP_SURF_INTEGRAL );
+    vsp::SetParmVal( slices_id, 35 );
+
+    string fname = "apitest_MassPropModes.vsp3";
+    vsp::WriteVSPFile( fname );
+    vsp::VSPRenew();
+    vsp::ReadVSPFile( fname );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    veh_id = vsp::FindContainer( "Vehicle", 0 );
+    TEST_ASSERT( vsp::GetIntParmVal( vsp::FindParm( veh_id, "MassPropMode", "MassProperties" ) ) == vsp::MASS_PROP_SURF_INTEGRAL );
+    TEST_ASSERT( vsp::GetIntParmVal( vsp::FindParm( veh_id, "NumMassSlices", "MassProperties" ) ) == 35 );
+    printf( "\n" );
+}
+
+void APITestSuite::TestLinkPropagation()
+{
+    printf( "APITestSuite::TestLinkPropagation()\n" );
+
+    // make sure setup works
+    vsp::VSPCheckSetup();
+    vsp::VSPRenew();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    //==== Heavily Linked Model - Each User Parm Drives The Next Four, Plus Back Links ====//
+    int num_parms = 500;
+    int fan = 4;
+    vector< string > pid_vec;
+    for ( int i = 0 ; i < num_parms ; i++ )
+    {
+        char name[256];
+        sprintf( name, "Link_Parm_%d", i );
+        pid_vec.push_back( LinkMgr.AddUserParm( PARM_DOUBLE_TYPE, name, "Link_Bench" ) );
+    }
+    string free_pid = LinkMgr.AddUserParm( PARM_DOUBLE_TYPE, "Free_Parm", "Link_Bench" );
+
+    int num_links = 0;
+    for ( int i = 0 ; i < num_parms ; i++ )
+    {
+        for ( int j = i + 1 ; j <= i + fan && j < num_parms ; j++ )
+        {
+            num_links += LinkMgr.AddLink( pid_vec[i], pid_vec[j] );
+        }
+        if ( i > 0 )
+        {
+            num_links += LinkMgr.AddLink( pid_vec[i], pid_vec[i - 1] );
+        }
+    }
+    TEST_ASSERT( num_links == LinkMgr.GetNumLinks() );
+    TEST_ASSERT( !LinkMgr.AddLink( pid_vec[0], pid_vec[1] ) );      // Duplicate
+    printf( "\t%d parms, %d links\n", num_parms, num_links );
+
+    //==== Change Reaches Every Dependent ====//
+    vsp::SetParmValUpdate( pid_vec[0], 3.0 );
+    TEST_ASSERT_DELTA( vsp::GetParmVal( pid_vec[num_parms - 1] ), 3.0, TEST_TOL );
+    vsp::SetParmValUpdate( pid_vec[num_parms / 2], 5.0 );
+    TEST_ASSERT_DELTA( vsp::GetParmVal( pid_vec[num_parms - 1] ), 5.0, TEST_TOL );
+    TEST_ASSERT_DELTA( vsp::GetParmVal( pid_vec[0] ), 5.0, TEST_TOL );
+
+    //==== Repeated SetParmValUpdate On Linked And Unlinked Parms ====//
+    int num_calls = 100;
+
+    for ( int i = 0 ; i < num_calls ; i++ )
+    {
+        vsp::SetParmValUpdate( pid_vec[ i % num_parms ], ( double )( i % 7 ) );
+    }
+    for ( int i = 0 ; i < num_calls ; i++ )
+    {
+        vsp::SetParmValUpdate( free_pid, ( double )( i % 7 ) );
+    }
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    double last_val = ( double )( ( num_calls - 1 ) % 7 );
+    TEST_ASSERT_DELTA( vsp::GetParmVal( pid_vec[0] ), last_val, TEST_TOL );
+    TEST_ASSERT_DELTA( vsp::GetParmVal( pid_vec[num_parms - 1] ), last_val, TEST_TOL );
+
+    LinkMgr.DelAllLinks();
+    LinkMgr.DeleteAllUserParm();
+    printf( "\n" );
+}
+
+void APITestSuite::TestUpdateTransaction()
+{
+    printf( "APITestSuite::TestUpdateTransaction()\n" );
+
+    // make sure setup works
+    vsp::VSPCheckSetup();
+    vsp::VSPRenew();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    //==== Several Independent Pods, First Pod Has A Child, Last Pod Linked To First ====//
+    int num_pods = 6;
+    vector< string > pod_vec;
+    for ( int i = 0 ; i < num_pods ; i++ )
+    {
+        pod_vec.push_back( vsp::AddGeom( "POD" ) );
+    }
+    string child_id = vsp::AddGeom( "POD", pod_vec[0] );
+    string len0_id = vsp::GetParm( pod_vec[0], "Length", "Design" );
+    string len_last_id = vsp::GetParm( pod_vec[num_pods - 1], "Length", "Design" );
+    TEST_ASSERT( LinkMgr.AddLink( len0_id, len_last_id ) );
+    vsp::Update();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    //==== Nothing Changed - Nothing Updated ====//
+    vsp::BeginUpdateTransaction();
+    TEST_ASSERT( vsp::CommitUpdateTransaction() == 0 );
+
+    //==== Changes Are Held Until Commit ====//
+    vsp::BeginUpdateTransaction();
+    vsp::SetParmVal( pod_vec[0], "FineRatio", "Design", 8.0 );
+    vsp::SetParmVal( pod_vec[0], "Length", "Design", 20.0 );
+    vsp::SetParmValUpdate( pod_vec[0], "X_Rel_Location", "XForm", 2.0 );
+    TEST_ASSERT_DELTA( vsp::GetParmVal( len_last_id ), 10.0, TEST_TOL );   // Link Not Propagated Yet
+
+    //==== Nested Begin/Commit Is Folded Into The Outer Transaction ====//
+    vsp::BeginUpdateTransaction();
+    vsp::SetParmVal( pod_vec[1], "FineRatio", "Design", 6.0 );
+    TEST_ASSERT( vsp::CommitUpdateTransaction() == 0 );
+
+    // pod 0 + child, pod 1, linked last pod
+    int num_updated = vsp::CommitUpdateTransaction();
+    TEST_ASSERT( num_updated == 4 );
+    TEST_ASSERT_DELTA( vsp::GetParmVal( len_last_id ), 20.0, TEST_TOL );
+
+    string res_id = vsp::FindLatestResultsID( "Update_Transaction" );
+    TEST_ASSERT( vsp::GetIntResults( res_id, "Num_Geoms_Updated" )[0] == num_updated );
+    TEST_ASSERT( vsp::GetIntResults( res_id, "Num_Geoms" )[0] == num_pods + 1 );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    //==== Many Parm Changes With Per Call Updates And With One Transaction ====//
+    int num_sets = 20;
+    for ( int i = 0 ; i < num_sets ; i++ )
+    {
+        vsp::SetParmValUpdate( pod_vec[ i % 2 ], "FineRatio", "Design", 5.0 + ( i % 5 ) );
+    }
+    vsp::BeginUpdateTransaction();
+    for ( int i = 0 ; i < num_sets ; i++ )
+    {
+        vsp::SetParmValUpdate( pod_vec[ i % 2 ], "FineRatio", "Design", 6.0 + ( i % 5 ) );
+    }
+    num_updated = vsp::CommitUpdateTransaction();
+    TEST_ASSERT( num_updated == 3 );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    //==== Linked Geom Deleted After Its Change Was Held - Commit Skips It ====//
+    vsp::BeginUpdateTransaction();
+    vsp::SetParmVal( len0_id, 30.0 );
+    vsp::DeleteGeom( pod_vec[0] );
+    TEST_ASSERT( !vsp::ValidParm( len0_id ) );
+    vsp::CommitUpdateTransaction();
+    TEST_ASSERT_DELTA( vsp::GetParmVal( len_last_id ), 20.0, TEST_TOL );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    //==== Deleting The Driven Geom Is Safe Too ====//
+    string len1_id = vsp::GetParm( pod_vec[1], "Length", "Design" );
+    string len2_id = vsp::GetParm( pod_vec[2], "Length", "Design" );
+    TEST_ASSERT( LinkMgr.AddLink( len1_id, len2_id ) );
+    vsp::BeginUpdateTransaction();
+    vsp::SetParmVal( len1_id, 12.0 );
+    vsp::DeleteGeom( pod_vec[2] );
+    vsp::CommitUpdateTransaction();
+    TEST_ASSERT_DELTA( vsp::GetParmVal( len1_id ), 12.0, TEST_TOL );
+    printf( "\n" );
+}
+
+//==== Compare Indexed Sub-Surface Tagging Against The Direct Polygon Tests ====//
+void APITestSuite::TestSubSurfaceTagging()
+{
+    printf( "APITestSuite::TestSubSurfaceTagging()\n" );
+
+    // make sure setup works
+    vsp::VSPCheckSetup();
+    vsp::VSPRenew();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    //==== Finely Tessellated Wing With Many Sub-Surfaces ====//
+    string wing_id = vsp::AddGeom( "WING" );
+    vsp::SetParmVal( wing_id, "SectTess_U", "XSec_1", 60 );
+    vsp::SetParmVal( wing_id, "Tess_W", "Shape", 81 );
+
+    int num_ctrl = 4;
+    for ( int i = 0 ; i < num_ctrl ; i++ )
+    {
+        string ss_id = vsp::AddSubSurf( wing_id, vsp::SS_CONTROL, 0 );
+        vsp::SetParmVal( ss_id, "UStart", "SS_Control", 0.05 + 0.24 * i );
+        vsp::SetParmVal( ss_id, "UEnd", "SS_Control", 0.25 + 0.24 * i );
+        vsp::SetParmVal( ss_id, "LE_Flag", "SS_Control", i % 2 );
+    }
+
+    int num_rect = 6;
+    for ( int i = 0 ; i < num_rect ; i++ )
+    {
+        string ss_id = vsp::AddSubSurf( wing_id, ( i % 2 ) ? vsp::SS_ELLIPSE : vsp::SS_RECTANGLE, 0 );
+        string group = ( i % 2 ) ? "SS_Ellipse" : "SS_Rectangle";
+        vsp::SetParmVal( ss_id, "Center_U", group, 0.1 + 0.15 * i );
+        vsp::SetParmVal( ss_id, "Center_W", group, 0.25 + 0.1 * ( i % 3 ) );
+        vsp::SetParmVal( ss_id, "U_Length", group, 0.1 );
+        vsp::SetParmVal( ss_id, "W_Length", group, 0.15 );
+        vsp::SetParmVal( ss_id, "Test_Type", group, ( i == 4 ) ? vsp::OUTSIDE : vsp::INSIDE );
+    }
+
+    string line_id = vsp::AddSubSurf( wing_id, vsp::SS_LINE, 0 );
+    vsp::SetParmVal( line_id, "Const_Line_Value", "SubSurface", 0.5 );
+    vsp::Update();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    //==== Comp Geom Tags Every Triangle ====//
+    string mesh_id = vsp::ComputeCompGeom( vsp::SET_ALL, false, 0 );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    string res_id = vsp::FindLatestResultsID( "Comp_Geom" );
+    int num_tris = vsp::GetIntResults( res_id, "Total_Num_Tris" )[0];
+    int num_tags = SubSurfaceMgr.GetNumTags();
+    printf( "\tComp Geom: %d tris, %d tags\n", num_tris, num_tags );
+    TEST_ASSERT( num_tags > num_ctrl + num_rect );
+
+    //==== Indexed And Direct Tagging Agree Over The Whole UW Domain ====//
+    vector< SubSurface* > ss_vec = SubSurfaceMgr.GetSubSurfs( wing_id, 0 );
+    TEST_ASSERT( ( int )ss_vec.size() == num_ctrl + num_rect + 1 );
+
+    SSTagIndex ss_index;
+    ss_index.Build( ss_vec );
+    TEST_ASSERT( ss_index.GetNumCells() > 0 );
+
+    int num_u = 100;
+    int num_w = 100;
+    vector< vec3d > uw_vec;
+    uw_vec.reserve( num_u * num_w );
+    for ( int i = 0 ; i < num_u ; i++ )
+    {
+        for ( int j = 0 ; j < num_w ; j++ )
+        {
+            uw_vec.push_back( vec3d( -0.5 + 3.0 * i / ( num_u - 1 ), -0.5 + 5.0 * j / ( num_w - 1 ), 0 ) );
+        }
+    }
+
+    vector< vector< int > > direct_tags( uw_vec.size() );
+    vector< vector< int > > index_tags( uw_vec.size() );
+
+    for ( int p = 0 ; p < ( int )uw_vec.size() ; p++ )
+    {
+        for ( int s = 0 ; s < ( int )ss_vec.size() ; s++ )
+        {
+            if ( ss_vec[s]->Subtag( uw_vec[p] ) )
+            {
+                direct_tags[p].push_back( ss_vec[s]->m_Tag );
+            }
+        }
+    }
+    for ( int p = 0 ; p < ( int )uw_vec.size() ; p++ )
+    {
+        ss_index.Subtag( uw_vec[p], index_tags[p] );
+    }
+
+    int num_diff = 0;
+    for ( int p = 0 ; p < ( int )uw_vec.size() ; p++ )
+    {
+        if ( direct_tags[p] != index_tags[p] )
+        {
+            num_diff++;
+        }
+    }
+    TEST_ASSERT( num_diff == 0 );
+    printf( "\n" );
+}
+
+void APITestSuite::TestResultsBinaryIO()
+{
+    printf( "APITestSuite::TestResultsBinaryIO()\n" );
+
+    vsp::VSPCheckSetup();
+    vsp::VSPRenew();
+    vsp::DeleteAllResults();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    //==== Many Results Spread Over A Few Names ====//
+    int num_res = 200;
+    vector< string > id_vec;
+    for ( int i = 0 ; i < num_res ; i++ )
+    {
+        char name[64];
+        sprintf( name, "Test_Binary_%d", i % 10 );
+        Results* res = ResultsMgr.CreateResults( name );
+
+        vector< double > dvec( 100 );
+        vector< vec3d > pvec( 20 );
+        for ( int j = 0 ; j < ( int )dvec.size() ; j++ )
+        {
+            dvec[j] = i + 0.001 * j;
+        }
+        for ( int j = 0 ; j < ( int )pvec.size() ; j++ )
+        {
+            pvec[j] = vec3d( i, j, -0.5 * j );
+        }
+        vector< string > svec( 1, string( name ) );
+
+        res->Add( NameValData( "Index", i ) );
+        res->Add( NameValData( "Doubles", dvec ) );
+        res->Add( NameValData( "Pnts", pvec ) );
+        res->Add( NameValData( "Names", svec ) );
+        id_vec.push_back( res->GetID() );
+    }
+    TEST_ASSERT( vsp::GetNumResults( "Test_Binary_3" ) == num_res / 10 );
+    TEST_ASSERT( vsp::FindLatestResultsID( "Test_Binary_3" ) == id_vec[num_res - 7] );
+
+    //==== Lookups ====//
+    double sum = 0;
+    for ( int i = 0 ; i < num_res ; i++ )
+    {
+        sum += vsp::GetDoubleResults( id_vec[i], "Doubles" )[0];
+    }
+    TEST_ASSERT_DELTA( sum, 0.5 * num_res * ( num_res - 1 ), TEST_TOL );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    //==== View Points At The Stored Data ====//
+    const vector< double > * dview = vsp::GetDoubleResultsView( id_vec[5], "Doubles" );
+    TEST_ASSERT( dview == &vsp::GetDoubleResults( id_vec[5], "Doubles" ) );
+    TEST_ASSERT( dview && dview->size() == 100 );
+    TEST_ASSERT( vsp::GetIntResultsView( id_vec[5], "Missing" ) == NULL );
+    TEST_ASSERT( vsp::ErrorMgr.PopErrorAndPrint( stdout ) );      // Expect VSP_CANT_FIND_NAME
+
+    //==== Deleting The Latest Falls Back To The Next Newest ====//
+    vsp::DeleteResult( id_vec[num_res - 7] );
+    TEST_ASSERT( vsp::FindLatestResultsID( "Test_Binary_3" ) == id_vec[num_res - 17] );
+    id_vec.erase( id_vec.begin() + num_res - 7 );
+
+    //==== Round Trip Through The Binary File ====//
+    vsp::WriteResultsBinaryFile( id_vec, "TestResults_API.vspres" );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    vector< string > read_vec = vsp::ReadResultsBinaryFile( "TestResults_API.vspres" );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+    TEST_ASSERT( read_vec.size() == id_vec.size() );
+
+    for ( int i = 0 ; i < ( int )read_vec.size() && i < ( int )id_vec.size() ; i++ )
+    {
+        TEST_ASSERT( vsp::GetIntResults( read_vec[i], "Index" ) == vsp::GetIntResults( id_vec[i], "Index" ) );
+        TEST_ASSERT( vsp::GetDoubleResults( read_vec[i], "Doubles" ) == vsp::GetDoubleResults( id_vec[i], "Doubles" ) );
+        TEST_ASSERT( vsp::GetStringResults( read_vec[i], "Names" ) == vsp::GetStringResults( id_vec[i], "Names" ) );
+        TEST_ASSERT( vsp::GetVec3dResults( read_vec[i], "Pnts" ).size() == 20 );
+        TEST_ASSERT_DELTA( vsp::GetVec3dResults( read_vec[i], "Pnts" )[19].z(), -9.5, TEST_TOL );
+        TEST_ASSERT( ResultsMgr.GetResultsTimestamp( read_vec[i] ) == ResultsMgr.GetResultsTimestamp( id_vec[i] ) );
+    }
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    //==== Not A Results File ====//
+    vsp::WriteResultsCSVFile( id_vec[0], "TestResults_API.csv" );
+    TEST_ASSERT( vsp::ReadResultsBinaryFile( "TestResults_API.csv" ).size() == 0 );
+    TEST_ASSERT( vsp::ErrorMgr.PopErrorAndPrint( stdout ) );      // Expect VSP_WRONG_FILE_TYPE
+
+    vsp::DeleteAllResults();
+    printf( "\n" );
+}
+
+//==== Hammer The Managers From Several Threads While Analyses Run Asynchronously ====//
+void APITestSuite::TestConcurrentAnalyses()
+{
+    printf( "APITestSuite::TestConcurrentAnalyses()\n" );
+
+    vsp::VSPCheckSetup();
+    vsp::VSPRenew();
+    vsp::DeleteAllResults();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    string pod_id = vsp::AddGeom( "POD" );
+    string wing_id = vsp::AddGeom( "WING" );
+    TEST_ASSERT_DELTA( vsp::SetParmValUpdate( wing_id, "X_Rel_Location", "XForm", 3.0 ), 3.0, TEST_TOL );
+    string length_id = vsp::GetParm( pod_id, "Length", "Design" );
+    double length = vsp::GetParmVal( length_id );
+    vsp::Update();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    //==== Serial Reference ====//
+    vsp::SetAnalysisInputDefaults( "MassProp" );
+    vsp::SetIntAnalysisInput( "MassProp", "NumMassSlices", vector< int >( 1, 40 ) );
+    string ref_id = vsp::ExecAnalysis( "MassProp" );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+    double ref_vol = vsp::GetDoubleResults( ref_id, "Total_Volume" )[0];
+
+    //==== Inputs Can Be Read And Set While An Analysis Runs ====//
+    vsp::SetIntAnalysisInput( "MassProp", "NumMassSlices", vector< int >( 1, 200 ) );
+    int slow_handle = vsp::ExecAnalysisAsync( "MassProp" );
+    TEST_ASSERT( slow_handle >= 0 );
+    while ( AnalysisMgr.GetNumRunningAnalyses() == 0 && !vsp::AsyncAnalysisReady( slow_handle ) )
+    {
+        std::this_thread::yield();
+    }
+    TEST_ASSERT( AnalysisMgr.GetNumRunningAnalyses() == 1 );
+    vsp::SetIntAnalysisInput( "MassProp", "NumMassSlices", vector< int >( 1, 40 ) );
+    TEST_ASSERT( vsp::GetIntAnalysisInput( "MassProp", "NumMassSlices" )[0] == 40 );
+    TEST_ASSERT( vsp::GetAnalysisInputNames( "MassProp" ).size() > 0 );
+    TEST_ASSERT( !vsp::AsyncAnalysisReady( slow_handle ) );          // Input Access Did Not Wait For The Run
+    TEST_ASSERT( AnalysisMgr.GetNumRunningAnalyses() == 1 );
+    string slow_id = vsp::WaitAsyncAnalysis( slow_handle );
+    TEST_ASSERT( AnalysisMgr.GetNumRunningAnalyses() == 0 );
+    TEST_ASSERT( vsp::GetDoubleResults( slow_id, "Total_Volume" )[0] > 0.0 );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    //==== Each Launch Keeps The Inputs It Was Given ====//
+    int mp40_handle = vsp::ExecAnalysisAsync( "MassProp" );
+    vsp::SetIntAnalysisInput( "MassProp", "NumMassSlices", vector< int >( 1, 10 ) );
+    int mp10_handle = vsp::ExecAnalysisAsync( "MassProp" );
+    vsp::SetAnalysisInputDefaults( "CompGeom" );
+    int cg_handle = vsp::ExecAnalysisAsync( "CompGeom" );
+    TEST_ASSERT( mp40_handle >= 0 && mp10_handle >= 0 && cg_handle >= 0 );
+    TEST_ASSERT( vsp::ExecAnalysisAsync( "NotAnAnalysis" ) == -1 );
+    TEST_ASSERT( vsp::ErrorMgr.PopErrorAndPrint( stdout ) );      // Expect VSP_INVALID_ID
+
+    //==== Stress Results, IDs And Parm Lookups Meanwhile ====//
+    int num_threads = 4;
+    int num_res = 500;
+    std::atomic< int > num_fail( 0 );
+    vector< vector< string > > gen_ids( num_threads );
+    vector< std::thread > threads;
+
+    for ( int t = 0 ; t < num_threads ; t++ )
+    {
+        threads.push_back( std::thread( [ &, t ]()
+        {
+            string name = "Stress_" + std::to_string( ( long long )t );
+            vector< string > ids;
+            for ( int i = 0 ; i < num_res ; i++ )
+            {
+                Results* res = ResultsMgr.CreateResults( name );
+                res->Add( NameValData( "Value", ( double )i ) );
+                ids.push_back( res->GetID() );
+
+                if ( vsp::GetDoubleResults( ids[i], "Value" )[0] != ( double )i )
+                {
+                    num_fail++;
+                }
+                if ( ResultsMgr.FindLatestResultsID( name ) != ids[i] )
+                {
+                    num_fail++;
+                }
+                if ( vsp::GetParmVal( length_id ) != length )
+                {
+                    num_fail++;
+                }
+                if ( i % 2 == 1 )
+                {
+                    ResultsMgr.DeleteResult( ids[i - 1] );
+                }
+                gen_ids[t].push_back( ParmMgr.GenerateID( 10 ) );
+            }
+        } ) );
+    }
+
+    for ( int t = 0 ; t < num_threads ; t++ )
+    {
+        threads[t].join();
+    }
+
+    string mp40_id = vsp::WaitAsyncAnalysis( mp40_handle );
+    string mp10_id = vsp::WaitAsyncAnalysis( mp10_handle );
+    string cg_id = vsp::WaitAsyncAnalysis( cg_handle );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    TEST_ASSERT( num_fail == 0 );
+
+    std::set< string > id_set;
+    for ( int t = 0 ; t < num_threads ; t++ )
+    {
+        TEST_ASSERT( vsp::GetNumResults( "Stress_" + std::to_string( ( long long )t ) ) == num_res / 2 );
+        id_set.insert( gen_ids[t].begin(), gen_ids[t].end() );
+    }
+    TEST_ASSERT( ( int )id_set.size() == num_threads * num_res );
+
+    TEST_ASSERT( mp40_id != mp10_id && mp40_id != ref_id );
+    TEST_ASSERT_DELTA( vsp::GetDoubleResults( mp40_id, "Total_Volume" )[0], ref_vol, TEST_TOL );
+    TEST_ASSERT( vsp::GetDoubleResults( mp10_id, "Total_Volume" )[0] > 0.0 );
+    TEST_ASSERT( vsp::GetIntResults( cg_id, "Num_Comps" ).size() > 0 );
+    TEST_ASSERT( vsp::GetIntAnalysisInput( "MassProp", "NumMassSlices" )[0] == 10 );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    vsp::DeleteAllResults();
+    printf( "\n" );
+}
+
+void APITestSuite::TestSurfaceQueries()
+{
+    printf( "APITestSuite::TestSurfaceQueries()\n" );
+
+    vsp::VSPCheckSetup();
+    vsp::VSPRenew();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    string pod_id = vsp::AddGeom( "POD" );
+    vsp::Update();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+    TEST_ASSERT( vsp::GetNumTotalSurfs( pod_id ) == 1 );
+
+    //==== Build U W Grid Away From Poles ====//
+    int nu = 60;
+    int nw = 40;
+    vector< double > u_vec, w_vec;
+    for ( int i = 0 ; i < nu ; i++ )
+    {
+        for ( int j = 0 ; j < nw ; j++ )
+        {
+            u_vec.push_back( 0.1 + 0.8 * ( double )i / ( double )( nu - 1 ) );
+            w_vec.push_back( ( double )j / ( double )nw );
+        }
+    }
+    int npt = ( int )u_vec.size();
+
+    vector< vec3d > pnt_vec = vsp::CompVecPnt01( pod_id, 0, u_vec, w_vec );
+    vector< vec3d > norm_vec = vsp::CompVecNorm01( pod_id, 0, u_vec, w_vec );
+    vector< double > k1_vec, k2_vec, ka_vec, kg_vec;
+    vsp::CompVecCurvature01( pod_id, 0, u_vec, w_vec, k1_vec, k2_vec, ka_vec, kg_vec );
+    vector< double > u_proj_vec, w_proj_vec, d_proj_vec;
+    vsp::ProjVecPnt01( pod_id, 0, pnt_vec, u_proj_vec, w_proj_vec, d_proj_vec );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    TEST_ASSERT( ( int )pnt_vec.size() == npt && ( int )norm_vec.size() == npt );
+    TEST_ASSERT( ( int )kg_vec.size() == npt && ( int )d_proj_vec.size() == npt );
+
+    //==== Batched Results Match Single Point Queries ====//
+    int num_bad = 0;
+    for ( int i = 0 ; i < npt ; i++ )
+    {
+        vec3d pnt = vsp::CompPnt01( pod_id, 0, u_vec[i], w_vec[i] );
+        vec3d norm = vsp::CompNorm01( pod_id, 0, u_vec[i], w_vec[i] );
+        double k1, k2, ka, kg;
+        vsp::CompCurvature01( pod_id, 0, u_vec[i], w_vec[i], k1, k2, ka, kg );
+
+        if ( dist( pnt, pnt_vec[i] ) > 1e-12 || dist( norm, norm_vec[i] ) > 1e-12 ||
+             std::abs( kg - kg_vec[i] ) > 1e-12 || std::abs( ka - ka_vec[i] ) > 1e-12 )
+        {
+            num_bad++;
+        }
+
+        // Convex body, principal curvatures bracket the mean
+        if ( std::abs( norm_vec[i].mag() - 1.0 ) > 1e-9 || kg_vec[i] <= 0.0 ||
+             k1_vec[i] < ka_vec[i] - 1e-9 || k2_vec[i] > ka_vec[i] + 1e-9 )
+        {
+            num_bad++;
+        }
+
+        // Projecting a surface point lands back on it
+        vec3d proj_pnt = vsp::CompPnt01( pod_id, 0, u_proj_vec[i], w_proj_vec[i] );
+        if ( d_proj_vec[i] > 1e-6 || dist( proj_pnt, pnt_vec[i] ) > 1e-6 )
+        {
+            num_bad++;
+        }
+    }
+    TEST_ASSERT( num_bad == 0 );
+
+    double u_proj, w_proj;
+    vec3d off_pnt = pnt_vec[npt / 2] + norm_vec[npt / 2] * 0.5;
+    TEST_ASSERT_DELTA( vsp::ProjPnt01( pod_id, 0, off_pnt, u_proj, w_proj ), 0.5, 1e-4 );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    //==== Bad Inputs Flag Errors ====//
+    TEST_ASSERT( vsp::CompVecPnt01( "BadGeomID", 0, u_vec, w_vec ).size() == 0 );
+    TEST_ASSERT( vsp::ErrorMgr.PopErrorAndPrint( stdout ) );      // Expect VSP_INVALID_PTR
+    TEST_ASSERT( vsp::CompVecNorm01( pod_id, 5, u_vec, w_vec ).size() == 0 );
+    TEST_ASSERT( vsp::ErrorMgr.PopErrorAndPrint( stdout ) );      // Expect VSP_INDEX_OUT_RANGE
+    w_vec.pop_back();
+    TEST_ASSERT( vsp::CompVecPnt01( pod_id, 0, u_vec, w_vec ).size() == 0 );
+    TEST_ASSERT( vsp::ErrorMgr.PopErrorAndPrint( stdout ) );      // Expect VSP_INDEX_OUT_RANGE
+    printf( "\n" );
+}
+
+void APITestSuite::TestTessellation()
+{
+    printf( "APITestSuite::TestTessellation()\n" );
+
+    vsp::VSPCheckSetup();
+    vsp::VSPRenew();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    vector< string > geom_vec;
+    geom_vec.push_back( vsp::AddGeom( "WING" ) );
+    geom_vec.push_back( vsp::AddGeom( "FUSELAGE" ) );
+    vsp::Update();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    //==== Production Densities - Points Per Section And Around ====//
+    int num_u = 60;
+    int num_w = 121;
+
+    Vehicle* veh = VehicleMgr.GetVehicle();
+    for ( int g = 0 ; g < ( int )geom_vec.size() ; g++ )
+    {
+        VspSurf* surf = veh->FindGeom( geom_vec[g] )->GetSurfPtr( 0 );
+        TEST_ASSERT( surf != NULL );
+
+        vector< vector< vec3d > > pnts, norms, uw_pnts;
+        surf->Tesselate( num_u, num_w, pnts, norms, uw_pnts, 1, false );
+
+        //==== Compare To Point By Point Evaluation ====//
+        int num_bad = 0;
+        int num_pnt = 0;
+        for ( int i = 0 ; i < ( int )pnts.size() ; i++ )
+        {
+            for ( int j = 0 ; j < ( int )pnts[i].size() ; j++ )
+            {
+                vec3d pnt = surf->CompPnt( uw_pnts[i][j].x(), uw_pnts[i][j].y() );
+                vec3d norm = surf->CompNorm( uw_pnts[i][j].x(), uw_pnts[i][j].y() );
+
+                if ( dist( pnt, pnts[i][j] ) > 1e-10 )
+                {
+                    num_bad++;
+                }
+                // Collapsed edges take the Tesselate offset normal instead
+                if ( norm.mag() > 1e-6 && dist( norm, norms[i][j] ) > 1e-8 )
+                {
+                    num_bad++;
+                }
+                num_pnt++;
+            }
+        }
+        TEST_ASSERT( num_pnt > 0 );
+        TEST_ASSERT( num_bad == 0 );
+    }
+
+    printf( "\n" );
+}
+
+void APITestSuite::TestTessellationCache()
+{
+    printf( "APITestSuite::TestTessellationCache()\n" );
+
+    vsp::VSPCheckSetup();
+    vsp::VSPRenew();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    string wing_id = vsp::AddGeom( "WING" );
+    string fuse_id = vsp::AddGeom( "FUSELAGE" );
+    vsp::Update();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    //==== Update, CompGeom, DegenGeom And Export In Sequence ====//
+    VspSurf::ResetTessCacheCounters();
+    vsp::SetParmValUpdate( wing_id, "Span", "XSec_1", 12.0 );
+
+    vsp::SetAnalysisInputDefaults( "CompGeom" );
+    vsp::ExecAnalysis( "CompGeom" );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+    vsp::ComputeDegenGeom( vsp::SET_ALL, 0 );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+    vsp::ExportFile( "TestTessCache_API.stl", vsp::SET_ALL, vsp::EXPORT_STL );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    long long hits = VspSurf::GetTessCacheHits();
+    long long misses = VspSurf::GetTessCacheMisses();
+    TEST_ASSERT( hits > 0 );
+    TEST_ASSERT( hits >= misses );
+
+    string degen_id = vsp::FindLatestResultsID( "DegenGeom" );
+    TEST_ASSERT( degen_id != string() );
+    TEST_ASSERT( vsp::GetIntResults( degen_id, "Num_Degen_Geoms" )[0] > 0 );
+    TEST_ASSERT( vsp::GetIntResults( degen_id, "Tess_Cache_Hits" ).size() == 1 );
+
+    //==== DegenGeom Again Without An Update - Every Tesselation Comes From The Cache ====//
+    Vehicle* veh = VehicleMgr.GetVehicle();
+    VspSurf::ResetTessCacheCounters();
+    veh->CreateDegenGeom( vsp::SET_ALL );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    string degen2_id = vsp::FindLatestResultsID( "DegenGeom" );
+    TEST_ASSERT( degen2_id != degen_id );
+    TEST_ASSERT( vsp::GetIntResults( degen2_id, "Tess_Cache_Hits" )[0] > 0 );
+    TEST_ASSERT( vsp::GetIntResults( degen2_id, "Tess_Cache_Misses" )[0] == 0 );
+    TEST_ASSERT( vsp::GetIntResults( degen2_id, "Num_Degen_Geoms" )[0] == vsp::GetIntResults( degen_id, "Num_Degen_Geoms" )[0] );
+
+    //==== Cached Result Matches A Fresh Evaluation And Tracks Changes ====//
+    VspSurf* surf = veh->FindGeom( wing_id )->GetSurfPtr( 0 );
+    long long rev = surf->GetRevision();
+
+    vector< vector< vec3d > > pnts, norms, uw_pnts;
+    surf->Tesselate( 10, 21, pnts, norms, uw_pnts, 1, false );
+    VspSurf fresh_surf = *surf;
+    fresh_surf.BumpRevision();
+    vector< vector< vec3d > > fresh_pnts, fresh_norms, fresh_uw_pnts;
+    fresh_surf.Tesselate( 10, 21, fresh_pnts, fresh_norms, fresh_uw_pnts, 1, false );
+
+    TEST_ASSERT( pnts.size() == fresh_pnts.size() );
+    TEST_ASSERT( pnts.back().size() == fresh_pnts.back().size() );
+    TEST_ASSERT( dist( pnts.back().back(), fresh_pnts.back().back() ) == 0.0 );
+    TEST_ASSERT( dist( norms[1][1], fresh_norms[1][1] ) == 0.0 );
+
+    vsp::SetParmValUpdate( wing_id, "Span", "XSec_1", 15.0 );
+    surf = veh->FindGeom( wing_id )->GetSurfPtr( 0 );
+    TEST_ASSERT( surf->GetRevision() != rev );
+
+    vector< vector< vec3d > > new_pnts;
+    surf->Tesselate( 10, 21, new_pnts, norms, uw_pnts, 1, false );
+    TEST_ASSERT( dist( new_pnts.back().back(), pnts.back().back() ) > 1.0 );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    vsp::DeleteAllResults();
+    printf( "\n" );
+}
+
+//==== Relative Difference Within Tolerance ====//
+static bool CloseRel( double a, double b, double tol )
+{
+    return std::abs( a - b ) <= tol * max( 1.0, max( std::abs( a ), std::abs( b ) ) );
+}
+
+//==== Shared Mesh Mass Slicing Matches A Separately Intersected Mesh ====//
+void APITestSuite::TestDegenGeomMassSlice()
+{
+    printf( "APITestSuite::TestDegenGeomMassSlice()\n" );
+
+    vsp::VSPCheckSetup();
+    vsp::VSPRenew();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    // Symmetric wing passing through a pod, plus a second pod clear of both
+    string pod_id = vsp::AddGeom( "POD" );
+    TEST_ASSERT_DELTA( vsp::SetParmValUpdate( pod_id, "Length", "Design", 12.0 ), 12.0, TEST_TOL );
+    TEST_ASSERT_DELTA( vsp::SetParmValUpdate( pod_id, "FineRatio", "Design", 6.0 ), 6.0, TEST_TOL );
+    string wing_id = vsp::AddGeom( "WING" );
+    TEST_ASSERT_DELTA( vsp::SetParmValUpdate( wing_id, "X_Rel_Location", "XForm", 4.0 ), 4.0, TEST_TOL );
+    string pod2_id = vsp::AddGeom( "POD" );
+    TEST_ASSERT_DELTA( vsp::SetParmValUpdate( pod2_id, "Z_Rel_Location", "XForm", 10.0 ), 10.0, TEST_TOL );
+    vsp::Update();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    //==== One Mesh Shared By Intersect/Trim And Mass Slicing ====//
+    Vehicle* veh = VehicleMgr.GetVehicle();
+    veh->CreateDegenGeom( vsp::SET_ALL );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+    vector< DegenGeom > shared_vec = veh->GetDegenGeomVec();
+
+    //==== Separate Meshes, Mass Slicing Intersects Its Own Copy ====//
+    vector< DegenGeom > separate_vec;
+    vector< Geom* > geom_vec = veh->FindGeomVec( veh->GetGeomVec( false ) );
+    for ( int i = 0 ; i < ( int )geom_vec.size() ; i++ )
+    {
+        geom_vec[i]->CreateDegenGeom( separate_vec );
+    }
+
+    vector< string > active_vec_store = veh->GetActiveGeomVec();
+
+    string mesh_id = veh->AddMeshGeom( vsp::SET_ALL );
+    MeshGeom* mesh_ptr = dynamic_cast< MeshGeom* >( veh->FindGeom( mesh_id ) );
+    TEST_ASSERT( mesh_ptr != NULL );
+    if ( mesh_ptr )
+    {
+        mesh_ptr->degenGeomIntersectTrim( separate_vec );
+    }
+    veh->DeleteGeom( mesh_id );
+
+    mesh_id = veh->AddMeshGeom( vsp::SET_ALL );
+    mesh_ptr = dynamic_cast< MeshGeom* >( veh->FindGeom( mesh_id ) );
+    TEST_ASSERT( mesh_ptr != NULL );
+    if ( mesh_ptr )
+    {
+        mesh_ptr->degenGeomMassSliceX( separate_vec, false );
+    }
+    veh->DeleteGeom( mesh_id );
+
+    veh->SetActiveGeomVec( active_vec_store );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    //==== Same Components, Same Trimmed Volumes And Mass Properties ====//
+    // Pods give one surface each, the wing two
+    TEST_ASSERT( shared_vec.size() == 4 );
+    TEST_ASSERT( shared_vec.size() == separate_vec.size() );
+
+    double tol = 1e-6;
+    int num_bad = 0;
+    int num_massive = 0;
+    for ( int i = 0 ; i < ( int )shared_vec.size() && i < ( int )separate_vec.size() ; i++ )
+    {
+        DegenPoint a = shared_vec[i].getDegenPoint();
+        DegenPoint b = separate_vec[i].getDegenPoint();
+
+        if ( shared_vec[i].getParentGeom() != separate_vec[i].getParentGeom() ||
+             shared_vec[i].getSurfNum() != separate_vec[i].getSurfNum() ||
+             a.volWet.size() != b.volWet.size() || a.areaWet.size() != b.areaWet.size() ||
+             a.xcgSolid.size() != b.xcgSolid.size() || a.Isolid.size() != b.Isolid.size() ||
+             a.xcgShell.size() != b.xcgShell.size() || a.Ishell.size() != b.Ishell.size() )
+        {
+            num_bad++;
+            continue;
+        }
+
+        for ( int j = 0 ; j < ( int )a.volWet.size() ; j++ )
+        {
+            num_bad += !CloseRel( a.volWet[j], b.volWet[j], tol );
+        }
+        for ( int j = 0 ; j < ( int )a.areaWet.size() ; j++ )
+        {
+            num_bad += !CloseRel( a.areaWet[j], b.areaWet[j], tol );
+        }
+
+        for ( int j = 0 ; j < ( int )a.xcgSolid.size() ; j++ )
+        {
+            num_bad += dist( a.xcgSolid[j], b.xcgSolid[j] ) > tol * max( 1.0, a.xcgSolid[j].mag() );
+        }
+        for ( int j = 0 ; j < ( int )a.xcgShell.size() ; j++ )
+        {
+            num_bad += dist( a.xcgShell[j], b.xcgShell[j] ) > tol * max( 1.0, a.xcgShell[j].mag() );
+        }
+
+        for ( int j = 0 ; j < ( int )a.Isolid.size() ; j++ )
+        {
+            if ( a.Isolid[j].size() != b.Isolid[j].size() || a.Ishell[j].size() != b.Ishell[j].size() )
+            {
+                num_bad++;
+                continue;
+            }
+            for ( int k = 0 ; k < ( int )a.Isolid[j].size() ; k++ )
+            {
+                num_bad += !CloseRel( a.Isolid[j][k], b.Isolid[j][k], tol );
+            }
+            for ( int k = 0 ; k < ( int )a.Ishell[j].size() ; k++ )
+            {
+                num_bad += !CloseRel( a.Ishell[j][k], b.Ishell[j][k], tol );
+            }
+        }
+
+        // Slicing appends one entry per component, make sure it found this one
+        if ( !a.Isolid.empty() && a.Isolid.back().size() == 6 && a.Isolid.back()[0] > 0.0 )
+        {
+            num_massive++;
+        }
+    }
+    TEST_ASSERT( num_bad == 0 );
+    TEST_ASSERT( num_massive == ( int )shared_vec.size() );
+
+    printf( "\n" );
+}
+
 void APITestSuite::TestDXFExport()
 {
-    printf( "APITestSuite::TestDXFExport()\n" );
+    printf( "APITestSuite::TestDXFExport()\n" );
+
+    // make sure setup works
+    vsp::VSPCheckSetup();
+    vsp::VSPRenew();
+
+    //==== Add Wing Geom and set some parameters =====//
+    string wing_id = vsp::AddGeom( "WING" );
+    TEST_ASSERT( wing_id.c_str() != NULL );
+    TEST_ASSERT_DELTA( vsp::SetParmValUpdate(  wing_id, "TotalSpan", "WingGeom", 30.0 ), 30.0, TEST_TOL );
+    TEST_ASSERT_DELTA( vsp::SetParmValUpdate(  wing_id, "LECluster", "WingGeom", 0.0 ), 0.0, TEST_TOL );
+    TEST_ASSERT_DELTA( vsp::SetParmValUpdate(  wing_id, "TECluster", "WingGeom", 2.0 ), 2.0, TEST_TOL );
+    vsp::Update();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    //==== Add Fuselage Geom and set some parameters =====//
+    string fus_id = vsp::AddGeom( "FUSELAGE" );
+    TEST_ASSERT( fus_id.c_str() != NULL );
+    TEST_ASSERT_DELTA( vsp::SetParmValUpdate(  fus_id, "X_Rel_Location", "XForm", -9.0 ), -9.0, TEST_TOL );
+    TEST_ASSERT_DELTA( vsp::SetParmValUpdate(  fus_id, "Z_Rel_Location", "XForm", -1.0 ), -1.0, TEST_TOL );
+    vsp::Update();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    //==== Test Default 3D DXF Export =====//
+    ExportFile( "TestDXF_3D_API.dxf", vsp::SET_ALL, vsp::EXPORT_DXF );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    string geom_id = vsp::FindContainer( "Vehicle", 0 );
+
+    //==== Test Default 2D 4 View DXF Export =====//
+    TEST_ASSERT_DELTA( vsp::SetParmVal( vsp::FindParm( geom_id, "DimFlag", "DXFSettings" ), vsp::SET_2D ), vsp::SET_2D, TEST_TOL );
+    vsp::Update();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    ExportFile( "TestDXF_2D_4View_API.dxf", vsp::SET_ALL, vsp::EXPORT_DXF );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    //==== 2D 1 View DXF Export ====//
+    TEST_ASSERT_DELTA( vsp::SetParmVal( vsp::FindParm( geom_id, "ViewType", "DXFSettings" ), vsp::VIEW_1 ), vsp::VIEW_1, TEST_TOL );
+    TEST_ASSERT_DELTA( vsp::SetParmVal( vsp::FindParm( geom_id, "TopLeftView", "DXFSettings" ), vsp::VIEW_BOTTOM ), vsp::VIEW_BOTTOM, TEST_TOL );
+    TEST_ASSERT_DELTA( vsp::SetParmVal( vsp::FindParm( geom_id, "TopLeftRotation", "DXFSettings" ), vsp::ROT_90 ), vsp::ROT_90, TEST_TOL );
+    vsp::Update();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    ExportFile( "TestDXF_2D_1View_API.dxf", vsp::SET_ALL, vsp::EXPORT_DXF );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    //==== 2D 2 Horizontal View DXF Export ====//
+    TEST_ASSERT_DELTA( vsp::SetParmVal( vsp::FindParm( geom_id, "ViewType", "DXFSettings" ), vsp::VIEW_2HOR ), vsp::VIEW_2HOR, TEST_TOL );
+    TEST_ASSERT_DELTA( vsp::SetParmVal( vsp::FindParm( geom_id, "TopRightView", "DXFSettings" ), vsp::VIEW_RIGHT ), vsp::VIEW_RIGHT, TEST_TOL );
+    TEST_ASSERT_DELTA( vsp::SetParmVal( vsp::FindParm( geom_id, "TopRightRotation", "DXFSettings" ), vsp::ROT_270 ), vsp::ROT_270, TEST_TOL );
+    vsp::Update();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    ExportFile( "TestDXF_2D_2HView_API.dxf", vsp::SET_ALL, vsp::EXPORT_DXF );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    //==== 2D 2 Vertical View DXF Export ====//
+    TEST_ASSERT_DELTA( vsp::SetParmVal( vsp::FindParm( geom_id, "ViewType", "DXFSettings" ), vsp::VIEW_2VER ), vsp::VIEW_2VER, TEST_TOL );
+    TEST_ASSERT_DELTA( vsp::SetParmVal( vsp::FindParm( geom_id, "BottomLeftView", "DXFSettings" ), vsp::VIEW_REAR ), vsp::VIEW_REAR, TEST_TOL );
+    TEST_ASSERT_DELTA( vsp::SetParmVal( vsp::FindParm( geom_id, "BottomLeftRotation", "DXFSettings" ), vsp::ROT_0 ), vsp::ROT_0, TEST_TOL );
+    vsp::Update();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    ExportFile( "TestDXF_2D_2VView_API.dxf", vsp::SET_ALL, vsp::EXPORT_DXF );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    // Final check for errors
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+    printf( "\n" );
+}
+
+//==== All CFD Mesh Formats Are Written From The Same Indexed Mesh ====//
+void APITestSuite::TestCFDMeshExport()
+{
+    printf( "APITestSuite::TestCFDMeshExport()\n" );
+
+    // make sure setup works
+    vsp::VSPCheckSetup();
+    vsp::VSPRenew();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    string wing_id = vsp::AddGeom( "WING" );
+    string pod_id = vsp::AddGeom( "POD" );
+    TEST_ASSERT_DELTA( vsp::SetParmValUpdate( pod_id, "Z_Rel_Location", "XForm", 5.0 ), 5.0, TEST_TOL );   // Keep the bodies apart
+    vsp::Update();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    vsp::SetCFDMeshVal( vsp::CFD_MAX_EDGE_LEN, 0.25 );
+    vsp::SetComputationFileName( vsp::CFD_STL_TYPE, "TestCFDMesh_API.stl" );
+    vsp::SetComputationFileName( vsp::CFD_POLY_TYPE, "TestCFDMesh_API.poly" );
+    vsp::SetComputationFileName( vsp::CFD_TRI_TYPE, "TestCFDMesh_API.tri" );
+    vsp::SetComputationFileName( vsp::CFD_OBJ_TYPE, "TestCFDMesh_API.obj" );
+    vsp::SetComputationFileName( vsp::CFD_DAT_TYPE, "TestCFDMesh_API.dat" );
+    vsp::SetComputationFileName( vsp::CFD_GMSH_TYPE, "TestCFDMesh_API.msh" );
+
+    int types = vsp::CFD_STL_TYPE | vsp::CFD_POLY_TYPE | vsp::CFD_TRI_TYPE | vsp::CFD_OBJ_TYPE | vsp::CFD_DAT_TYPE | vsp::CFD_GMSH_TYPE;
+
+    vsp::ComputeCFDMesh( vsp::SET_ALL, types );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    //==== Point And Tri Counts From Each Header ====//
+    int tri_np = 0, tri_nt = 0, dat_np = 0, dat_nt = 0, poly_np = 0, msh_np = 0;
+    char line[256];
+
+    FILE* fp = fopen( "TestCFDMesh_API.tri", "r" );
+    TEST_ASSERT( fp != NULL );
+    if ( fp )
+    {
+        TEST_ASSERT( fscanf( fp, "%d %d", &tri_np, &tri_nt ) == 2 );
+        fclose( fp );
+    }
+
+    fp = fopen( "TestCFDMesh_API.dat", "r" );
+    TEST_ASSERT( fp != NULL );
+    if ( fp )
+    {
+        TEST_ASSERT( fscanf( fp, "%d %d", &dat_np, &dat_nt ) == 2 );
+        fclose( fp );
+    }
+
+    fp = fopen( "TestCFDMesh_API.poly", "r" );
+    TEST_ASSERT( fp != NULL );
+    if ( fp )
+    {
+        TEST_ASSERT( fgets( line, 255, fp ) != NULL );
+        TEST_ASSERT( fscanf( fp, "%d", &poly_np ) == 1 );
+        fclose( fp );
+    }
+
+    fp = fopen( "TestCFDMesh_API.msh", "r" );
+    TEST_ASSERT( fp != NULL );
+    if ( fp )
+    {
+        while ( fgets( line, 255, fp ) != NULL )
+        {
+            if ( strncmp( line, "$Nodes", 6 ) == 0 )
+            {
+                TEST_ASSERT( fscanf( fp, "%d", &msh_np ) == 1 );
+                break;
+            }
+        }
+        fclose( fp );
+    }
+
+    int stl_nt = 0;
+    fp = fopen( "TestCFDMesh_API.stl", "r" );
+    TEST_ASSERT( fp != NULL );
+    if ( fp )
+    {
+        while ( fgets( line, 255, fp ) != NULL )
+        {
+            if ( strstr( line, "facet normal" ) )
+            {
+                stl_nt++;
+            }
+        }
+        fclose( fp );
+    }
+
+    printf( "\t%d pnts, %d tris\n", tri_np, tri_nt );
+
+    TEST_ASSERT( tri_np > 0 && tri_nt > 0 );
+    TEST_ASSERT( dat_np == tri_np && dat_nt == tri_nt );
+    TEST_ASSERT( poly_np == tri_np );     // No wakes, so the merged and split numberings agree
+    TEST_ASSERT( msh_np == tri_np );
+    TEST_ASSERT( stl_nt == tri_nt );
+
+    // Two separate closed bodies: V - E + F = 4 with E = 3F / 2, so duplicate points would show here
+    TEST_ASSERT( tri_np - tri_nt / 2 == 4 );
+    printf( "\n" );
+}
+
+//==== Target Map Build And Rigorous Limit On A Multi-Component Vehicle ====//
+void APITestSuite::TestCFDTargetMap()
+{
+    printf( "APITestSuite::TestCFDTargetMap()\n" );
+
+    // make sure setup works
+    vsp::VSPCheckSetup();
+    vsp::VSPRenew();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    string fuse_id = vsp::AddGeom( "FUSELAGE" );
+    string wing_id = vsp::AddGeom( "WING" );
+    TEST_ASSERT_DELTA( vsp::SetParmValUpdate( wing_id, "X_Rel_Location", "XForm", 10.0 ), 10.0, TEST_TOL );
+    string htail_id = vsp::AddGeom( "WING" );
+    TEST_ASSERT_DELTA( vsp::SetParmValUpdate( htail_id, "X_Rel_Location", "XForm", 25.0 ), 25.0, TEST_TOL );
+    TEST_ASSERT_DELTA( vsp::SetParmValUpdate( htail_id, "TotalSpan", "WingGeom", 8.0 ), 8.0, TEST_TOL );
+    string pod_id = vsp::AddGeom( "POD" );
+    TEST_ASSERT_DELTA( vsp::SetParmValUpdate( pod_id, "X_Rel_Location", "XForm", 8.0 ), 8.0, TEST_TOL );
+    TEST_ASSERT_DELTA( vsp::SetParmValUpdate( pod_id, "Y_Rel_Location", "XForm", 6.0 ), 6.0, TEST_TOL );
+    TEST_ASSERT_DELTA( vsp::SetParmValUpdate( pod_id, "Z_Rel_Location", "XForm", -1.5 ), -1.5, TEST_TOL );
+    vsp::Update();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    // Dense map with rigorous limiting exercises both walk passes
+    vsp::SetCFDMeshVal( vsp::CFD_MAX_EDGE_LEN, 0.5 );
+    vsp::SetCFDMeshVal( vsp::CFD_MIN_EDGE_LEN, 0.01 );
+    vsp::SetCFDMeshVal( vsp::CFD_GROWTH_RATIO, 1.2 );
+    vsp::SetCFDMeshVal( vsp::CFD_LIMIT_GROWTH_FLAG, 1.0 );
+    vsp::SetComputationFileName( vsp::CFD_TRI_TYPE, "TestCFDTargetMap_API.tri" );
+
+    vsp::ComputeCFDMesh( vsp::SET_ALL, vsp::CFD_TRI_TYPE );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    string res_id = vsp::FindLatestResultsID( "CFD_Target_Map" );
+    TEST_ASSERT( res_id.size() > 0 );
+
+    int nsurf = vsp::GetIntResults( res_id, "Num_Surfs" )[0];
+    int ncell = vsp::GetIntResults( res_id, "Num_Map_Cells" )[0];
+    const vector< double > & surf_time = vsp::GetDoubleResults( res_id, "Surf_Time" );
+    const vector< int > & surf_stack = vsp::GetIntResults( res_id, "Surf_Peak_Stack" );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    TEST_ASSERT( nsurf > 4 );
+    TEST_ASSERT( ( int )surf_time.size() == nsurf );
+    TEST_ASSERT( ( int )surf_stack.size() == nsurf );
+
+    int max_stack = 0;
+    for ( int i = 0 ; i < nsurf ; i++ )
+    {
+        max_stack = max( max_stack, surf_stack[i] );
+        TEST_ASSERT( surf_stack[i] > 0 );
+    }
+
+    // Walk state is heap allocated, the call stack no longer grows with the map
+    printf( "\t%d surfs, %d map cells, peak walk stack %d entries (%d bytes)\n", nsurf, ncell, max_stack, max_stack * ( int )sizeof( int ) );
+    printf( "\n" );
+}
+
+//==== Intersection Point Binning And Chain Broad Phase On A Many Component Model ====//
+void APITestSuite::TestCFDIntersectBroadPhase()
+{
+    printf( "APITestSuite::TestCFDIntersectBroadPhase()\n" );
+
+    // make sure setup works
+    vsp::VSPCheckSetup();
+    vsp::VSPRenew();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    string wing_id = vsp::AddGeom( "WING" );
+    TEST_ASSERT_DELTA( vsp::SetParmValUpdate( wing_id, "TotalSpan", "WingGeom", 30.0 ), 30.0, TEST_TOL );
+
+    // Pods pierce the wing along the span, each one adds its own intersection chains
+    int npod = 12;
+    for ( int i = 0 ; i < npod ; i++ )
+    {
+        string pod_id = vsp::AddGeom( "POD" );
+        double y = -13.0 + 26.0 * i / ( double )( npod - 1 );
+        vsp::SetParmVal( pod_id, "X_Rel_Location", "XForm", -2.0 );
+        vsp::SetParmVal( pod_id, "Y_Rel_Location", "XForm", y );
+        vsp::SetParmVal( pod_id, "Length", "Design", 6.0 );
+        vsp::SetParmVal( pod_id, "FineRatio", "Design", 8.0 );
+    }
+    vsp::Update();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    vsp::SetCFDMeshVal( vsp::CFD_MAX_EDGE_LEN, 1.0 );
+    vsp::SetComputationFileName( vsp::CFD_TRI_TYPE, "TestCFDBroadPhase_API.tri" );
+
+    vsp::ComputeCFDMesh( vsp::SET_ALL, vsp::CFD_TRI_TYPE );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    string res_id = vsp::FindLatestResultsID( "CFD_Intersect" );
+    TEST_ASSERT( res_id.size() > 0 );
+
+    int nbin = vsp::GetIntResults( res_id, "Num_IPnt_Bins" )[0];
+    int nchain = vsp::GetIntResults( res_id, "Num_Chains" )[0];
+    double ncompare = vsp::GetDoubleResults( res_id, "Num_IPnt_Compares" )[0];
+    double npair = vsp::GetDoubleResults( res_id, "Num_Chain_Pairs" )[0];
+    double ncand = vsp::GetDoubleResults( res_id, "Num_Chain_Candidates" )[0];
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    // Every pod crosses the wing, so there are at least two chains per pod
+    TEST_ASSERT( nchain >= 2 * npod );
+    TEST_ASSERT( nbin > 0 );
+    TEST_ASSERT( ncand <= npair );
+
+    printf( "\t%d IPnt bins, %.0f IPnt compares\n", nbin, ncompare );
+    printf( "\t%d chains, %.0f chain pairs before broad phase, %.0f after\n", nchain, npair, ncand );
+
+    //==== Mesh Written ====//
+    int tri_np = 0, tri_nt = 0;
+    FILE* fp = fopen( "TestCFDBroadPhase_API.tri", "r" );
+    TEST_ASSERT( fp != NULL );
+    if ( fp )
+    {
+        TEST_ASSERT( fscanf( fp, "%d %d", &tri_np, &tri_nt ) == 2 );
+        fclose( fp );
+    }
+    TEST_ASSERT( tri_np > 0 && tri_nt > 0 );
+    printf( "\n" );
+}
+
+//==== Hashed Border Curve Matching Gives The Same ICurves As The All Pairs Loop ====//
+void APITestSuite::TestCFDBorderCurveMatch()
+{
+    printf( "APITestSuite::TestCFDBorderCurveMatch()\n" );
+
+    // make sure setup works
+    vsp::VSPCheckSetup();
+    vsp::VSPRenew();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    // Mirrored wings and pods on a grid give a few dozen surfaces
+    for ( int i = 0 ; i < 20 ; i++ )
+    {
+        string wing_id = vsp::AddGeom( "WING" );
+        vsp::SetParmVal( wing_id, "X_Rel_Location", "XForm", 8.0 * ( i % 10 ) );
+        vsp::SetParmVal( wing_id, "Z_Rel_Location", "XForm", 4.0 * ( i / 10 ) );
+    }
+    for ( int i = 0 ; i < 10 ; i++ )
+    {
+        string pod_id = vsp::AddGeom( "POD" );
+        vsp::SetParmVal( pod_id, "X_Rel_Location", "XForm", 16.0 * ( i % 5 ) );
+        vsp::SetParmVal( pod_id, "Y_Rel_Location", "XForm", 20.0 );
+        vsp::SetParmVal( pod_id, "Z_Rel_Location", "XForm", 4.0 * ( i / 5 ) );
+    }
+    vsp::Update();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    //==== Mesh Setup Through BuildGrid ====//
+    CfdMeshMgr.GetCfdSettingsPtr()->m_SelectedSetIndex = vsp::SET_ALL;
+
+    vector< XferSurf > xfersurfs;
+    CfdMeshMgr.FetchSurfs( xfersurfs );
+    CfdMeshMgr.CleanUp();
+    CfdMeshMgr.LoadSurfs( xfersurfs );
+    CfdMeshMgr.CleanMergeSurfs();
+    CfdMeshMgr.UpdateSourcesAndWakes();
+
+    CfdMeshMgr.BuildGrid();
+
+    int nsurf = CfdMeshMgr.GetNumSurfs();
+    TEST_ASSERT( nsurf >= 40 );
+
+    vector< SCurve* > scurve_vec;
+    for ( int i = 0 ; i < nsurf ; i++ )
+    {
+        CfdMeshMgr.GetSurf( i )->LoadSCurves( scurve_vec );
+    }
+    int ncrv = ( int )scurve_vec.size();
+
+    map< SCurve*, int > crv_index;
+    for ( int i = 0 ; i < ncrv ; i++ )
+    {
+        crv_index[ scurve_vec[i] ] = i;
+    }
+
+    //==== Matched Pairs In Creation Order ====//
+    vector< pair< int, int > > hash_pairs;
+    vector< ICurve* > icurve_vec = CfdMeshMgr.GetICurveVec();
+    for ( int i = 0 ; i < ( int )icurve_vec.size() ; i++ )
+    {
+        if ( icurve_vec[i]->m_SCurve_A && icurve_vec[i]->m_SCurve_B )
+        {
+            hash_pairs.push_back( make_pair( crv_index[ icurve_vec[i]->m_SCurve_A ], crv_index[ icurve_vec[i]->m_SCurve_B ] ) );
+        }
+    }
+
+    //==== Brute Force - Same Test As ICurve::Match Without Side Effects ====//
+    vector< Bezier_curve > fwd_vec( ncrv ), bkwd_vec( ncrv );
+    for ( int i = 0 ; i < ncrv ; i++ )
+    {
+        fwd_vec[i] = scurve_vec[i]->GetUWCrv();
+        fwd_vec[i].UWCurveToXYZCurve( scurve_vec[i]->GetSurf() );
+        bkwd_vec[i] = fwd_vec[i];
+        bkwd_vec[i].FlipCurve();
+    }
+
+    vector< pair< int, int > > brute_pairs;
+    for ( int i = 0 ; i < ncrv ; i++ )
+    {
+        for ( int j = i + 1 ; j < ncrv ; j++ )
+        {
+            if ( fwd_vec[i].MatchFwd( fwd_vec[j], ICurve::GetMatchTol() ) || fwd_vec[i].MatchFwd( bkwd_vec[j], ICurve::GetMatchTol() ) )
+            {
+                brute_pairs.push_back( make_pair( i, j ) );
+            }
+        }
+    }
+
+    printf( "\t%d surfs, %d SCurves, %d matched pairs\n", nsurf, ncrv, ( int )hash_pairs.size() );
+
+    TEST_ASSERT( hash_pairs.size() > 0 );
+    TEST_ASSERT( hash_pairs == brute_pairs );
+
+    CfdMeshMgr.CleanUp();
+    printf( "\n" );
+}
+
+//==== Byte For Byte Comparison of Two Files ====//
+static bool FilesMatch( const char* fn_a, const char* fn_b )
+{
+    FILE* fa = fopen( fn_a, "rb" );
+    FILE* fb = fopen( fn_b, "rb" );
+    bool match = ( fa != NULL && fb != NULL );
+
+    vector< char > buf_a( 1 << 16 ), buf_b( 1 << 16 );
+    while ( match )
+    {
+        size_t na = fread( &buf_a[0], 1, buf_a.size(), fa );
+        size_t nb = fread( &buf_b[0], 1, buf_b.size(), fb );
+        if ( na != nb || memcmp( &buf_a[0], &buf_b[0], na ) != 0 )
+        {
+            match = false;
+        }
+        if ( na == 0 )
+        {
+            break;
+        }
+    }
+
+    if ( fa )
+    {
+        fclose( fa );
+    }
+    if ( fb )
+    {
+        fclose( fb );
+    }
+    return match;
+}
+
+//==== Wing Box Panel - Alternating CQUAD8 and Pairs of CTRIA6 ====//
+// Coordinates span all three NASTRAN GRID field widths
+static void BuildFEAPanel( int nu, int nv, vector< FeaNode* > & node_vec, vector< FeaElement* > & elem_vec )
+{
+    int nnu = 2 * nu + 1;
+    int nnv = 2 * nv + 1;
+
+    node_vec.resize( nnu * nnv );
+    for ( int i = 0 ; i < nnu ; i++ )
+    {
+        for ( int j = 0 ; j < nnv ; j++ )
+        {
+            vec3d p( 150.0 * i / ( nnu - 1 ), 40.0 * j / ( nnv - 1 ), -0.3 + 0.01 * sin( 0.01 * i ) );
+            FeaNode* node = new FeaNode( p );
+            node->m_Index = i * nnv + j + 1;
+            node_vec[ i * nnv + j ] = node;
+        }
+    }
+
+    elem_vec.clear();
+    for ( int i = 0 ; i < nu ; i++ )
+    {
+        for ( int j = 0 ; j < nv ; j++ )
+        {
+            int i0 = 2 * i;
+            int j0 = 2 * j;
+            FeaNode* n00 = node_vec[ i0 * nnv + j0 ];
+            FeaNode* n20 = node_vec[ ( i0 + 2 ) * nnv + j0 ];
+            FeaNode* n22 = node_vec[ ( i0 + 2 ) * nnv + j0 + 2 ];
+            FeaNode* n02 = node_vec[ i0 * nnv + j0 + 2 ];
+            FeaNode* n10 = node_vec[ ( i0 + 1 ) * nnv + j0 ];
+            FeaNode* n21 = node_vec[ ( i0 + 2 ) * nnv + j0 + 1 ];
+            FeaNode* n12 = node_vec[ ( i0 + 1 ) * nnv + j0 + 2 ];
+            FeaNode* n01 = node_vec[ i0 * nnv + j0 + 1 ];
+            FeaNode* n11 = node_vec[ ( i0 + 1 ) * nnv + j0 + 1 ];
+
+            if ( ( i + j ) % 2 == 0 )
+            {
+                FeaQuad* quad = new FeaQuad();
+                quad->m_Corners.push_back( n00 );
+                quad->m_Corners.push_back( n20 );
+                quad->m_Corners.push_back( n22 );
+                quad->m_Corners.push_back( n02 );
+                quad->m_Mids.push_back( n10 );
+                quad->m_Mids.push_back( n21 );
+                quad->m_Mids.push_back( n12 );
+                quad->m_Mids.push_back( n01 );
+                elem_vec.push_back( quad );
+            }
+            else
+            {
+                FeaTri* tri0 = new FeaTri();
+                tri0->m_Corners.push_back( n00 );
+                tri0->m_Corners.push_back( n20 );
+                tri0->m_Corners.push_back( n22 );
+                tri0->m_Mids.push_back( n10 );
+                tri0->m_Mids.push_back( n21 );
+                tri0->m_Mids.push_back( n11 );
+                elem_vec.push_back( tri0 );
+
+                FeaTri* tri1 = new FeaTri();
+                tri1->m_Corners.push_back( n00 );
+                tri1->m_Corners.push_back( n22 );
+                tri1->m_Corners.push_back( n02 );
+                tri1->m_Mids.push_back( n11 );
+                tri1->m_Mids.push_back( n12 );
+                tri1->m_Mids.push_back( n01 );
+                elem_vec.push_back( tri1 );
+            }
+        }
+    }
+}
+
+//==== Elements Share Nodes, Delete Each Once ====//
+static void DeleteFEAPanel( vector< FeaNode* > & node_vec, vector< FeaElement* > & elem_vec )
+{
+    for ( int e = 0 ; e < ( int )elem_vec.size() ; e++ )
+    {
+        delete elem_vec[e];
+    }
+    for ( int n = 0 ; n < ( int )node_vec.size() ; n++ )
+    {
+        delete node_vec[n];
+    }
+    elem_vec.clear();
+    node_vec.clear();
+}
+
+//==== Write Panel One Card At A Time ====//
+static bool WriteFEAPanelSerial( const char* fn, const vector< FeaNode* > & node_vec, const vector< FeaElement* > & elem_vec, int format )
+{
+    FILE* fp = fopen( fn, "w" );
+    if ( !fp )
+    {
+        return false;
+    }
+
+    for ( int e = 0 ; e < ( int )elem_vec.size() ; e++ )
+    {
+        if ( format == FEA_NASTRAN_CARDS )
+        {
+            elem_vec[e]->WriteNASTRAN( fp, e + 1 );
+        }
+        else
+        {
+            elem_vec[e]->WriteCalculix( fp, e + 1 );
+        }
+    }
+    for ( int n = 0 ; n < ( int )node_vec.size() ; n++ )
+    {
+        if ( format == FEA_NASTRAN_CARDS )
+        {
+            node_vec[n]->WriteNASTRAN( fp );
+        }
+        else
+        {
+            node_vec[n]->WriteCalculix( fp );
+        }
+    }
+    fclose( fp );
+    return true;
+}
+
+//==== Write Panel With The Chunked Writers ====//
+static bool WriteFEAPanelChunked( const char* fn, const vector< FeaNode* > & node_vec, const vector< FeaElement* > & elem_vec, int format, int chunk_size )
+{
+    FILE* fp = fopen( fn, "w" );
+    if ( !fp )
+    {
+        return false;
+    }
+
+    WriteFeaElements( fp, elem_vec, 1, format, chunk_size );
+    WriteFeaNodes( fp, node_vec, format, chunk_size );
+    fclose( fp );
+    return true;
+}
+
+//==== Chunked FEA Card Writers Match The Serial Card Writers ====//
+void APITestSuite::TestFEAExportWriters()
+{
+    printf( "APITestSuite::TestFEAExportWriters()\n" );
+
+    vector< FeaNode* > node_vec;
+    vector< FeaElement* > elem_vec;
+    BuildFEAPanel( 6, 4, node_vec, elem_vec );
+    TEST_ASSERT( node_vec.size() == 117 );
+    TEST_ASSERT( elem_vec.size() == 36 );
+
+    //==== Cards Keep Their Format ====//
+    string str;
+    node_vec[0]->WriteNASTRAN( str );
+    node_vec.back()->WriteNASTRAN( str );
+    TEST_ASSERT( str == "GRID,1,, 0.00000, 0.00000,-0.30000\nGRID,117,, 150.000, 40.0000,-0.29880\n" );
+    str.clear();
+    node_vec[0]->WriteCalculix( str );
+    TEST_ASSERT( str == "1,0.000000,0.000000,-0.300000\n" );
+    str.clear();
+    elem_vec[0]->WriteNASTRAN( str, 1 );
+    elem_vec[1]->WriteNASTRAN( str, 2 );
+    TEST_ASSERT( str == "CQUAD8,1,1,1,19,21,3,10,20,+\n+,12,2\nCTRIA6,2,1,3,21,23,12,22,13\n" );
+    str.clear();
+    elem_vec[0]->WriteCalculix( str, 1 );
+    TEST_ASSERT( str == "1,1,19,21,3,10,20,12,2\n" );
+
+    //==== Small Chunks So Several Chunks And Blocks Are Written ====//
+    const char* serial_fn[2] = { "TestFEAExport_Serial_NASTRAN.dat", "TestFEAExport_Serial_Calculix.dat" };
+    const char* chunk_fn[2] = { "TestFEAExport_Chunked_NASTRAN.dat", "TestFEAExport_Chunked_Calculix.dat" };
+    int format[2] = { FEA_NASTRAN_CARDS, FEA_CALCULIX_CARDS };
+    int chunk_size[3] = { 1, 7, 4096 };
+
+    for ( int f = 0 ; f < 2 ; f++ )
+    {
+        TEST_ASSERT( WriteFEAPanelSerial( serial_fn[f], node_vec, elem_vec, format[f] ) );
+        for ( int c = 0 ; c < 3 ; c++ )
+        {
+            TEST_ASSERT( WriteFEAPanelChunked( chunk_fn[f], node_vec, elem_vec, format[f], chunk_size[c] ) );
+            TEST_ASSERT( FilesMatch( serial_fn[f], chunk_fn[f] ) );
+        }
+
+        remove( serial_fn[f] );
+        remove( chunk_fn[f] );
+    }
+
+    DeleteFEAPanel( node_vec, elem_vec );
+    printf( "\n" );
+}
+
+//==== Million Element Panel - Serial And Chunked Card Writers ====//
+void APIBenchmarkSuite::BenchFEAExportWriters()
+{
+    printf( "APIBenchmarkSuite::BenchFEAExportWriters()\n" );
+
+    vector< FeaNode* > node_vec;
+    vector< FeaElement* > elem_vec;
+    BuildFEAPanel( 1000, 667, node_vec, elem_vec );
+    printf( "\t%d nodes, %d elements\n", ( int )node_vec.size(), ( int )elem_vec.size() );
+
+    const char* serial_fn[2] = { "BenchFEAExport_Serial_NASTRAN.dat", "BenchFEAExport_Serial_Calculix.dat" };
+    const char* chunk_fn[2] = { "BenchFEAExport_Chunked_NASTRAN.dat", "BenchFEAExport_Chunked_Calculix.dat" };
+    const char* format_name[2] = { "NASTRAN", "Calculix" };
+    int format[2] = { FEA_NASTRAN_CARDS, FEA_CALCULIX_CARDS };
+
+    for ( int f = 0 ; f < 2 ; f++ )
+    {
+        std::chrono::high_resolution_clock::time_point t0 = std::chrono::high_resolution_clock::now();
+        TEST_ASSERT( WriteFEAPanelSerial( serial_fn[f], node_vec, elem_vec, format[f] ) );
+        std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+        TEST_ASSERT( WriteFEAPanelChunked( chunk_fn[f], node_vec, elem_vec, format[f], 4096 ) );
+        std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
+
+        TEST_ASSERT( FilesMatch( serial_fn[f], chunk_fn[f] ) );
+
+        printf( "\t%s serial: %f sec, chunked: %f sec\n", format_name[f],
+                std::chrono::duration< double >( t1 - t0 ).count(), std::chrono::duration< double >( t2 - t1 ).count() );
+
+        remove( serial_fn[f] );
+        remove( chunk_fn[f] );
+    }
+
+    DeleteFEAPanel( node_vec, elem_vec );
+    printf( "\n" );
+}
+
+//==== Byte Code Cache Round Trip and Repeated Script Execution ====//
+void APITestSuite::TestScriptCache()
+{
+    printf( "APITestSuite::TestScriptCache()\n" );
 
     // make sure setup works
     vsp::VSPCheckSetup();
     vsp::VSPRenew();
-
-    //==== Add Wing Geom and set some parameters =====//
-    string wing_id = vsp::AddGeom( "WING" );
-    TEST_ASSERT( wing_id.c_str() != NULL );
-    TEST_ASSERT_DELTA( vsp::SetParmValUpdate(  wing_id, "TotalSpan", "WingGeom", 30.0 ), 30.0, TEST_TOL );
-    TEST_ASSERT_DELTA( vsp::SetParmValUpdate(  wing_id, "LECluster", "WingGeom", 0.0 ), 0.0, TEST_TOL );
-    TEST_ASSERT_DELTA( vsp::SetParmValUpdate(  wing_id, "TECluster", "WingGeom", 2.0 ), 2.0, TEST_TOL );
-    vsp::Update();
     TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
 
-    //==== Add Fuselage Geom and set some parameters =====//
-    string fus_id = vsp::AddGeom( "FUSELAGE" );
-    TEST_ASSERT( fus_id.c_str() != NULL );
-    TEST_ASSERT_DELTA( vsp::SetParmValUpdate(  fus_id, "X_Rel_Location", "XForm", -9.0 ), -9.0, TEST_TOL );
-    TEST_ASSERT_DELTA( vsp::SetParmValUpdate(  fus_id, "Z_Rel_Location", "XForm", -1.0 ), -1.0, TEST_TOL );
-    vsp::Update();
-    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+    // Check throws an out of range exception if the tick count is wrong
+    string content;
+    content.append( "int g_Count = 0;\n" );
+    content.append( "double g_Sum = 0.0;\n" );
+    content.append( "void UpdateSurf()\n" );
+    content.append( "{\n" );
+    content.append( "    g_Count++;\n" );
+    content.append( "    g_Sum += sqrt( double( g_Count ) );\n" );
+    content.append( "}\n" );
+    content.append( "void Check( double n )\n" );
+    content.append( "{\n" );
+    content.append( "    array< int > a;\n" );
+    content.append( "    if ( g_Count != int( n ) ) { a[1] = 0; }\n" );
+    content.append( "}\n" );
+    // Pad the module so the byte code holds more than the two entry points
+    for ( int i = 0 ; i < 20 ; i++ )
+    {
+        char str[256];
+        sprintf( str, "double Pad%d( double x ) { double y = x; for ( int i = 0 ; i < %d ; i++ ) { y = y * 0.5 + sqrt( y + i ); } return y; }\n", i, i );
+        content.append( str );
+    }
 
-    //==== Test Default 3D DXF Export =====//
-    ExportFile( "TestDXF_3D_API.dxf", vsp::SET_ALL, vsp::EXPORT_DXF );
-    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+    string old_dir = ScriptMgr.GetByteCodeCacheDir();
+    ScriptMgr.SetByteCodeCacheDir( "./" );
+    string bc_file = ScriptMgr.GetByteCodeFileName( content );
+    remove( bc_file.c_str() );
 
-    string geom_id = vsp::FindContainer( "Vehicle", 0 );
+    //==== Compile From Source and Save Byte Code ====//
+    string module_name = ScriptMgr.ReadScriptFromMemory( "TestScriptCache", content );
+    TEST_ASSERT( module_name.size() > 0 );
+    TEST_ASSERT( !ScriptMgr.GetLastLoadFromByteCode() );
 
-    //==== Test Default 2D 4 View DXF Export =====//
-    TEST_ASSERT_DELTA( vsp::SetParmVal( vsp::FindParm( geom_id, "DimFlag", "DXFSettings" ), vsp::SET_2D ), vsp::SET_2D, TEST_TOL );
-    vsp::Update();
-    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+    FILE* fp = fopen( bc_file.c_str(), "rb" );
+    TEST_ASSERT( fp != NULL );
+    if ( fp )
+    {
+        fclose( fp );
+    }
 
-    ExportFile( "TestDXF_2D_4View_API.dxf", vsp::SET_ALL, vsp::EXPORT_DXF );
-    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+    //==== Same Content Returns Same Module ====//
+    TEST_ASSERT( ScriptMgr.ReadScriptFromMemory( "TestScriptCacheDup", content ) == module_name );
 
-    //==== 2D 1 View DXF Export ====//
-    TEST_ASSERT_DELTA( vsp::SetParmVal( vsp::FindParm( geom_id, "ViewType", "DXFSettings" ), vsp::VIEW_1 ), vsp::VIEW_1, TEST_TOL );
-    TEST_ASSERT_DELTA( vsp::SetParmVal( vsp::FindParm( geom_id, "TopLeftView", "DXFSettings" ), vsp::VIEW_BOTTOM ), vsp::VIEW_BOTTOM, TEST_TOL );
-    TEST_ASSERT_DELTA( vsp::SetParmVal( vsp::FindParm( geom_id, "TopLeftRotation", "DXFSettings" ), vsp::ROT_90 ), vsp::ROT_90, TEST_TOL );
-    vsp::Update();
-    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+    //==== Reload From Byte Code ====//
+    TEST_ASSERT( ScriptMgr.RemoveScript( module_name ) );
+    module_name = ScriptMgr.ReadScriptFromMemory( "TestScriptCache", content );
+    TEST_ASSERT( module_name.size() > 0 );
+    TEST_ASSERT( ScriptMgr.GetLastLoadFromByteCode() );
 
-    ExportFile( "TestDXF_2D_1View_API.dxf", vsp::SET_ALL, vsp::EXPORT_DXF );
-    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+    //==== Repeated Updates Through Pooled Contexts and Cached Handles ====//
+    int nupdate = 100;
+    bool success = true;
+    for ( int i = 0 ; i < nupdate ; i++ )
+    {
+        success = ScriptMgr.ExecuteScript( module_name.c_str(), "void UpdateSurf()" ) && success;
+    }
+    TEST_ASSERT( success );
+    TEST_ASSERT( ScriptMgr.ExecuteScript( module_name.c_str(), "void Check(double n)", true, nupdate ) );
+    TEST_ASSERT( !ScriptMgr.ExecuteScript( module_name.c_str(), "void Check(double n)", true, nupdate + 1 ) );
+    TEST_ASSERT( !ScriptMgr.ExecuteScript( module_name.c_str(), "void Missing()" ) );
+
+    //==== Byte Code From Another Interface Is Pruned, Byte Code In Use Is Kept ====//
+    string stale_file = "./StaleInterfaceTest.vspbc";
+    fp = fopen( stale_file.c_str(), "wb" );
+    TEST_ASSERT( fp != NULL );
+    if ( fp )
+    {
+        fputs( "stale", fp );
+        fclose( fp );
+    }
+    TEST_ASSERT( ScriptMgr.PruneByteCodeCache() >= 1 );
+    fp = fopen( stale_file.c_str(), "rb" );
+    TEST_ASSERT( fp == NULL );
+    if ( fp )
+    {
+        fclose( fp );
+    }
+    fp = fopen( bc_file.c_str(), "rb" );
+    TEST_ASSERT( fp != NULL );
 
-    //==== 2D 2 Horizontal View DXF Export ====//
-    TEST_ASSERT_DELTA( vsp::SetParmVal( vsp::FindParm( geom_id, "ViewType", "DXFSettings" ), vsp::VIEW_2HOR ), vsp::VIEW_2HOR, TEST_TOL );
-    TEST_ASSERT_DELTA( vsp::SetParmVal( vsp::FindParm( geom_id, "TopRightView", "DXFSettings" ), vsp::VIEW_RIGHT ), vsp::VIEW_RIGHT, TEST_TOL );
-    TEST_ASSERT_DELTA( vsp::SetParmVal( vsp::FindParm( geom_id, "TopRightRotation", "DXFSettings" ), vsp::ROT_270 ), vsp::ROT_270, TEST_TOL );
-    vsp::Update();
-    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+    //==== Header For Another Interface Falls Back To A Rebuild ====//
+    if ( fp )
+    {
+        char tag[8];
+        unsigned long long engine_hash = 0;
+        TEST_ASSERT( fread( tag, 1, 8, fp ) == 8 );
+        TEST_ASSERT( fread( &engine_hash, sizeof( engine_hash ), 1, fp ) == 1 );
+        fclose( fp );
+
+        engine_hash++;
+        fp = fopen( bc_file.c_str(), "r+b" );
+        TEST_ASSERT( fp != NULL );
+        if ( fp )
+        {
+            fseek( fp, 8, SEEK_SET );
+            fwrite( &engine_hash, sizeof( engine_hash ), 1, fp );
+            fclose( fp );
+        }
 
-    ExportFile( "TestDXF_2D_2HView_API.dxf", vsp::SET_ALL, vsp::EXPORT_DXF );
+        TEST_ASSERT( ScriptMgr.RemoveScript( module_name ) );
+        module_name = ScriptMgr.ReadScriptFromMemory( "TestScriptCache", content );
+        TEST_ASSERT( module_name.size() > 0 );
+        TEST_ASSERT( !ScriptMgr.GetLastLoadFromByteCode() );
+        TEST_ASSERT( ScriptMgr.ExecuteScript( module_name.c_str(), "void Check(double n)", true, 0 ) );
+    }
+
+    ScriptMgr.RemoveScript( module_name );
+    remove( bc_file.c_str() );
+    ScriptMgr.SetByteCodeCacheDir( old_dir );
+    printf( "\n" );
+}
+
+
+//==== Part 21 Data Section As Entity Id To Entity Text ====//
+static bool ReadSTEPEntities( const char* fn, map< int, string > & ents )
+{
+    FILE* fp = fopen( fn, "r" );
+    if ( !fp )
+    {
+        return false;
+    }
+
+    string all;
+    char buf[4096];
+    size_t n;
+    while ( ( n = fread( buf, 1, sizeof( buf ), fp ) ) > 0 )
+    {
+        all.append( buf, n );
+    }
+    fclose( fp );
+
+    size_t pos = all.find( "DATA;" );
+    if ( pos == string::npos )
+    {
+        return false;
+    }
+    pos += 5;
+
+    // Entity text never contains ';', so statements split cleanly
+    ents.clear();
+    while ( pos < all.size() )
+    {
+        size_t end = all.find( ';', pos );
+        if ( end == string::npos )
+        {
+            break;
+        }
+
+        string stmt;
+        for ( size_t i = pos ; i < end ; i++ )
+        {
+            if ( all[i] != '\n' && all[i] != '\r' )
+            {
+                stmt.push_back( all[i] );
+            }
+        }
+        pos = end + 1;
+
+        size_t start = stmt.find_first_not_of( " \t" );
+        if ( start == string::npos || stmt[start] != '#' )
+        {
+            continue;
+        }
+        size_t eq = stmt.find( '=', start );
+        if ( eq == string::npos )
+        {
+            continue;
+        }
+        ents[ atoi( stmt.c_str() + start + 1 ) ] = stmt.substr( eq + 1 );
+    }
+    return true;
+}
+
+static string STEPEntityType( const string & ent )
+{
+    size_t start = ent.find_first_not_of( " \t" );
+    size_t paren = ent.find( '(' );
+    if ( start == string::npos || paren == string::npos || paren < start )
+    {
+        return string();
+    }
+    return ent.substr( start, paren - start );
+}
+
+//==== B-Spline Surfaces Resolved To Control Point Coordinates ====//
+struct STEPTestSurf
+{
+    int m_UDeg;
+    int m_VDeg;
+    int m_NRow;
+    string m_Flags;
+    vector< vec3d > m_Pnts;
+};
+
+static void ResolveSTEPSurfs( const map< int, string > & ents, vector< STEPTestSurf > & surfs, int & npnt )
+{
+    surfs.clear();
+    npnt = 0;
+
+    map< int, vec3d > pnts;
+    map< int, string >::const_iterator it;
+    for ( it = ents.begin() ; it != ents.end() ; ++it )
+    {
+        if ( STEPEntityType( it->second ) == "CARTESIAN_POINT" )
+        {
+            string body;
+            for ( size_t i = 0 ; i < it->second.size() ; i++ )
+            {
+                if ( it->second[i] != ' ' )
+                {
+                    body.push_back( it->second[i] );
+                }
+            }
+            double x = 0, y = 0, z = 0;
+            sscanf( body.c_str() + body.rfind( '(' ) + 1, "%lf,%lf,%lf", &x, &y, &z );
+            pnts[ it->first ] = vec3d( x, y, z );
+            npnt++;
+        }
+    }
+
+    for ( it = ents.begin() ; it != ents.end() ; ++it )
+    {
+        if ( STEPEntityType( it->second ) != "B_SPLINE_SURFACE_WITH_KNOTS" )
+        {
+            continue;
+        }
+
+        string body;
+        for ( size_t i = 0 ; i < it->second.size() ; i++ )
+        {
+            if ( it->second[i] != ' ' )
+            {
+                body.push_back( it->second[i] );
+            }
+        }
+
+        STEPTestSurf surf;
+        surf.m_UDeg = surf.m_VDeg = surf.m_NRow = 0;
+        sscanf( body.c_str() + body.find( '(' ) + 1, "'',%d,%d", &surf.m_UDeg, &surf.m_VDeg );
+
+        size_t cp_start = body.find( "((" );
+        size_t cp_end = body.find( "))", cp_start );
+        for ( size_t i = cp_start ; i < cp_end ; i++ )
+        {
+            if ( body[i] == '(' && body[i + 1] == '#' )
+            {
+                surf.m_NRow++;
+            }
+            if ( body[i] == '#' )
+            {
+                surf.m_Pnts.push_back( pnts[ atoi( body.c_str() + i + 1 ) ] );
+            }
+        }
+
+        // Surface form, closed flags and self intersect
+        size_t flag_start = cp_end + 3;
+        size_t flag_end = flag_start;
+        for ( int k = 0 ; k < 4 ; k++ )
+        {
+            flag_end = body.find( ',', flag_end ) + 1;
+        }
+        surf.m_Flags = body.substr( flag_start, flag_end - flag_start );
+
+        surfs.push_back( surf );
+    }
+}
+
+//==== Streaming STEP Writer Matches The SDAI Writer ====//
+void APITestSuite::TestSTEPStreamWriter()
+{
+    printf( "APITestSuite::TestSTEPStreamWriter()\n" );
+
+    // make sure setup works
+    vsp::VSPCheckSetup();
+    vsp::VSPRenew();
     TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
 
-    //==== 2D 2 Vertical View DXF Export ====//
-    TEST_ASSERT_DELTA( vsp::SetParmVal( vsp::FindParm( geom_id, "ViewType", "DXFSettings" ), vsp::VIEW_2VER ), vsp::VIEW_2VER, TEST_TOL );
-    TEST_ASSERT_DELTA( vsp::SetParmVal( vsp::FindParm( geom_id, "BottomLeftView", "DXFSettings" ), vsp::VIEW_REAR ), vsp::VIEW_REAR, TEST_TOL );
-    TEST_ASSERT_DELTA( vsp::SetParmVal( vsp::FindParm( geom_id, "BottomLeftRotation", "DXFSettings" ), vsp::ROT_0 ), vsp::ROT_0, TEST_TOL );
+    //==== Many Section Wings and Fuselages ====//
+    for ( int i = 0 ; i < 6 ; i++ )
+    {
+        string wing_id = vsp::AddGeom( "WING" );
+        for ( int k = 0 ; k < 8 ; k++ )
+        {
+            vsp::InsertXSec( wing_id, 1, vsp::XS_FOUR_SERIES );
+        }
+        TEST_ASSERT_DELTA( vsp::SetParmValUpdate( wing_id, "X_Rel_Location", "XForm", 10.0 * i ), 10.0 * i, TEST_TOL );
+
+        string fuse_id = vsp::AddGeom( "FUSELAGE" );
+        TEST_ASSERT_DELTA( vsp::SetParmValUpdate( fuse_id, "Z_Rel_Location", "XForm", 5.0 * i ), 5.0 * i, TEST_TOL );
+    }
     vsp::Update();
     TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
 
-    ExportFile( "TestDXF_2D_2VView_API.dxf", vsp::SET_ALL, vsp::EXPORT_DXF );
-    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+    Vehicle* veh = VehicleMgr.GetVehicle();
+    vector< VspSurf > surf_vec;
+    vector< Geom* > geom_vec = veh->FindGeomVec( veh->GetGeomVec( false ) );
+    for ( int i = 0 ; i < ( int )geom_vec.size() ; i++ )
+    {
+        vector< VspSurf > gsurf_vec;
+        geom_vec[i]->GetSurfVec( gsurf_vec );
+        surf_vec.insert( surf_vec.end(), gsurf_vec.begin(), gsurf_vec.end() );
+    }
+    TEST_ASSERT( surf_vec.size() > 12 );
 
-    // Final check for errors
-    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+    string sdai_file = "TestSTEPStreamWriter_SDAI.stp";
+    string stream_file = "TestSTEPStreamWriter_Stream.stp";
+    string export_file = "TestSTEPStreamWriter_Export.stp";
+
+    //==== SDAI Instance Graph Writer ====//
+    {
+        STEPutil step( vsp::LEN_FT, 1e-6 );
+        for ( int i = 0 ; i < ( int )surf_vec.size() ; i++ )
+        {
+            step.AddSurf( &surf_vec[i], true, true, false, 1e-6 );
+        }
+        step.WriteFile( sdai_file );
+    }
+
+    //==== Streaming Writer ====//
+    int nent;
+    {
+        STEPStreamWriter step( vsp::LEN_FT, 1e-6 );
+        TEST_ASSERT( step.Open( stream_file ) );
+        for ( int i = 0 ; i < ( int )surf_vec.size() ; i++ )
+        {
+            step.AddSurf( &surf_vec[i], true, true, false, 1e-6 );
+        }
+        nent = step.GetNumEntities();
+        step.Close();
+    }
+
+    //==== Export Through The Vehicle STEP Settings ====//
+    string veh_id = vsp::FindContainer( "Vehicle", 0 );
+    vsp::SetParmVal( vsp::FindParm( veh_id, "LenUnit", "STEPSettings" ), vsp::LEN_FT );
+    vsp::SetParmVal( vsp::FindParm( veh_id, "SplitSurfs", "STEPSettings" ), 1.0 );
+    vsp::SetParmVal( vsp::FindParm( veh_id, "MergePoints", "STEPSettings" ), 1.0 );
+    vsp::SetParmVal( vsp::FindParm( veh_id, "ToCubic", "STEPSettings" ), 0.0 );
+    vsp::SetParmVal( vsp::FindParm( veh_id, "StreamWrite", "STEPSettings" ), 1.0 );
+    vsp::ExportFile( export_file, vsp::SET_ALL, vsp::EXPORT_STEP );
+    vsp::SetParmVal( vsp::FindParm( veh_id, "StreamWrite", "STEPSettings" ), 0.0 );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+    TEST_ASSERT( FilesMatch( stream_file.c_str(), export_file.c_str() ) );
+
+    //==== Parse Both Files Back and Compare ====//
+    map< int, string > sdai_ents, stream_ents;
+    TEST_ASSERT( ReadSTEPEntities( sdai_file.c_str(), sdai_ents ) );
+    TEST_ASSERT( ReadSTEPEntities( stream_file.c_str(), stream_ents ) );
+    TEST_ASSERT( ( int )stream_ents.size() == nent );
+
+    // Same entity types in the same numbers
+    map< string, int > sdai_types, stream_types;
+    map< int, string >::iterator it;
+    for ( it = sdai_ents.begin() ; it != sdai_ents.end() ; ++it )
+    {
+        sdai_types[ STEPEntityType( it->second ) ]++;
+    }
+    for ( it = stream_ents.begin() ; it != stream_ents.end() ; ++it )
+    {
+        stream_types[ STEPEntityType( it->second ) ]++;
+    }
+    TEST_ASSERT( sdai_types == stream_types );
+
+    vector< STEPTestSurf > sdai_surfs, stream_surfs;
+    int sdai_npnt, stream_npnt;
+    ResolveSTEPSurfs( sdai_ents, sdai_surfs, sdai_npnt );
+    ResolveSTEPSurfs( stream_ents, stream_surfs, stream_npnt );
+
+    TEST_ASSERT( sdai_npnt == stream_npnt );
+    TEST_ASSERT( sdai_surfs.size() == stream_surfs.size() );
+    TEST_ASSERT( sdai_surfs.size() > surf_vec.size() );
+
+    bool match = ( sdai_surfs.size() == stream_surfs.size() );
+    for ( int i = 0 ; i < ( int )sdai_surfs.size() && match ; i++ )
+    {
+        const STEPTestSurf & a = sdai_surfs[i];
+        const STEPTestSurf & b = stream_surfs[i];
+        match = a.m_UDeg == b.m_UDeg && a.m_VDeg == b.m_VDeg && a.m_NRow == b.m_NRow &&
+                a.m_Flags == b.m_Flags && a.m_Pnts.size() == b.m_Pnts.size();
+
+        for ( int j = 0 ; j < ( int )a.m_Pnts.size() && match ; j++ )
+        {
+            match = dist( a.m_Pnts[j], b.m_Pnts[j] ) <= 1e-12 * max( 1.0, a.m_Pnts[j].mag() );
+        }
+    }
+    TEST_ASSERT( match );
+
+    printf( "\t%d surfs, %d B-spline quilts, %d control points, %d entities\n",
+            ( int )surf_vec.size(), ( int )stream_surfs.size(), stream_npnt, nent );
+
+    remove( sdai_file.c_str() );
+    remove( stream_file.c_str() );
+    remove( export_file.c_str() );
     printf( "\n" );
 }
 
-
 //=============================================================================//
 //========================== APITestSuiteVSPAERO ==============================//
 //=============================================================================//
@@ -747,6 +2624,16 @@ void APITestSuiteVSPAERO::TestVSPAeroSinglePointStab()
     printf("\n");
 }
 
+//==== Seek With 64 Bit Offsets - long Is Only 32 Bits On Windows ====//
+static int SeekADB( FILE* fp, long long offset, int origin )
+{
+#ifdef _MSC_VER
+    return _fseeki64( fp, offset, origin );
+#else
+    return fseeko( fp, ( off_t )offset, origin );
+#endif
+}
+
 void APITestSuiteVSPAERO::TestVSPAeroSweep()
 {
     printf("APITestSuiteVSPAERO::TestVSPAeroSweep()\n");
@@ -824,6 +2711,37 @@ void APITestSuiteVSPAERO::TestVSPAeroSweep()
 
     // Get & Display Results
     vsp::PrintResults(stdout, results_id );
+
+    // The adb file ends with an index of every case in the sweep
+    string adb_fname = m_vspfname_for_vspaerotests.substr( 0, m_vspfname_for_vspaerotests.find_last_of( "." ) ) + string( "_DegenGeom.adb" );
+    FILE* adb_file = fopen( adb_fname.c_str(), "rb" );
+    TEST_ASSERT( adb_file != NULL );
+    if ( adb_file )
+    {
+        int num_case = 0;
+        int adb_id = 0;
+        long long index_offset = 0;
+        long long index_size = 2 * sizeof( int ) + sizeof( long long );
+        TEST_ASSERT( SeekADB( adb_file, -index_size, SEEK_END ) == 0 );
+        TEST_ASSERT( fread( &num_case, sizeof( int ), 1, adb_file ) == 1 );
+        TEST_ASSERT( fread( &index_offset, sizeof( long long ), 1, adb_file ) == 1 );
+        TEST_ASSERT( fread( &adb_id, sizeof( int ), 1, adb_file ) == 1 );
+        TEST_ASSERT( adb_id == -123789457 );
+        TEST_ASSERT( num_case == alpha_npts[0] * beta_npts[0] * mach_npts[0] );
+
+        // Each indexed case starts with its Mach number
+        if ( num_case > 0 )
+        {
+            vector < long long > case_offset( num_case );
+            TEST_ASSERT( SeekADB( adb_file, index_offset, SEEK_SET ) == 0 );
+            TEST_ASSERT( fread( &case_offset[0], sizeof( long long ), num_case, adb_file ) == ( size_t )num_case );
+            float mach = 0;
+            TEST_ASSERT( SeekADB( adb_file, case_offset[num_case - 1], SEEK_SET ) == 0 );
+            TEST_ASSERT( fread( &mach, sizeof( float ), 1, adb_file ) == 1 );
+            TEST_ASSERT_DELTA( mach, mach_end[0], 1e-6 );
+        }
+        fclose( adb_file );
+    }
     
     // Final check for errors
     TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
@@ -916,3 +2834,195 @@ void APITestSuiteVSPAERO::TestVSPAeroSweepBatch()
     TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
     printf("\n");
 }
+
+void APITestSuiteVSPAERO::TestVSPAeroBinaryDegenGeom()
+{
+    printf("APITestSuiteVSPAERO::TestVSPAeroBinaryDegenGeom()\n");
+
+    // make sure setup works
+    vsp::VSPCheckSetup();
+    vsp::VSPRenew();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    //open the file created in TestVSPAeroCreateModel
+    vsp::ReadVSPFile( m_vspfname_for_vspaerotests );
+    if ( m_vspfname_for_vspaerotests == string() )
+    {
+        TEST_FAIL("m_vspfname_for_vspaerotests = NULL, need to run: APITestSuite::TestVSPAeroComputeGeom");
+        return;
+    }
+    if ( vsp::ErrorMgr.PopErrorAndPrint( stdout ) )
+    {
+        TEST_FAIL("m_vspfname_for_vspaerotests failed to open");
+        return;
+    }
+
+    string base_name = m_vspfname_for_vspaerotests;
+    base_name = base_name.substr( 0, base_name.find_last_of( "." ) ) + string( "_DegenGeom" );
+
+    //==== Run the same single point case from a CSV and a binary degen file ====//
+    string geom_name = "VSPAEROComputeGeometry";
+    string analysis_name = "VSPAEROSinglePoint";
+    vector < string > file_ext;
+    file_ext.push_back( ".csv" );
+    file_ext.push_back( ".dgb" );
+    vector < double > cl, cdi;
+
+    for ( int i = 0; i < ( int )file_ext.size(); i++ )
+    {
+        printf("\tDegen file: %s%s\n", base_name.c_str(), file_ext[i].c_str() );
+        vsp::SetComputationFileName( vsp::DEGEN_GEOM_CSV_TYPE, base_name + file_ext[i] );
+
+        vsp::SetAnalysisInputDefaults( geom_name );
+        vsp::ExecAnalysis( geom_name );
+        TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+        vsp::SetAnalysisInputDefaults( analysis_name );
+        std::vector< double > alpha; alpha.push_back(5);
+        vsp::SetDoubleAnalysisInput(analysis_name, "Alpha", alpha, 0);
+        std::vector< double > mach; mach.push_back(0.1);
+        vsp::SetDoubleAnalysisInput(analysis_name, "Mach", mach, 0);
+        vsp::Update();
+
+        printf("\tExecuting...\n");
+        vsp::ExecAnalysis( analysis_name );
+        printf("COMPLETE\n");
+        TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+        string history_id = vsp::FindLatestResultsID( "VSPAERO_History" );
+        vector < double > cl_vec = vsp::GetDoubleResults( history_id, "CL" );
+        vector < double > cdi_vec = vsp::GetDoubleResults( history_id, "CDi" );
+        TEST_ASSERT( cl_vec.size() > 0 && cdi_vec.size() > 0 );
+        if ( cl_vec.size() == 0 || cdi_vec.size() == 0 )
+        {
+            return;
+        }
+        cl.push_back( cl_vec.back() );
+        cdi.push_back( cdi_vec.back() );
+    }
+
+    // Binary values are the exact doubles the CSV prints at full precision
+    TEST_ASSERT_DELTA( cl[0], cl[1], 1e-9 );
+    TEST_ASSERT_DELTA( cdi[0], cdi[1], 1e-9 );
+
+    // Final check for errors
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+    printf("\n");
+}
+
+void APITestSuiteVSPAERO::TestVSPAeroWakeIterations()
+{
+    printf("APITestSuiteVSPAERO::TestVSPAeroWakeIterations()\n");
+
+    // make sure setup works
+    vsp::VSPCheckSetup();
+    vsp::VSPRenew();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    //==== Canard, main wing and tail, so every wake node sees several vortex sheets ====//
+    string wing_id = vsp::AddGeom( "WING" );
+    vsp::SetGeomName( wing_id, "MainWing" );
+    vsp::SetParmVal( wing_id, "TotalSpan", "WingGeom", 17.0 );
+
+    string canard_id = vsp::AddGeom( "WING" );
+    vsp::SetGeomName( canard_id, "Canard" );
+    vsp::SetParmVal( canard_id, "TotalSpan", "WingGeom", 6.0 );
+    vsp::SetParmVal( canard_id, "X_Rel_Location", "XForm", -6.0 );
+    vsp::SetParmVal( canard_id, "Z_Rel_Location", "XForm", 0.5 );
+
+    string tail_id = vsp::AddGeom( "WING" );
+    vsp::SetGeomName( tail_id, "Tail" );
+    vsp::SetParmVal( tail_id, "TotalSpan", "WingGeom", 6.0 );
+    vsp::SetParmVal( tail_id, "X_Rel_Location", "XForm", 9.0 );
+    vsp::SetParmVal( tail_id, "Z_Rel_Location", "XForm", 1.5 );
+
+    vsp::Update();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    string vsp_fname = "apitest_TestVSPAeroWake.vsp3";
+    vsp::SetVSP3FileName( vsp_fname );
+    vsp::Update();
+    vsp::WriteVSPFile( vsp::GetVSPFileName(), vsp::SET_ALL );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    string geom_name = "VSPAEROComputeGeometry";
+    vsp::SetAnalysisInputDefaults( geom_name );
+    vsp::ExecAnalysis( geom_name );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    //==== First run writes a fresh setup file ====//
+    string analysis_name = "VSPAEROSinglePoint";
+    vsp::SetAnalysisInputDefaults( analysis_name );
+    std::vector< double > alpha; alpha.push_back( 4.0 );
+    vsp::SetDoubleAnalysisInput( analysis_name, "Alpha", alpha, 0 );
+    std::vector< int > wake_iter; wake_iter.push_back( 3 );
+    vsp::SetIntAnalysisInput( analysis_name, "WakeNumIter", wake_iter, 0 );
+    std::vector< int > force_setup; force_setup.push_back( 1 );
+    vsp::SetIntAnalysisInput( analysis_name, "ForceNewSetupfile", force_setup, 0 );
+    std::vector< int > ncpu; ncpu.push_back( 1 );
+    vsp::SetIntAnalysisInput( analysis_name, "NCPU", ncpu, 0 );
+    vsp::ExecAnalysis( analysis_name );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    //==== Add a rotor ahead of the right wing to the setup file ====//
+    string setup_fname = vsp_fname.substr( 0, vsp_fname.find_last_of( "." ) ) + string( "_DegenGeom.vspaero" );
+    FILE* setup_file = fopen( setup_fname.c_str(), "r" );
+    TEST_ASSERT( setup_file != NULL );
+    if ( !setup_file )
+    {
+        return;
+    }
+    string setup_str;
+    char buff[512];
+    while ( fgets( buff, 512, setup_file ) )
+    {
+        if ( strstr( buff, "NumberOfRotors" ) )
+        {
+            setup_str += "NumberOfRotors = 1 \nPropElement_1\n1\n";
+            setup_str += "-2.000000 4.000000 0.000000 \n1.000000 0.000000 0.000000 \n";
+            setup_str += "1.500000 \n0.200000 \n2000.000000 \n0.400000 \n0.600000 \n";
+        }
+        else
+        {
+            setup_str += buff;
+        }
+    }
+    fclose( setup_file );
+    setup_file = fopen( setup_fname.c_str(), "w" );
+    fprintf( setup_file, "%s", setup_str.c_str() );
+    fclose( setup_file );
+
+    force_setup[0] = 0;
+    vsp::SetIntAnalysisInput( analysis_name, "ForceNewSetupfile", force_setup, 0 );
+
+    //==== Run the same case on one and on several threads ====//
+    vector < int > ncpu_vec;
+    ncpu_vec.push_back( 1 );
+    ncpu_vec.push_back( 4 );
+    vector < double > cl;
+
+    for ( int i = 0; i < ( int )ncpu_vec.size(); i++ )
+    {
+        ncpu[0] = ncpu_vec[i];
+        vsp::SetIntAnalysisInput( analysis_name, "NCPU", ncpu, 0 );
+
+        vsp::ExecAnalysis( analysis_name );
+        TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+        string history_id = vsp::FindLatestResultsID( "VSPAERO_History" );
+        vector < double > cl_vec = vsp::GetDoubleResults( history_id, "CL" );
+        TEST_ASSERT( cl_vec.size() == wake_iter[0] );
+        if ( cl_vec.size() == 0 )
+        {
+            return;
+        }
+        cl.push_back( cl_vec.back() );
+    }
+
+    // Each wake node is summed in the same order whatever the thread count
+    TEST_ASSERT_DELTA( cl[0], cl[1], 1e-5 );
+
+    // Final check for errors
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+    printf("\n");
+}
@@ -28,9 +28,26 @@ public:
         // Analysis
         TEST_ADD( APITestSuite::CheckAnalysisMgr )
         TEST_ADD( APITestSuite::TestAnalysesWithPod )
+        TEST_ADD( APITestSuite::TestMassPropModes )
+        TEST_ADD( APITestSuite::TestLinkPropagation )
+        TEST_ADD( APITestSuite::TestUpdateTransaction )
+        TEST_ADD( APITestSuite::TestSubSurfaceTagging )
+        TEST_ADD( APITestSuite::TestResultsBinaryIO )
+        TEST_ADD( APITestSuite::TestConcurrentAnalyses )
+        TEST_ADD( APITestSuite::TestSurfaceQueries )
+        TEST_ADD( APITestSuite::TestTessellation )
+        TEST_ADD( APITestSuite::TestTessellationCache )
+        TEST_ADD( APITestSuite::TestDegenGeomMassSlice )
 
         // Export
         TEST_ADD( APITestSuite::TestDXFExport )
+        TEST_ADD( APITestSuite::TestCFDMeshExport )
+        TEST_ADD( APITestSuite::TestCFDTargetMap )
+        TEST_ADD( APITestSuite::TestCFDIntersectBroadPhase )
+        TEST_ADD( APITestSuite::TestCFDBorderCurveMatch )
+        TEST_ADD( APITestSuite::TestFEAExportWriters )
+        TEST_ADD( APITestSuite::TestScriptCache )
+        TEST_ADD( APITestSuite::TestSTEPStreamWriter )
 
     }
 
@@ -44,8 +61,25 @@ private:
     // Analysis
     void CheckAnalysisMgr();
     void TestAnalysesWithPod();
+    void TestMassPropModes();
+    void TestLinkPropagation();
+    void TestUpdateTransaction();
+    void TestSubSurfaceTagging();
+    void TestResultsBinaryIO();
+    void TestConcurrentAnalyses();
+    void TestSurfaceQueries();
+    void TestTessellation();
+    void TestTessellationCache();
+    void TestDegenGeomMassSlice();
     // Export
     void TestDXFExport();
+    void TestCFDMeshExport();
+    void TestCFDTargetMap();
+    void TestCFDIntersectBroadPhase();
+    void TestCFDBorderCurveMatch();
+    void TestFEAExportWriters();
+    void TestScriptCache();
+    void TestSTEPStreamWriter();
 };
 
 class APITestSuiteVSPAERO : public Test::Suite
@@ -61,6 +95,8 @@ public:
         TEST_ADD( APITestSuiteVSPAERO::TestVSPAeroSinglePointStab )
         TEST_ADD( APITestSuiteVSPAERO::TestVSPAeroSweep )
         TEST_ADD( APITestSuiteVSPAERO::TestVSPAeroSweepBatch )
+        TEST_ADD( APITestSuiteVSPAERO::TestVSPAeroBinaryDegenGeom )
+        TEST_ADD( APITestSuiteVSPAERO::TestVSPAeroWakeIterations )
         //  Panel Method Tests
         TEST_ADD( APITestSuiteVSPAERO::TestVSPAeroComputeGeomPanel )
         TEST_ADD( APITestSuiteVSPAERO::TestVSPAeroSinglePointPanel )
@@ -75,6 +111,8 @@ private:
     void TestVSPAeroSinglePointStab();
     void TestVSPAeroSweep();
     void TestVSPAeroSweepBatch();
+    void TestVSPAeroBinaryDegenGeom();
+    void TestVSPAeroWakeIterations();
     //  Panel Method Tests
     void TestVSPAeroComputeGeomPanel();        //<--Execute this VSPERO test first for panel methods
     void TestVSPAeroSinglePointPanel();
@@ -82,4 +120,17 @@ private:
     string m_vspfname_for_vspaerotests;
 };
 
+//==== Timing Runs On Large Models - Not Part Of The Default Tests ====//
+class APIBenchmarkSuite : public Test::Suite
+{
+public:
+    APIBenchmarkSuite()
+    {
+        TEST_ADD( APIBenchmarkSuite::BenchFEAExportWriters )
+    }
+
+private:
+    void BenchFEAExportWriters();
+};
+
 #endif // !defined(VSPAPITESTSUITE__INCLUDED_)
@@ -19,6 +19,7 @@
 #include "XSecSurf.h"
 #include "CfdMeshMgr.h"
 #include "Util.h"
+#include "StlHelper.h"
 #include "DesignVarMgr.h"
 #include "SubSurfaceMgr.h"
 #include "VarPresetMgr.h"
@@ -136,6 +137,25 @@ void Update()
     ErrorMgr.NoError();
 }
 
+/// Collect parm changes without updating.  Links are propagated and only the
+/// changed geoms and their descendants are updated by CommitUpdateTransaction.
+void BeginUpdateTransaction()
+{
+    Vehicle* veh = GetVehicle();
+    veh->BeginUpdateTransaction();
+    ErrorMgr.NoError();
+}
+
+/// Apply changes collected since BeginUpdateTransaction.  Returns the number
+/// of geoms updated, also stored in the "Update_Transaction" results.
+int CommitUpdateTransaction()
+{
+    Vehicle* veh = GetVehicle();
+    int num_updated = veh->CommitUpdateTransaction();
+    ErrorMgr.NoError();
+    return num_updated;
+}
+
 
 void VSPExit( int error_code )
 {
@@ -378,11 +398,11 @@ void SetComputationFileName( int file_type, const string & file_name )
 }
 
 /// Compute Mass Properties on The Components in the Set
-string ComputeMassProps( int set, int num_slices )
+string ComputeMassProps( int set, int num_slices, int mode )
 {
     Update();
 
-    string id = GetVehicle()->MassPropsAndFlatten( set, num_slices );
+    string id = GetVehicle()->MassPropsAndFlatten( set, num_slices, true, true, mode );
 
     if ( id.size() == 0 )
     {
@@ -671,9 +691,7 @@ vector < string > GetAnalysisInputNames( const string & analysis )
         return ret;
     }
 
-    Analysis *a = AnalysisMgr.FindAnalysis( analysis );
-
-    return a->m_Inputs.GetAllDataNames();
+    return AnalysisMgr.GetAnalysisInputNames( analysis );
 }
 
 string ExecAnalysis( const string & analysis )
@@ -688,6 +706,40 @@ string ExecAnalysis( const string & analysis )
     return AnalysisMgr.ExecAnalysis( analysis );
 }
 
+int ExecAnalysisAsync( const string & analysis )
+{
+    if ( !AnalysisMgr.ValidAnalysisName( analysis ) )
+    {
+        ErrorMgr.AddError( VSP_INVALID_ID, "ExecAnalysisAsync::Invalid Analysis ID " + analysis );
+        return -1;
+    }
+
+    ErrorMgr.NoError();
+    return AnalysisMgr.ExecAnalysisAsync( analysis );
+}
+
+bool AsyncAnalysisReady( int handle )
+{
+    ErrorMgr.NoError();
+    return AnalysisMgr.AsyncAnalysisReady( handle );
+}
+
+string WaitAsyncAnalysis( int handle )
+{
+    string res_id = AnalysisMgr.WaitAsyncAnalysis( handle );
+
+    if ( !ResultsMgr.ValidResultsID( res_id ) )
+    {
+        ErrorMgr.AddError( VSP_INVALID_ID, "WaitAsyncAnalysis::No Results For Handle " + to_string( ( long long )handle ) );
+    }
+    else
+    {
+        ErrorMgr.NoError();
+    }
+
+    return res_id;
+}
+
 int GetNumAnalysisInputData( const string & analysis, const string & name )
 {
     if ( !AnalysisMgr.ValidAnalysisName( analysis ) )
@@ -1015,77 +1067,133 @@ extern int GetResultsType( const string & results_id, const string & data_name )
 /// Return the int data given the results id, data name and data index
 const vector<int> & GetIntResults( const string & id, const string & name, int index )
 {
-    if ( !ResultsMgr.ValidResultsID( id ) )
+    const vector<int>* data_ptr = GetIntResultsView( id, name, index );
+    if ( !data_ptr )
     {
-        ErrorMgr.AddError( VSP_INVALID_ID, "GetIntResults::Invalid ID " + id  );
+        return ResultsMgr.GetIntResults( id, name, index );
     }
-    else if ( !ResultsMgr.ValidDataNameIndex( id, name, index ) )
+    return *data_ptr;
+}
+
+/// Return a pointer to the stored int data, valid until the results are deleted
+const vector<int>* GetIntResultsView( const string & id, const string & name, int index )
+{
+    //==== One Lookup For Both Validation And Data ====//
+    NameValData* rd_ptr = ResultsMgr.FindResultsData( id, name, index );
+    if ( rd_ptr )
     {
-        ErrorMgr.AddError( VSP_CANT_FIND_NAME, "GetIntResults::Can't Find Name " + name  );
+        ErrorMgr.NoError();
+        return &rd_ptr->GetIntData();
+    }
+
+    if ( !ResultsMgr.ValidResultsID( id ) )
+    {
+        ErrorMgr.AddError( VSP_INVALID_ID, "GetIntResults::Invalid ID " + id  );
     }
     else
     {
-        ErrorMgr.NoError();
+        ErrorMgr.AddError( VSP_CANT_FIND_NAME, "GetIntResults::Can't Find Name " + name  );
     }
-
-    return ResultsMgr.GetIntResults( id, name, index );
+    return NULL;
 }
 
 /// Return the double data given the results id, data name and data index
 const vector<double> & GetDoubleResults( const string & id, const string & name, int index )
 {
-    if ( !ResultsMgr.ValidResultsID( id ) )
+    const vector<double>* data_ptr = GetDoubleResultsView( id, name, index );
+    if ( !data_ptr )
     {
-        ErrorMgr.AddError( VSP_INVALID_ID, "GetDoubleResults::Invalid ID " + id  );
+        return ResultsMgr.GetDoubleResults( id, name, index );
     }
-    else if ( !ResultsMgr.ValidDataNameIndex( id, name, index ) )
+    return *data_ptr;
+}
+
+/// Return a pointer to the stored double data, valid until the results are deleted
+const vector<double>* GetDoubleResultsView( const string & id, const string & name, int index )
+{
+    //==== One Lookup For Both Validation And Data ====//
+    NameValData* rd_ptr = ResultsMgr.FindResultsData( id, name, index );
+    if ( rd_ptr )
     {
-        ErrorMgr.AddError( VSP_CANT_FIND_NAME, "GetDoubleResults::Can't Find Name " + name  );
+        ErrorMgr.NoError();
+        return &rd_ptr->GetDoubleData();
+    }
+
+    if ( !ResultsMgr.ValidResultsID( id ) )
+    {
+        ErrorMgr.AddError( VSP_INVALID_ID, "GetDoubleResults::Invalid ID " + id  );
     }
     else
     {
-        ErrorMgr.NoError();
+        ErrorMgr.AddError( VSP_CANT_FIND_NAME, "GetDoubleResults::Can't Find Name " + name  );
     }
-
-    return ResultsMgr.GetDoubleResults( id, name, index );
+    return NULL;
 }
 
 /// Return the string data given the results id, data name and data index
 const vector<string> & GetStringResults( const string & id, const string & name, int index )
 {
-    if ( !ResultsMgr.ValidResultsID( id ) )
+    const vector<string>* data_ptr = GetStringResultsView( id, name, index );
+    if ( !data_ptr )
     {
-        ErrorMgr.AddError( VSP_INVALID_ID, "GetStringResults::Invalid ID " + id  );
+        return ResultsMgr.GetStringResults( id, name, index );
     }
-    else if ( !ResultsMgr.ValidDataNameIndex( id, name, index ) )
+    return *data_ptr;
+}
+
+/// Return a pointer to the stored string data, valid until the results are deleted
+const vector<string>* GetStringResultsView( const string & id, const string & name, int index )
+{
+    //==== One Lookup For Both Validation And Data ====//
+    NameValData* rd_ptr = ResultsMgr.FindResultsData( id, name, index );
+    if ( rd_ptr )
     {
-        ErrorMgr.AddError( VSP_CANT_FIND_NAME, "GetStringResults::Can't Find Name " + name  );
+        ErrorMgr.NoError();
+        return &rd_ptr->GetStringData();
+    }
+
+    if ( !ResultsMgr.ValidResultsID( id ) )
+    {
+        ErrorMgr.AddError( VSP_INVALID_ID, "GetStringResults::Invalid ID " + id  );
     }
     else
     {
-        ErrorMgr.NoError();
+        ErrorMgr.AddError( VSP_CANT_FIND_NAME, "GetStringResults::Can't Find Name " + name  );
     }
-
-    return ResultsMgr.GetStringResults( id, name, index );
+    return NULL;
 }
 
 /// Return the vec3d data given the results id, data name and data index
 const vector<vec3d> & GetVec3dResults( const string & id, const string & name, int index )
 {
-    if ( !ResultsMgr.ValidResultsID( id ) )
+    const vector<vec3d>* data_ptr = GetVec3dResultsView( id, name, index );
+    if ( !data_ptr )
     {
-        ErrorMgr.AddError( VSP_INVALID_ID, "GetVec3dResults::Invalid ID " + id  );
+        return ResultsMgr.GetVec3dResults( id, name, index );
     }
-    else if ( !ResultsMgr.ValidDataNameIndex( id, name, index ) )
+    return *data_ptr;
+}
+
+/// Return a pointer to the stored vec3d data, valid until the results are deleted
+const vector<vec3d>* GetVec3dResultsView( const string & id, const string & name, int index )
+{
+    //==== One Lookup For Both Validation And Data ====//
+    NameValData* rd_ptr = ResultsMgr.FindResultsData( id, name, index );
+    if ( rd_ptr )
     {
-        ErrorMgr.AddError( VSP_CANT_FIND_NAME, "GetVec3dResults::Can't Find Name " + name  );
+        ErrorMgr.NoError();
+        return &rd_ptr->GetVec3dData();
+    }
+
+    if ( !ResultsMgr.ValidResultsID( id ) )
+    {
+        ErrorMgr.AddError( VSP_INVALID_ID, "GetVec3dResults::Invalid ID " + id  );
     }
     else
     {
-        ErrorMgr.NoError();
+        ErrorMgr.AddError( VSP_CANT_FIND_NAME, "GetVec3dResults::Can't Find Name " + name  );
     }
-
-    return ResultsMgr.GetVec3dResults( id, name, index );
+    return NULL;
 }
 
 /// Create Geometry Results (Only Mesh Geom For Now) - Return Result ID
@@ -1152,6 +1260,51 @@ void WriteResultsCSVFile( const string & id, const string & file_name )
     ErrorMgr.NoError();
  }
 
+// Write Results To Binary File ====//
+void WriteResultsBinaryFile( const vector < string > & id_vec, const string & file_name )
+{
+    for ( int i = 0 ; i < ( int )id_vec.size() ; i++ )
+    {
+        if ( !ResultsMgr.ValidResultsID( id_vec[i] ) )
+        {
+            ErrorMgr.AddError( VSP_INVALID_ID, "WriteResultsBinaryFile::Invalid ID " + id_vec[i]  );
+            return;
+        }
+    }
+
+    if ( ResultsMgr.WriteBinaryFile( file_name, id_vec ) != VSP_OK )
+    {
+        ErrorMgr.AddError( VSP_FILE_WRITE_FAILURE, "WriteResultsBinaryFile::Can't Write File " + file_name  );
+        return;
+    }
+    ErrorMgr.NoError();
+}
+
+// Read Results From Binary File - Return New Results IDs ====//
+vector < string > ReadResultsBinaryFile( const string & file_name )
+{
+    FILE* fid = fopen( file_name.c_str(), "rb" );
+    if ( !fid )
+    {
+        ErrorMgr.AddError( VSP_FILE_READ_FAILURE, "ReadResultsBinaryFile::Can't Open File " + file_name  );
+        return vector < string >();
+    }
+
+    char magic[6];
+    bool valid = ( fread( magic, 1, 6, fid ) == 6 && strncmp( magic, "VSPRES", 6 ) == 0 );
+    fclose( fid );
+
+    if ( !valid )
+    {
+        ErrorMgr.AddError( VSP_WRONG_FILE_TYPE, "ReadResultsBinaryFile::Not A Results File " + file_name  );
+        return vector < string >();
+    }
+
+    vector < string > id_vec = ResultsMgr.ReadBinaryFile( file_name );
+    ErrorMgr.NoError();
+    return id_vec;
+}
+
 void PrintResults(FILE * outputStream, const vector < string > &results_id_vec )
 {
     for ( unsigned int i = 0; i < results_id_vec.size(); i++ )
@@ -1682,6 +1835,223 @@ void InsertXSec( const string & geom_id, int index, int type )
 }
 
 
+//===================================================================//
+//===============       Surface Query Functions    ==================//
+//===================================================================//
+
+//==== Find Surface For Query Or Flag Error ====//
+static VspSurf* FindQuerySurf( const string & geom_id, int surf_indx, const string & caller )
+{
+    Vehicle* veh = GetVehicle();
+    Geom* geom_ptr = veh->FindGeom( geom_id );
+    if ( !geom_ptr )
+    {
+        ErrorMgr.AddError( VSP_INVALID_PTR, caller + "::Can't Find Geom " + geom_id  );
+        return NULL;
+    }
+
+    VspSurf* surf = geom_ptr->GetSurfPtr( surf_indx );
+    if ( !surf )
+    {
+        ErrorMgr.AddError( VSP_INDEX_OUT_RANGE, caller + "::Surface Index Out Of Range " + to_string( ( long long )surf_indx ) );
+        return NULL;
+    }
+    return surf;
+}
+
+//==== Check Parallel U W Input Vectors ====//
+static bool CheckQueryUW( const vector < double > & u_in_vec, const vector < double > & w_in_vec, const string & caller )
+{
+    if ( u_in_vec.size() != w_in_vec.size() )
+    {
+        ErrorMgr.AddError( VSP_INDEX_OUT_RANGE, caller + "::U And W Vectors Differ In Length" );
+        return false;
+    }
+    return true;
+}
+
+/// Get the number of main and symmetric surfs for this geom
+int GetNumTotalSurfs( const string & geom_id )
+{
+    Vehicle* veh = GetVehicle();
+    Geom* geom_ptr = veh->FindGeom( geom_id );
+    if ( !geom_ptr )
+    {
+        ErrorMgr.AddError( VSP_INVALID_PTR, "GetNumTotalSurfs::Can't Find Geom " + geom_id  );
+        return 0;
+    }
+
+    ErrorMgr.NoError();
+    return geom_ptr->GetNumTotalSurfs();
+}
+
+/// Compute point on surface given u, w (0 to 1)
+vec3d CompPnt01( const string & geom_id, int surf_indx, double u, double w )
+{
+    VspSurf* surf = FindQuerySurf( geom_id, surf_indx, "CompPnt01" );
+    if ( !surf )
+    {
+        return vec3d();
+    }
+
+    ErrorMgr.NoError();
+    return surf->CompPnt01( Clamp( u, 0.0, 1.0 ), Clamp( w, 0.0, 1.0 ) );
+}
+
+/// Compute surface normal given u, w (0 to 1)
+vec3d CompNorm01( const string & geom_id, int surf_indx, double u, double w )
+{
+    VspSurf* surf = FindQuerySurf( geom_id, surf_indx, "CompNorm01" );
+    if ( !surf )
+    {
+        return vec3d();
+    }
+
+    ErrorMgr.NoError();
+    return surf->CompNorm01( Clamp( u, 0.0, 1.0 ), Clamp( w, 0.0, 1.0 ) );
+}
+
+/// Compute principal (k1, k2), mean (ka) and Gaussian (kg) curvature given u, w (0 to 1)
+void CompCurvature01( const string & geom_id, int surf_indx, double u, double w, double & k1_out, double & k2_out, double & ka_out, double & kg_out )
+{
+    k1_out = k2_out = ka_out = kg_out = 0.0;
+
+    VspSurf* surf = FindQuerySurf( geom_id, surf_indx, "CompCurvature01" );
+    if ( !surf )
+    {
+        return;
+    }
+
+    surf->CompCurvature01( Clamp( u, 0.0, 1.0 ), Clamp( w, 0.0, 1.0 ), k1_out, k2_out, ka_out, kg_out );
+    ErrorMgr.NoError();
+}
+
+/// Find nearest surface u, w (0 to 1) to a point, return distance
+double ProjPnt01( const string & geom_id, int surf_indx, const vec3d & pt, double & u_out, double & w_out )
+{
+    u_out = w_out = 0.0;
+
+    VspSurf* surf = FindQuerySurf( geom_id, surf_indx, "ProjPnt01" );
+    if ( !surf )
+    {
+        return -1.0;
+    }
+
+    ErrorMgr.NoError();
+    return surf->FindNearest01( u_out, w_out, pt );
+}
+
+/// Compute points on surface for vectors of u, w (0 to 1)
+vector< vec3d > CompVecPnt01( const string & geom_id, int surf_indx, const vector < double > & u_in_vec, const vector < double > & w_in_vec )
+{
+    vector< vec3d > pnt_vec;
+
+    VspSurf* surf = FindQuerySurf( geom_id, surf_indx, "CompVecPnt01" );
+    if ( !surf || !CheckQueryUW( u_in_vec, w_in_vec, "CompVecPnt01" ) )
+    {
+        return pnt_vec;
+    }
+
+    int npt = ( int )u_in_vec.size();
+    pnt_vec.resize( npt );
+
+    #pragma omp parallel for schedule( static )
+    for ( int i = 0 ; i < npt ; i++ )
+    {
+        pnt_vec[i] = surf->CompPnt01( Clamp( u_in_vec[i], 0.0, 1.0 ), Clamp( w_in_vec[i], 0.0, 1.0 ) );
+    }
+
+    ErrorMgr.NoError();
+    return pnt_vec;
+}
+
+/// Compute surface normals for vectors of u, w (0 to 1)
+vector< vec3d > CompVecNorm01( const string & geom_id, int surf_indx, const vector < double > & u_in_vec, const vector < double > & w_in_vec )
+{
+    vector< vec3d > norm_vec;
+
+    VspSurf* surf = FindQuerySurf( geom_id, surf_indx, "CompVecNorm01" );
+    if ( !surf || !CheckQueryUW( u_in_vec, w_in_vec, "CompVecNorm01" ) )
+    {
+        return norm_vec;
+    }
+
+    int npt = ( int )u_in_vec.size();
+    norm_vec.resize( npt );
+    surf->ValidateDerivs();
+
+    #pragma omp parallel for schedule( static )
+    for ( int i = 0 ; i < npt ; i++ )
+    {
+        norm_vec[i] = surf->CompNorm01( Clamp( u_in_vec[i], 0.0, 1.0 ), Clamp( w_in_vec[i], 0.0, 1.0 ) );
+    }
+
+    ErrorMgr.NoError();
+    return norm_vec;
+}
+
+/// Compute curvatures for vectors of u, w (0 to 1)
+void CompVecCurvature01( const string & geom_id, int surf_indx, const vector < double > & u_in_vec, const vector < double > & w_in_vec,
+                         vector < double > & k1_out_vec, vector < double > & k2_out_vec, vector < double > & ka_out_vec, vector < double > & kg_out_vec )
+{
+    k1_out_vec.clear();
+    k2_out_vec.clear();
+    ka_out_vec.clear();
+    kg_out_vec.clear();
+
+    VspSurf* surf = FindQuerySurf( geom_id, surf_indx, "CompVecCurvature01" );
+    if ( !surf || !CheckQueryUW( u_in_vec, w_in_vec, "CompVecCurvature01" ) )
+    {
+        return;
+    }
+
+    int npt = ( int )u_in_vec.size();
+    k1_out_vec.resize( npt );
+    k2_out_vec.resize( npt );
+    ka_out_vec.resize( npt );
+    kg_out_vec.resize( npt );
+    surf->ValidateDerivs();
+
+    #pragma omp parallel for schedule( static )
+    for ( int i = 0 ; i < npt ; i++ )
+    {
+        surf->CompCurvature01( Clamp( u_in_vec[i], 0.0, 1.0 ), Clamp( w_in_vec[i], 0.0, 1.0 ),
+                               k1_out_vec[i], k2_out_vec[i], ka_out_vec[i], kg_out_vec[i] );
+    }
+
+    ErrorMgr.NoError();
+}
+
+/// Find nearest surface u, w (0 to 1) and distance for a vector of points
+void ProjVecPnt01( const string & geom_id, int surf_indx, const vector < vec3d > & pnt_in_vec,
+                   vector < double > & u_out_vec, vector < double > & w_out_vec, vector < double > & d_out_vec )
+{
+    u_out_vec.clear();
+    w_out_vec.clear();
+    d_out_vec.clear();
+
+    VspSurf* surf = FindQuerySurf( geom_id, surf_indx, "ProjVecPnt01" );
+    if ( !surf )
+    {
+        return;
+    }
+
+    int npt = ( int )pnt_in_vec.size();
+    u_out_vec.resize( npt );
+    w_out_vec.resize( npt );
+    d_out_vec.resize( npt );
+    surf->ValidateDerivs();
+
+    //==== Each Projection Is An Independent Search - Balance Dynamically ====//
+    #pragma omp parallel for schedule( dynamic, 16 )
+    for ( int i = 0 ; i < npt ; i++ )
+    {
+        d_out_vec[i] = surf->FindNearest01( u_out_vec[i], w_out_vec[i], pnt_in_vec[i] );
+    }
+
+    ErrorMgr.NoError();
+}
+
 //===================================================================//
 //===============       Wing Section Functions     ==================//
 //===================================================================//
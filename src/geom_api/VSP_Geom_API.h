@@ -34,6 +34,8 @@ extern void VSPCheckSetup();
 extern void VSPRenew();
 
 extern void Update();
+extern void BeginUpdateTransaction();
+extern int CommitUpdateTransaction();
 extern void VSPExit( int error_code );
 
 //======================== File I/O ================================//
@@ -61,7 +63,7 @@ extern int GetDesignVarType( int index );
 
 //======================== Computations ================================//
 extern void SetComputationFileName( int file_type, const std::string & file_name );
-extern std::string ComputeMassProps( int set, int num_slices );
+extern std::string ComputeMassProps( int set, int num_slices, int mode = MASS_PROP_SLICE );
 extern std::string ComputeCompGeom( int set, bool half_mesh, int file_export_types );
 extern std::string ComputePlaneSlice( int set, int num_slices, const vec3d & norm, bool auto_bnd,
                                  double start_bnd = 0, double end_bnd = 0 );
@@ -81,6 +83,12 @@ extern int GetNumAnalysis();
 extern std::vector<std::string> ListAnalysis();
 extern std::vector<std::string> GetAnalysisInputNames( const std::string & analysis );
 extern std::string ExecAnalysis( const std::string & analysis );
+// Runs on a worker thread with a copy of the analysis inputs, which may be changed meanwhile.
+// Analyses run one at a time.  The worker uses the live Vehicle, which must not be changed
+// until WaitAsyncAnalysis returns.
+extern int ExecAnalysisAsync( const std::string & analysis );
+extern bool AsyncAnalysisReady( int handle );
+extern std::string WaitAsyncAnalysis( int handle );
 
 extern int GetNumAnalysisInputData( const std::string & analysis, const std::string & name );
 extern int GetAnalysisInputType( const std::string & analysis, const std::string & name );
@@ -109,10 +117,16 @@ extern const std::vector< int > & GetIntResults( const std::string & id, const s
 extern const std::vector< double > & GetDoubleResults( const std::string & id, const std::string & name, int index = 0 );
 extern const std::vector<std::string> & GetStringResults( const std::string & id, const std::string & name, int index = 0 );
 extern const std::vector< vec3d > & GetVec3dResults( const std::string & id, const std::string & name, int index = 0 );
+extern const std::vector< int > * GetIntResultsView( const std::string & id, const std::string & name, int index = 0 );
+extern const std::vector< double > * GetDoubleResultsView( const std::string & id, const std::string & name, int index = 0 );
+extern const std::vector<std::string> * GetStringResultsView( const std::string & id, const std::string & name, int index = 0 );
+extern const std::vector< vec3d > * GetVec3dResultsView( const std::string & id, const std::string & name, int index = 0 );
 extern std::string CreateGeomResults( const std::string & geom_id, const std::string & name );
 extern void DeleteAllResults();
 extern void DeleteResult( const std::string & id );
 extern void WriteResultsCSVFile( const std::string & id, const std::string & file_name );
+extern void WriteResultsBinaryFile( const std::vector < std::string > & id_vec, const std::string & file_name );
+extern std::vector<std::string> ReadResultsBinaryFile( const std::string & file_name );
 extern void PrintResults( FILE * outputStream, const std::vector < std::string > &results_id_vec );
 extern void PrintResults( FILE * outputStream, const std::string &results_id );
 
@@ -145,6 +159,20 @@ extern void CopyXSec( const std::string & geom_id, int index );
 extern void PasteXSec( const std::string & geom_id, int index );
 extern void InsertXSec( const std::string & geom_id, int index, int type );
 
+//======================== Surface Query Functions ===================//
+extern int GetNumTotalSurfs( const std::string & geom_id );
+extern vec3d CompPnt01( const std::string & geom_id, int surf_indx, double u, double w );
+extern vec3d CompNorm01( const std::string & geom_id, int surf_indx, double u, double w );
+extern void CompCurvature01( const std::string & geom_id, int surf_indx, double u, double w, double & k1_out, double & k2_out, double & ka_out, double & kg_out );
+extern double ProjPnt01( const std::string & geom_id, int surf_indx, const vec3d & pt, double & u_out, double & w_out );
+
+extern std::vector< vec3d > CompVecPnt01( const std::string & geom_id, int surf_indx, const std::vector < double > & u_in_vec, const std::vector < double > & w_in_vec );
+extern std::vector< vec3d > CompVecNorm01( const std::string & geom_id, int surf_indx, const std::vector < double > & u_in_vec, const std::vector < double > & w_in_vec );
+extern void CompVecCurvature01( const std::string & geom_id, int surf_indx, const std::vector < double > & u_in_vec, const std::vector < double > & w_in_vec,
+                                std::vector < double > & k1_out_vec, std::vector < double > & k2_out_vec, std::vector < double > & ka_out_vec, std::vector < double > & kg_out_vec );
+extern void ProjVecPnt01( const std::string & geom_id, int surf_indx, const std::vector < vec3d > & pnt_in_vec,
+                          std::vector < double > & u_out_vec, std::vector < double > & w_out_vec, std::vector < double > & d_out_vec );
+
 //======================== Wing Section Functions ===================//
 extern void SetDriverGroup( const std::string & geom_id, int section_index, int driver_0, int driver_1, int driver_2 );
 
@@ -91,6 +91,7 @@ void AdvLink::AddVar( const VarDef & pd, bool input_flag )
     else
         m_OutputVars.push_back( pd );
 
+    AdvLinkMgr.SetIndexDirty();
 }
 
 void AdvLink::DeleteVar( int index, bool input_flag )
@@ -103,6 +104,8 @@ void AdvLink::DeleteVar( int index, bool input_flag )
     {
         m_OutputVars.erase( m_OutputVars.begin() + index );
     }
+
+    AdvLinkMgr.SetIndexDirty();
 }
 
 void AdvLink::DeleteAllVars( bool input_flag )
@@ -115,6 +118,8 @@ void AdvLink::DeleteAllVars( bool input_flag )
     {
         m_OutputVars.clear();
     }
+
+    AdvLinkMgr.SetIndexDirty();
 }
 
 void AdvLink::SetVar( const string & var_name, double val )
@@ -312,6 +317,8 @@ xmlNodePtr AdvLink::DecodeXml( xmlNodePtr & adv_link_node )
             xmlNodePtr var_def_node = XmlUtil::GetNode( output_node, "VarDef", i );
             m_OutputVars[i].DecodeXml( var_def_node );
         }
+
+        AdvLinkMgr.SetIndexDirty();
     }
 
     return adv_link_node;
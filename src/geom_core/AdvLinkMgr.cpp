@@ -24,6 +24,8 @@ AdvLinkMgrSingleton::AdvLinkMgrSingleton()
 {
     m_ActiveLink = NULL;
     m_EditLinkIndex = 0;
+    m_IndexDirty = true;
+    m_IndexStamp = -1;
 
 }
 
@@ -42,6 +44,7 @@ void AdvLinkMgrSingleton::Wype()
     m_LinkVec.clear();
     m_ActiveLink = NULL;
     m_EditLinkIndex = 0;
+    m_IndexDirty = true;
 }
 
 void AdvLinkMgrSingleton::Renew()
@@ -83,6 +86,7 @@ AdvLink* AdvLinkMgrSingleton::AddLink( const string & name )
     alink->SetName( link_name );
     m_LinkVec.push_back( alink );
     m_EditLinkIndex = (int)m_LinkVec.size() - 1;
+    m_IndexDirty = true;
 
     return alink;
 }
@@ -97,6 +101,7 @@ void AdvLinkMgrSingleton::DelLink( AdvLink* link_ptr )
 
     vector_remove_val( m_LinkVec, link_ptr );
     delete link_ptr;
+    m_IndexDirty = true;
 }
 
 void AdvLinkMgrSingleton::DelAllLinks( )
@@ -109,6 +114,7 @@ void AdvLinkMgrSingleton::DelAllLinks( )
         delete m_LinkVec[i];
     }
     m_LinkVec.clear();
+    m_IndexDirty = true;
 }
 
 void AdvLinkMgrSingleton::CheckLinks()
@@ -204,21 +210,13 @@ double AdvLinkMgrSingleton::GetVar( const string & var_name )
 
 bool AdvLinkMgrSingleton::IsInputParm( const string& pid )
 {
-    for ( int i = 0 ; i < (int)m_LinkVec.size() ; i++ )
+    Parm* parm_ptr = ParmMgr.FindParm( pid );
+    if ( !parm_ptr )
     {
-         vector< VarDef > def_vec = m_LinkVec[i]->GetInputVars();
-         for ( int j = 0 ; j < (int)def_vec.size() ; j++ )
-         {
-             if ( pid == def_vec[j].m_ParmID )
-             {
-                 if ( ParmMgr.FindParm( pid ) )
-                 {
-                     return true;
-                 }
-             }
-         }
+        return false;
     }
-    return false;
+
+    return !GetInputLinks( parm_ptr ).empty();
 }
 
 bool AdvLinkMgrSingleton::IsOutputParm( const string& pid )
@@ -250,11 +248,87 @@ void AdvLinkMgrSingleton::UpdateLinks( const string& pid  )
         return;
     }
 
-    //==== Check All Links And Update If Needed ====//
+    //==== Update Links That Use Parm As Input (Copy In Case A Script Edits Links) ====//
+    vector< AdvLink* > link_vec = GetInputLinks( parm_ptr );
+    for ( int i = 0 ; i < (int)link_vec.size() ; i++ )
+    {
+        link_vec[i]->ForceUpdate();
+    }
+}
+
+//==== Rebuild Parm Pointer Index If Links Or Parms Have Changed ====//
+void AdvLinkMgrSingleton::BuildIndex()
+{
+    if ( !m_IndexDirty && m_IndexStamp == ParmMgr.GetNumParmChanges() )
+    {
+        return;
+    }
+
+    m_IndexDirty = false;
+    m_IndexStamp = ParmMgr.GetNumParmChanges();
+
+    m_InputIndex.clear();
+    m_OutputIndex.clear();
+
     for ( int i = 0 ; i < (int)m_LinkVec.size() ; i++ )
     {
-        m_LinkVec[i]->UpdateLink( pid );
+        AdvLink* link_ptr = m_LinkVec[i];
+
+        vector< VarDef > in_vec = link_ptr->GetInputVars();
+        for ( int j = 0 ; j < (int)in_vec.size() ; j++ )
+        {
+            Parm* parm_ptr = ParmMgr.FindParm( in_vec[j].m_ParmID );
+            if ( parm_ptr )
+            {
+                vector< AdvLink* > & link_vec = m_InputIndex[ parm_ptr ];
+                if ( link_vec.empty() || link_vec.back() != link_ptr )
+                {
+                    link_vec.push_back( link_ptr );
+                }
+            }
+        }
+
+        vector< Parm* > & out_parm_vec = m_OutputIndex[ link_ptr ];
+        vector< VarDef > out_vec = link_ptr->GetOutputVars();
+        for ( int j = 0 ; j < (int)out_vec.size() ; j++ )
+        {
+            Parm* parm_ptr = ParmMgr.FindParm( out_vec[j].m_ParmID );
+            if ( parm_ptr )
+            {
+                out_parm_vec.push_back( parm_ptr );
+            }
+        }
+    }
+}
+
+//==== Links That Use Parm As An Input, In Link Order ====//
+const vector< AdvLink* > & AdvLinkMgrSingleton::GetInputLinks( Parm* parm_ptr )
+{
+    static const vector< AdvLink* > empty_vec;
+
+    BuildIndex();
+
+    unordered_map< Parm*, vector< AdvLink* > >::const_iterator iter = m_InputIndex.find( parm_ptr );
+    if ( iter != m_InputIndex.end() )
+    {
+        return iter->second;
+    }
+    return empty_vec;
+}
+
+//==== Parms Written By Link ====//
+const vector< Parm* > & AdvLinkMgrSingleton::GetOutputParms( AdvLink* link_ptr )
+{
+    static const vector< Parm* > empty_vec;
+
+    BuildIndex();
+
+    unordered_map< AdvLink*, vector< Parm* > >::const_iterator iter = m_OutputIndex.find( link_ptr );
+    if ( iter != m_OutputIndex.end() )
+    {
+        return iter->second;
     }
+    return empty_vec;
 }
 
 //==== Force Update of All Links ====//
@@ -13,9 +13,11 @@
 
 #include "AdvLink.h"
 #include <deque>
+#include <unordered_map>
 using std::string;
 using std::vector;
 using std::deque;
+using std::unordered_map;
 
 
 //==== Adv Link Manager ====//
@@ -50,6 +52,11 @@ public:
     bool IsInputParm( const string& pid );
     bool IsOutputParm( const string& pid );
     void UpdateLinks( const string& pid );
+
+    //==== Parm Pointer Index Of Link Inputs And Outputs ====//
+    void SetIndexDirty()                                                { m_IndexDirty = true; }
+    const vector< AdvLink* > & GetInputLinks( Parm* parm_ptr );
+    const vector< Parm* > & GetOutputParms( AdvLink* link_ptr );
     void ForceUpdate( );
     void SetActiveLink( AdvLink* adv_link )                             { m_ActiveLink = adv_link; }
     AdvLink* GetActiveLink()                                            { return m_ActiveLink; }
@@ -71,10 +78,17 @@ private:
     AdvLinkMgrSingleton& operator=( AdvLinkMgrSingleton const& copy );  // Not Implemented
 
     void AddInputOutput( const string & parm_id, const string & var_name, bool input_flag );
+    void BuildIndex();
+
     int m_EditLinkIndex;
     AdvLink* m_ActiveLink;
     vector< AdvLink* > m_LinkVec;
 
+    unordered_map< Parm*, vector< AdvLink* > > m_InputIndex;          // Input Parm -> Links
+    unordered_map< AdvLink*, vector< Parm* > > m_OutputIndex;         // Link -> Output Parms
+    bool m_IndexDirty;
+    int m_IndexStamp;
+
 };
 
 #define AdvLinkMgr AdvLinkMgrSingleton::getInstance()
@@ -28,6 +28,8 @@ void RWCollection::Clear()
 //==== Constructor ====//
 AnalysisMgrSingleton::AnalysisMgrSingleton()
 {
+    m_NextAsyncHandle = 0;
+    m_NumRunning = 0;
 }
 //==== Destructor ====//
 AnalysisMgrSingleton::~AnalysisMgrSingleton()
@@ -42,6 +44,9 @@ void AnalysisMgrSingleton::Init()
 
 void AnalysisMgrSingleton::Wype()
 {
+    std::lock_guard< std::recursive_mutex > run_lock( m_RunMutex );
+    std::lock_guard< std::recursive_mutex > lock( m_InputMutex );
+
     map < string, Analysis* >::const_iterator it;
 
     for ( it = m_AnalysisMap.begin(); it != m_AnalysisMap.end(); it++ )
@@ -50,6 +55,7 @@ void AnalysisMgrSingleton::Wype()
     }
 
     m_AnalysisMap.clear();
+    m_InputMap.clear();
 }
 
 void AnalysisMgrSingleton::Renew()
@@ -60,11 +66,15 @@ void AnalysisMgrSingleton::Renew()
 
 int AnalysisMgrSingleton::GetNumAnalysis() const
 {
+    std::lock_guard< std::recursive_mutex > lock( m_InputMutex );
+
     return m_AnalysisMap.size();
 }
 
 vector < string > AnalysisMgrSingleton::ListAnalysis() const
 {
+    std::lock_guard< std::recursive_mutex > lock( m_InputMutex );
+
     vector < string > ret;
 
     map < string, Analysis* >::const_iterator it;
@@ -79,6 +89,8 @@ vector < string > AnalysisMgrSingleton::ListAnalysis() const
 
 Analysis* AnalysisMgrSingleton::FindAnalysis( const string & name ) const
 {
+    std::lock_guard< std::recursive_mutex > lock( m_InputMutex );
+
     map < string, Analysis* >::const_iterator it;
 
     it = m_AnalysisMap.find( name );
@@ -93,33 +105,137 @@ Analysis* AnalysisMgrSingleton::FindAnalysis( const string & name ) const
 
 bool AnalysisMgrSingleton::RegisterAnalysis( const string & name, Analysis* asys )
 {
+    std::lock_guard< std::recursive_mutex > run_lock( m_RunMutex );
+    std::lock_guard< std::recursive_mutex > lock( m_InputMutex );
+
     Analysis *b = FindAnalysis( name );
 
     if ( !b )
     {
         asys->SetDefaults();
         m_AnalysisMap[name] = asys;
+        m_InputMap[name] = asys->m_Inputs;
         return true;
     }
 
     return false; // name already in AnalysisMap
 }
 
+//==== Find Caller Inputs, m_InputMutex Must Be Held ====//
+RWCollection* AnalysisMgrSingleton::FindInputs( const string & analysis )
+{
+    map < string, RWCollection >::iterator it = m_InputMap.find( analysis );
+
+    if ( it != m_InputMap.end() )
+    {
+        return &( it->second );
+    }
+
+    return NULL;
+}
+
 string AnalysisMgrSingleton::ExecAnalysis( const string & analysis )
 {
-    Analysis *analysis_ptr = FindAnalysis( analysis );
+    RWCollection inputs;
+    {
+        std::lock_guard< std::recursive_mutex > lock( m_InputMutex );
+
+        RWCollection* inputs_ptr = FindInputs( analysis );
+        if ( !inputs_ptr )
+        {
+            string ret;
+            return ret;
+        }
+        inputs = *inputs_ptr;
+    }
+
+    return RunAnalysis( analysis, inputs );
+}
+
+//==== Launch Analysis On Worker Thread With Current Inputs ====//
+int AnalysisMgrSingleton::ExecAnalysisAsync( const string & analysis )
+{
+    RWCollection inputs;
+    {
+        std::lock_guard< std::recursive_mutex > lock( m_InputMutex );
+
+        RWCollection* inputs_ptr = FindInputs( analysis );
+        if ( !inputs_ptr )
+        {
+            return -1;
+        }
+        inputs = *inputs_ptr;
+    }
+
+    std::shared_future < string > fut = std::async( std::launch::async,
+                                                    &AnalysisMgrSingleton::RunAnalysis, this, analysis, inputs ).share();
+
+    std::lock_guard< std::mutex > lock( m_AsyncMutex );
+    int handle = m_NextAsyncHandle++;
+    m_AsyncMap[ handle ] = fut;
+    return handle;
+}
+
+bool AnalysisMgrSingleton::AsyncAnalysisReady( int handle )
+{
+    std::lock_guard< std::mutex > lock( m_AsyncMutex );
+
+    map < int, std::shared_future < string > >::iterator it = m_AsyncMap.find( handle );
+    if ( it == m_AsyncMap.end() )
+    {
+        return false;
+    }
+    return it->second.wait_for( std::chrono::seconds( 0 ) ) == std::future_status::ready;
+}
+
+string AnalysisMgrSingleton::WaitAsyncAnalysis( int handle )
+{
+    std::shared_future < string > fut;
+    {
+        std::lock_guard< std::mutex > lock( m_AsyncMutex );
 
+        map < int, std::shared_future < string > >::iterator it = m_AsyncMap.find( handle );
+        if ( it == m_AsyncMap.end() )
+        {
+            return string();
+        }
+        fut = it->second;
+        m_AsyncMap.erase( it );
+    }
+
+    return fut.get();
+}
+
+//==== Execute With A Copy Of The Caller Inputs ====//
+// Only m_RunMutex is held while the analysis runs, callers may read and set inputs.
+string AnalysisMgrSingleton::RunAnalysis( const string & analysis, const RWCollection & inputs )
+{
+    std::lock_guard< std::recursive_mutex > run_lock( m_RunMutex );
+
+    Analysis *analysis_ptr = FindAnalysis( analysis );
     if ( !analysis_ptr )
     {
-        string ret;
-        return ret;
+        return string();
     }
 
-    return analysis_ptr->Execute();
+    analysis_ptr->m_Inputs = inputs;
+
+    m_NumRunning++;
+    string res_id = analysis_ptr->Execute();
+    m_NumRunning--;
+
+    return res_id;
+}
+
+int AnalysisMgrSingleton::GetNumRunningAnalyses() const
+{
+    return m_NumRunning;
 }
 
 bool AnalysisMgrSingleton::ValidAnalysisName( const string & analysis )
 {
+    std::lock_guard< std::recursive_mutex > lock( m_InputMutex );
+
     Analysis* analysis_ptr = FindAnalysis( analysis );
 
     if ( !analysis_ptr )
@@ -131,14 +247,16 @@ bool AnalysisMgrSingleton::ValidAnalysisName( const string & analysis )
 
 bool AnalysisMgrSingleton::ValidAnalysisInputDataIndex( const string & analysis, const string & name, int index )
 {
-    Analysis* analysis_ptr = FindAnalysis( analysis );
+    std::lock_guard< std::recursive_mutex > lock( m_InputMutex );
 
-    if ( !analysis_ptr )
+    RWCollection* inputs = FindInputs( analysis );
+
+    if ( !inputs )
     {
         return false;
     }
 
-    NameValData* inpt_ptr = analysis_ptr->m_Inputs.FindPtr( name, index );
+    NameValData* inpt_ptr = inputs->FindPtr( name, index );
     if ( !inpt_ptr )
     {
         return false;
@@ -149,24 +267,28 @@ bool AnalysisMgrSingleton::ValidAnalysisInputDataIndex( const string & analysis,
 
 int AnalysisMgrSingleton::GetNumInputData( const string & analysis, const string & name )
 {
-    Analysis* analysis_ptr = FindAnalysis( analysis );
-    if ( !analysis_ptr )
+    std::lock_guard< std::recursive_mutex > lock( m_InputMutex );
+
+    RWCollection* inputs = FindInputs( analysis );
+    if ( !inputs )
     {
         return 0;
     }
 
-    return analysis_ptr->m_Inputs.GetNumData( name );
+    return inputs->GetNumData( name );
 }
 
 int AnalysisMgrSingleton::GetAnalysisInputType( const string & analysis, const string & name )
 {
-    Analysis* analysis_ptr = FindAnalysis( analysis );
-    if ( !analysis_ptr )
+    std::lock_guard< std::recursive_mutex > lock( m_InputMutex );
+
+    RWCollection* inputs = FindInputs( analysis );
+    if ( !inputs )
     {
         return vsp::INVALID_TYPE;
     }
 
-    NameValData* inpt_ptr = analysis_ptr->m_Inputs.FindPtr( name );
+    NameValData* inpt_ptr = inputs->FindPtr( name );
     if ( !inpt_ptr )
     {
         return vsp::INVALID_TYPE;
@@ -177,13 +299,15 @@ int AnalysisMgrSingleton::GetAnalysisInputType( const string & analysis, const s
 
 const vector<int> & AnalysisMgrSingleton::GetIntInputData( const string & analysis, const string & name, int index )
 {
-    Analysis* analysis_ptr = FindAnalysis( analysis );
-    if ( !analysis_ptr )
+    std::lock_guard< std::recursive_mutex > lock( m_InputMutex );
+
+    RWCollection* inputs = FindInputs( analysis );
+    if ( !inputs )
     {
         return m_DefaultIntVec;
     }
 
-    NameValData* inpt_ptr = analysis_ptr->m_Inputs.FindPtr( name, index );
+    NameValData* inpt_ptr = inputs->FindPtr( name, index );
     if ( !inpt_ptr )
     {
         return m_DefaultIntVec;
@@ -194,13 +318,15 @@ const vector<int> & AnalysisMgrSingleton::GetIntInputData( const string & analys
 
 const vector<double> & AnalysisMgrSingleton::GetDoubleInputData( const string & analysis, const string & name, int index )
 {
-    Analysis* analysis_ptr = FindAnalysis( analysis );
-    if ( !analysis_ptr )
+    std::lock_guard< std::recursive_mutex > lock( m_InputMutex );
+
+    RWCollection* inputs = FindInputs( analysis );
+    if ( !inputs )
     {
         return m_DefaultDoubleVec;
     }
 
-    NameValData* inpt_ptr = analysis_ptr->m_Inputs.FindPtr( name, index );
+    NameValData* inpt_ptr = inputs->FindPtr( name, index );
     if ( !inpt_ptr )
     {
         return m_DefaultDoubleVec;
@@ -211,13 +337,15 @@ const vector<double> & AnalysisMgrSingleton::GetDoubleInputData( const string &
 
 const vector<string> & AnalysisMgrSingleton::GetStringInputData( const string & analysis, const string & name, int index )
 {
-    Analysis* analysis_ptr = FindAnalysis( analysis );
-    if ( !analysis_ptr )
+    std::lock_guard< std::recursive_mutex > lock( m_InputMutex );
+
+    RWCollection* inputs = FindInputs( analysis );
+    if ( !inputs )
     {
         return m_DefaultStringVec;
     }
 
-    NameValData* inpt_ptr = analysis_ptr->m_Inputs.FindPtr( name, index );
+    NameValData* inpt_ptr = inputs->FindPtr( name, index );
     if ( !inpt_ptr )
     {
         return m_DefaultStringVec;
@@ -228,13 +356,15 @@ const vector<string> & AnalysisMgrSingleton::GetStringInputData( const string &
 
 const vector<vec3d> & AnalysisMgrSingleton::GetVec3dInputData( const string & analysis, const string & name, int index )
 {
-    Analysis* analysis_ptr = FindAnalysis( analysis );
-    if ( !analysis_ptr )
+    std::lock_guard< std::recursive_mutex > lock( m_InputMutex );
+
+    RWCollection* inputs = FindInputs( analysis );
+    if ( !inputs )
     {
         return m_DefaultVec3dVec;
     }
 
-    NameValData* inpt_ptr = analysis_ptr->m_Inputs.FindPtr( name, index );
+    NameValData* inpt_ptr = inputs->FindPtr( name, index );
     if ( !inpt_ptr )
     {
         return m_DefaultVec3dVec;
@@ -243,8 +373,11 @@ const vector<vec3d> & AnalysisMgrSingleton::GetVec3dInputData( const string & an
     return inpt_ptr->GetVec3dData();
 }
 
+//==== Defaults Are Read From The Vehicle So They Wait For A Running Analysis ====//
 void AnalysisMgrSingleton::SetAnalysisInputDefaults( const string & analysis )
 {
+    std::lock_guard< std::recursive_mutex > run_lock( m_RunMutex );
+
     Analysis* analysis_ptr = FindAnalysis( analysis );
     if ( !analysis_ptr )
     {
@@ -252,17 +385,35 @@ void AnalysisMgrSingleton::SetAnalysisInputDefaults( const string & analysis )
     }
 
     analysis_ptr->SetDefaults();
+
+    std::lock_guard< std::recursive_mutex > lock( m_InputMutex );
+    m_InputMap[ analysis ] = analysis_ptr->m_Inputs;
+}
+
+vector < string > AnalysisMgrSingleton::GetAnalysisInputNames( const string & analysis )
+{
+    std::lock_guard< std::recursive_mutex > lock( m_InputMutex );
+
+    RWCollection* inputs = FindInputs( analysis );
+    if ( !inputs )
+    {
+        return vector < string >();
+    }
+
+    return inputs->GetAllDataNames();
 }
 
 void AnalysisMgrSingleton::SetIntAnalysisInput( const string & analysis, const string & name, const vector< int > & d, int index )
 {
-    Analysis* analysis_ptr = FindAnalysis( analysis );
-    if ( !analysis_ptr )
+    std::lock_guard< std::recursive_mutex > lock( m_InputMutex );
+
+    RWCollection* inputs = FindInputs( analysis );
+    if ( !inputs )
     {
         return;
     }
 
-    NameValData* inpt_ptr = analysis_ptr->m_Inputs.FindPtr( name, index );
+    NameValData* inpt_ptr = inputs->FindPtr( name, index );
     if ( !inpt_ptr )
     {
         return;
@@ -273,13 +424,15 @@ void AnalysisMgrSingleton::SetIntAnalysisInput( const string & analysis, const s
 
 void AnalysisMgrSingleton::SetDoubleAnalysisInput( const string & analysis, const string & name, const vector< double > & d, int index )
 {
-    Analysis* analysis_ptr = FindAnalysis( analysis );
-    if ( !analysis_ptr )
+    std::lock_guard< std::recursive_mutex > lock( m_InputMutex );
+
+    RWCollection* inputs = FindInputs( analysis );
+    if ( !inputs )
     {
         return;
     }
 
-    NameValData* inpt_ptr = analysis_ptr->m_Inputs.FindPtr( name, index );
+    NameValData* inpt_ptr = inputs->FindPtr( name, index );
     if ( !inpt_ptr )
     {
         return;
@@ -290,13 +443,15 @@ void AnalysisMgrSingleton::SetDoubleAnalysisInput( const string & analysis, cons
 
 void AnalysisMgrSingleton::SetStringAnalysisInput( const string & analysis, const string & name, const vector< string > & d, int index )
 {
-    Analysis* analysis_ptr = FindAnalysis( analysis );
-    if ( !analysis_ptr )
+    std::lock_guard< std::recursive_mutex > lock( m_InputMutex );
+
+    RWCollection* inputs = FindInputs( analysis );
+    if ( !inputs )
     {
         return;
     }
 
-    NameValData* inpt_ptr = analysis_ptr->m_Inputs.FindPtr( name, index );
+    NameValData* inpt_ptr = inputs->FindPtr( name, index );
     if ( !inpt_ptr )
     {
         return;
@@ -307,13 +462,15 @@ void AnalysisMgrSingleton::SetStringAnalysisInput( const string & analysis, cons
 
 void AnalysisMgrSingleton::SetVec3dAnalysisInput( const string & analysis, const string & name, const vector< vec3d > & d, int index )
 {
-    Analysis* analysis_ptr = FindAnalysis( analysis );
-    if ( !analysis_ptr )
+    std::lock_guard< std::recursive_mutex > lock( m_InputMutex );
+
+    RWCollection* inputs = FindInputs( analysis );
+    if ( !inputs )
     {
         return;
     }
 
-    NameValData* inpt_ptr = analysis_ptr->m_Inputs.FindPtr( name, index );
+    NameValData* inpt_ptr = inputs->FindPtr( name, index );
     if ( !inpt_ptr )
     {
         return;
@@ -558,11 +715,13 @@ void MassPropAnalysis::SetDefaults()
     Vehicle *veh = VehicleMgr.GetVehicle();
     if ( veh )
     {
-        m_Inputs.Add( NameValData( "NumMassSlices", veh->m_NumMassSlices ) );
+        m_Inputs.Add( NameValData( "NumMassSlices", veh->m_NumMassSlices() ) );
+        m_Inputs.Add( NameValData( "MassPropMode", veh->m_MassPropMode() ) );
     }
     else
     {
         m_Inputs.Add( NameValData( "NumMassSlices", 20 ) );
+        m_Inputs.Add( NameValData( "MassPropMode", vsp::MASS_PROP_SLICE ) );
     }
 }
 
@@ -576,6 +735,7 @@ string MassPropAnalysis::Execute()
     {
         int geomSet;
         int numMassSlice;
+        int massPropMode = vsp::MASS_PROP_SLICE;
 
         NameValData *nvd = NULL;
 
@@ -591,7 +751,13 @@ string MassPropAnalysis::Execute()
             numMassSlice = nvd->GetInt( 0 );
         }
 
-        string geom = veh->MassPropsAndFlatten( geomSet, numMassSlice );
+        nvd = m_Inputs.FindPtr( "MassPropMode", 0 );
+        if ( nvd )
+        {
+            massPropMode = nvd->GetInt( 0 );
+        }
+
+        string geom = veh->MassPropsAndFlatten( geomSet, numMassSlice, true, true, massPropMode );
 
         res = ResultsMgr.FindLatestResultsID( "Mass_Properties" );
     }
@@ -16,6 +16,9 @@
 #include <map>
 #include <vector>
 #include <string>
+#include <mutex>
+#include <future>
+#include <atomic>
 
 using std::map;
 using std::vector;
@@ -42,12 +45,20 @@ public:
     virtual void SetDefaults() = 0;
     virtual string Execute() = 0;
 
-    RWCollection m_Inputs;
+    RWCollection m_Inputs;      // Defaults, then the inputs of the running execution
 
 };
 
 
 //==== Analysis Manager ====//
+// Caller inputs are kept by the manager and guarded by m_InputMutex.  Each execution runs
+// on its own copy of them, so inputs can be read and set while an analysis runs.  Analyses
+// share the vehicle, so executions (and SetAnalysisInputDefaults, which reads the vehicle)
+// are serialized by m_RunMutex - async analyses queue behind each other, they do not
+// overlap.  ExecAnalysisAsync runs on a worker thread with the inputs taken at launch and
+// returns a handle to wait on.  The worker reads and updates the live Vehicle, which is
+// not locked.  The Vehicle (geoms, parms, sets, files) must not be changed until
+// WaitAsyncAnalysis returns for every outstanding handle.
 class AnalysisMgrSingleton
 {
 public:
@@ -68,6 +79,11 @@ public:
 
     string ExecAnalysis( const string & analysis );
 
+    int ExecAnalysisAsync( const string & analysis );                // Return Handle, -1 If Not Found
+    bool AsyncAnalysisReady( int handle );
+    string WaitAsyncAnalysis( int handle );                          // Return Results ID And Release Handle
+    int GetNumRunningAnalyses() const;
+
     bool ValidAnalysisName( const string & analysis );
     bool ValidAnalysisInputDataIndex( const string & analysis, const string & name, int index = 0 );
 
@@ -80,6 +96,7 @@ public:
     const vector<vec3d> & GetVec3dInputData( const string & analysis, const string & name, int index = 0 );
 
     void SetAnalysisInputDefaults( const string & analysis );
+    vector < string > GetAnalysisInputNames( const string & analysis );
     void SetIntAnalysisInput( const string & analysis, const string & name, const vector< int > & d, int index = 0 );
     void SetDoubleAnalysisInput( const string & analysis, const string & name, const vector< double > & d, int index = 0 );
     void SetStringAnalysisInput( const string & analysis, const string & name, const vector< string > & d, int index = 0 );
@@ -95,6 +112,19 @@ private:
 
     map < string, Analysis* > m_AnalysisMap;    // Map unique name to analysis.
 
+    map < string, RWCollection > m_InputMap;    // Caller inputs, copied for each execution
+
+    RWCollection* FindInputs( const string & analysis );
+    string RunAnalysis( const string & analysis, const RWCollection & inputs );
+
+    mutable std::recursive_mutex m_InputMutex;  // Guards the analysis map and caller inputs
+    std::recursive_mutex m_RunMutex;            // Serializes executions - analyses share the vehicle
+    std::atomic< int > m_NumRunning;
+
+    std::mutex m_AsyncMutex;                    // Guards handle map
+    map < int, std::shared_future < string > > m_AsyncMap;
+    int m_NextAsyncHandle;
+
     //==== Default Return Vectors ====//
     vector< int > m_DefaultIntVec;
     vector< double > m_DefaultDoubleVec;
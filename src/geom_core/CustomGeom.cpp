@@ -40,6 +40,9 @@ void CustomGeomMgrSingleton::ReadCustomScripts( Vehicle* veh )
 
     vector < string > scriptDirs = veh->GetCustomScriptDirs();
 
+    //==== Compiled Scripts Are Cached Next To User Scripts ====//
+    ScriptMgr.SetByteCodeCacheDir( veh->GetWriteScriptDir() );
+
     for ( int k = 0 ; k < scriptDirs.size(); k++ )
     {
         // ReadScriptsFromDir is clever enough to not allow duplicate content.  Duplicate
@@ -57,6 +60,9 @@ void CustomGeomMgrSingleton::ReadCustomScripts( Vehicle* veh )
             }
         }
     }
+
+    //==== Drop Byte Code From Other Builds, Bound Byte Code For Edited Scripts ====//
+    ScriptMgr.PruneByteCodeCache();
 }
 
 //==== Init Custom Geom ====//
@@ -1,6 +1,7 @@
 #include "DegenGeom.h"
 #include "Geom.h"
 #include <cmath>
+#include <stdint.h>
 #include "WriteMatlab.h"
 
 void DegenGeom::build_trans_mat( vec3d x, vec3d y, vec3d z, const vec3d &p, Matrix4d &mat, Matrix4d &invmat )
@@ -995,6 +996,317 @@ void DegenGeom::write_degenGeomCsv_file( FILE* file_id )
     }
 }
 
+//==== Binary DegenGeom File ====//
+// Little-endian stream of int32 counts and float64 arrays holding the same
+// data, in the same order, as the CSV file.  Strings are an int32 length
+// followed by the characters.  VSPAERO reads this when the file ends in .dgb.
+//
+//  "VSPDEGEN", version, ncomps, nblank, { name, x, y, z, mass } * nblank
+//  { type, name, surfNum, [disk], surf, plates, sticks, point, subsurfs } * ncomps
+
+static const char DEGEN_BINARY_TAG[] = "VSPDEGEN";
+static const int DEGEN_BINARY_VERSION = 1;
+
+static bool degenHostIsLittleEndian()
+{
+    const int one = 1;
+    return *( ( const char* ) &one ) == 1;
+}
+
+static void degenBinaryWrite( FILE* file_id, const void* data, size_t size, size_t n )
+{
+    if ( degenHostIsLittleEndian() )
+    {
+        fwrite( data, size, n, file_id );
+        return;
+    }
+
+    const unsigned char* p = ( const unsigned char* ) data;
+    vector< unsigned char > buf( size * n );
+    for ( size_t i = 0; i < n; i++ )
+    {
+        for ( size_t b = 0; b < size; b++ )
+        {
+            buf[ i * size + b ] = p[ i * size + size - 1 - b ];
+        }
+    }
+    fwrite( &buf[0], size, n, file_id );
+}
+
+static void degenBinaryWriteInt( FILE* file_id, int val )
+{
+    int32_t v = val;
+    degenBinaryWrite( file_id, &v, sizeof( v ), 1 );
+}
+
+static void degenBinaryWriteString( FILE* file_id, const string &str )
+{
+    degenBinaryWriteInt( file_id, ( int ) str.size() );
+    fwrite( str.c_str(), 1, str.size(), file_id );
+}
+
+static void degenBinaryWriteDoubles( FILE* file_id, const vector< double > &vals )
+{
+    if ( !vals.empty() )
+    {
+        degenBinaryWrite( file_id, &vals[0], sizeof( double ), vals.size() );
+    }
+}
+
+void DegenGeom::write_degenGeomBinaryHeader( FILE* file_id, int ncomps, const vector< DegenPtMass > &ptMassVec )
+{
+    fwrite( DEGEN_BINARY_TAG, 1, 8, file_id );
+    degenBinaryWriteInt( file_id, DEGEN_BINARY_VERSION );
+    degenBinaryWriteInt( file_id, ncomps );
+    degenBinaryWriteInt( file_id, ( int ) ptMassVec.size() );
+
+    for ( int i = 0; i < ( int ) ptMassVec.size(); i++ )
+    {
+        degenBinaryWriteString( file_id, ptMassVec[i].name );
+
+        vector< double > vals( 4 );
+        vals[0] = ptMassVec[i].x.x();
+        vals[1] = ptMassVec[i].x.y();
+        vals[2] = ptMassVec[i].x.z();
+        vals[3] = ptMassVec[i].mass;
+        degenBinaryWriteDoubles( file_id, vals );
+    }
+}
+
+void DegenGeom::write_degenGeomSurfBinary_file( FILE* file_id, int nxsecs )
+{
+    degenBinaryWriteInt( file_id, nxsecs );
+    degenBinaryWriteInt( file_id, num_pnts );
+
+    vector< double > vals;
+    vals.reserve( nxsecs * num_pnts * 5 );
+    for ( int i = 0; i < nxsecs; i++ )
+    {
+        for ( int j = 0; j < num_pnts; j++ )
+        {
+            vals.push_back( degenSurface.x[i][j].x() );
+            vals.push_back( degenSurface.x[i][j].y() );
+            vals.push_back( degenSurface.x[i][j].z() );
+            vals.push_back( degenSurface.u[i][j] );
+            vals.push_back( degenSurface.w[i][j] );
+        }
+    }
+    degenBinaryWriteDoubles( file_id, vals );
+
+    vals.clear();
+    for ( int i = 0; i < nxsecs - 1; i++ )
+    {
+        for ( int j = 0; j < num_pnts - 1; j++ )
+        {
+            vals.push_back( degenSurface.nvec[i][j].x() );
+            vals.push_back( degenSurface.nvec[i][j].y() );
+            vals.push_back( degenSurface.nvec[i][j].z() );
+            vals.push_back( degenSurface.area[i][j] );
+        }
+    }
+    degenBinaryWriteDoubles( file_id, vals );
+}
+
+void DegenGeom::write_degenGeomPlateBinary_file( FILE* file_id, int nxsecs, DegenPlate &degenPlate )
+{
+    int npts = ( num_pnts + 1 ) / 2;
+
+    degenBinaryWriteInt( file_id, nxsecs );
+    degenBinaryWriteInt( file_id, npts );
+
+    vector< double > vals;
+    for ( int i = 0; i < nxsecs; i++ )
+    {
+        vals.push_back( degenPlate.nPlate[i].x() );
+        vals.push_back( degenPlate.nPlate[i].y() );
+        vals.push_back( degenPlate.nPlate[i].z() );
+    }
+    degenBinaryWriteDoubles( file_id, vals );
+
+    vals.clear();
+    vals.reserve( nxsecs * npts * 11 );
+    for ( int i = 0; i < nxsecs; i++ )
+    {
+        for ( int j = 0; j < npts; j++ )
+        {
+            vals.push_back( degenPlate.x[i][j].x() );
+            vals.push_back( degenPlate.x[i][j].y() );
+            vals.push_back( degenPlate.x[i][j].z() );
+            vals.push_back( degenPlate.zcamber[i][j] );
+            vals.push_back( degenPlate.t[i][j] );
+            vals.push_back( degenPlate.nCamber[i][j].x() );
+            vals.push_back( degenPlate.nCamber[i][j].y() );
+            vals.push_back( degenPlate.nCamber[i][j].z() );
+            vals.push_back( degenPlate.u[i][j] );
+            vals.push_back( degenPlate.wTop[i][j] );
+            vals.push_back( degenPlate.wBot[i][j] );
+        }
+    }
+    degenBinaryWriteDoubles( file_id, vals );
+}
+
+void DegenGeom::write_degenGeomStickBinary_file( FILE* file_id, int nxsecs, DegenStick &degenStick )
+{
+    degenBinaryWriteInt( file_id, nxsecs );
+
+    vector< double > vals;
+    vals.reserve( nxsecs * 60 );
+    for ( int i = 0; i < nxsecs; i++ )
+    {
+        vals.push_back( degenStick.xle[i].x() );
+        vals.push_back( degenStick.xle[i].y() );
+        vals.push_back( degenStick.xle[i].z() );
+        vals.push_back( degenStick.xte[i].x() );
+        vals.push_back( degenStick.xte[i].y() );
+        vals.push_back( degenStick.xte[i].z() );
+        vals.push_back( degenStick.xcgShell[i].x() );
+        vals.push_back( degenStick.xcgShell[i].y() );
+        vals.push_back( degenStick.xcgShell[i].z() );
+        vals.push_back( degenStick.xcgSolid[i].x() );
+        vals.push_back( degenStick.xcgSolid[i].y() );
+        vals.push_back( degenStick.xcgSolid[i].z() );
+        vals.push_back( degenStick.toc[i] );
+        vals.push_back( degenStick.tLoc[i] );
+        vals.push_back( degenStick.chord[i] );
+        vals.push_back( degenStick.Ishell[i][0] );
+        vals.push_back( degenStick.Ishell[i][1] );
+        vals.push_back( degenStick.Ishell[i][2] );
+        vals.push_back( degenStick.Isolid[i][0] );
+        vals.push_back( degenStick.Isolid[i][1] );
+        vals.push_back( degenStick.Isolid[i][2] );
+        vals.push_back( degenStick.sectarea[i] );
+        vals.push_back( degenStick.sectnvec[i].x() );
+        vals.push_back( degenStick.sectnvec[i].y() );
+        vals.push_back( degenStick.sectnvec[i].z() );
+        vals.push_back( degenStick.perimTop[i] );
+        vals.push_back( degenStick.perimBot[i] );
+        vals.push_back( degenStick.u[i] );
+
+        for ( int j = 0; j < 16; j++ )
+        {
+            vals.push_back( degenStick.transmat[i][j] );
+        }
+        for ( int j = 0; j < 16; j++ )
+        {
+            vals.push_back( degenStick.invtransmat[i][j] );
+        }
+    }
+    degenBinaryWriteDoubles( file_id, vals );
+
+    vals.clear();
+    for ( int i = 0; i < nxsecs - 1; i++ )
+    {
+        vals.push_back( degenStick.sweeple[i] );
+        vals.push_back( degenStick.sweepte[i] );
+        vals.push_back( degenStick.areaTop[i] );
+        vals.push_back( degenStick.areaBot[i] );
+    }
+    degenBinaryWriteDoubles( file_id, vals );
+}
+
+void DegenGeom::write_degenGeomPointBinary_file( FILE* file_id )
+{
+    vector< double > vals;
+    vals.reserve( 22 );
+    vals.push_back( degenPoint.vol[0] );
+    vals.push_back( degenPoint.volWet[0] );
+    vals.push_back( degenPoint.area[0] );
+    vals.push_back( degenPoint.areaWet[0] );
+    for ( int j = 0; j < 6; j++ )
+    {
+        vals.push_back( degenPoint.Ishell[0][j] );
+    }
+    for ( int j = 0; j < 6; j++ )
+    {
+        vals.push_back( degenPoint.Isolid[0][j] );
+    }
+    vals.push_back( degenPoint.xcgShell[0].x() );
+    vals.push_back( degenPoint.xcgShell[0].y() );
+    vals.push_back( degenPoint.xcgShell[0].z() );
+    vals.push_back( degenPoint.xcgSolid[0].x() );
+    vals.push_back( degenPoint.xcgSolid[0].y() );
+    vals.push_back( degenPoint.xcgSolid[0].z() );
+    degenBinaryWriteDoubles( file_id, vals );
+}
+
+void DegenGeom::write_degenGeomDiskBinary_file( FILE* file_id )
+{
+    vector< double > vals( 7 );
+    vals[0] = degenDisk.d;
+    vals[1] = degenDisk.x.x();
+    vals[2] = degenDisk.x.y();
+    vals[3] = degenDisk.x.z();
+    vals[4] = degenDisk.nvec.x();
+    vals[5] = degenDisk.nvec.y();
+    vals[6] = degenDisk.nvec.z();
+    degenBinaryWriteDoubles( file_id, vals );
+}
+
+void DegenGeom::write_degenSubSurfBinary_file( FILE* file_id, int isubsurf )
+{
+    DegenSubSurf &dgss = degenSubSurfs[isubsurf];
+
+    degenBinaryWriteString( file_id, dgss.name );
+    degenBinaryWriteString( file_id, dgss.typeName );
+    degenBinaryWriteInt( file_id, dgss.typeId );
+    degenBinaryWriteInt( file_id, dgss.testType );
+
+    int n = dgss.u.size();
+    degenBinaryWriteInt( file_id, n );
+
+    vector< double > vals;
+    vals.reserve( 2 * n );
+    for ( int i = 0; i < n; i++ )
+    {
+        vals.push_back( dgss.u[i] );
+        vals.push_back( dgss.w[i] );
+    }
+    degenBinaryWriteDoubles( file_id, vals );
+}
+
+void DegenGeom::write_degenGeomBinary_file( FILE* file_id )
+{
+    int nxsecs = num_xsecs;
+
+    degenBinaryWriteInt( file_id, type );
+    degenBinaryWriteString( file_id, name );
+    degenBinaryWriteInt( file_id, getSurfNum() );
+
+    if ( type == DISK_TYPE )
+    {
+        write_degenGeomDiskBinary_file( file_id );
+    }
+
+    write_degenGeomSurfBinary_file( file_id, nxsecs );
+
+    if ( type == DISK_TYPE )
+    {
+        return;
+    }
+
+    write_degenGeomPlateBinary_file( file_id, nxsecs, degenPlates[0] );
+
+    if ( type == BODY_TYPE )
+    {
+        write_degenGeomPlateBinary_file( file_id, nxsecs, degenPlates[1] );
+    }
+
+    write_degenGeomStickBinary_file( file_id, nxsecs, degenSticks[0] );
+
+    if ( type == BODY_TYPE )
+    {
+        write_degenGeomStickBinary_file( file_id, nxsecs, degenSticks[1] );
+    }
+
+    write_degenGeomPointBinary_file( file_id );
+
+    degenBinaryWriteInt( file_id, ( int ) degenSubSurfs.size() );
+    for ( int i = 0; i < ( int ) degenSubSurfs.size(); i++ )
+    {
+        write_degenSubSurfBinary_file( file_id, i );
+    }
+}
+
 void DegenGeom::write_degenGeomSurfM_file( FILE* file_id, int nxsecs )
 {
     string basename = string( "degenGeom(end).surf." );
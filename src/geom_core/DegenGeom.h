@@ -219,6 +219,15 @@ public:
     void write_degenGeomDiskCsv_file( FILE* file_id );
     void write_degenSubSurfCsv_file( FILE* file_id, int isubsurf );
 
+    static void write_degenGeomBinaryHeader( FILE* file_id, int ncomps, const vector< DegenPtMass > &ptMassVec );
+    void write_degenGeomBinary_file( FILE* file_id );
+    void write_degenGeomSurfBinary_file( FILE* file_id, int nxsecs );
+    void write_degenGeomPlateBinary_file( FILE* file_id, int nxsecs, DegenPlate &degenPlate );
+    void write_degenGeomStickBinary_file( FILE* file_id, int nxsecs, DegenStick &degenStick );
+    void write_degenGeomPointBinary_file( FILE* file_id );
+    void write_degenGeomDiskBinary_file( FILE* file_id );
+    void write_degenSubSurfBinary_file( FILE* file_id, int isubsurf );
+
     void write_degenGeomM_file( FILE* file_id );
     void write_degenGeomSurfM_file( FILE* file_id, int nxsecs );
     void write_degenGeomPlateM_file( FILE* file_id, int nxsecs, DegenPlate &degenPlate, int iplate );
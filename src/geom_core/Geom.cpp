@@ -119,7 +119,8 @@ void GeomBase::ParmChanged( Parm* parm_ptr, int type )
         m_UpdatedParmVec.push_back( parm_ptr->GetID() );
     }
 
-    if ( type == Parm::SET )
+    //==== Updates Are Held Until The Vehicle Commits Its Transaction ====//
+    if ( type == Parm::SET || m_Vehicle->InUpdateTransaction() )
     {
         m_LateUpdateFlag = true;
         return;
@@ -24,6 +24,10 @@ LinkMgrSingleton::LinkMgrSingleton()
     m_UserParms.SetNumPredefined( m_NumPredefinedUserParms );
     m_UserParms.Renew(m_NumPredefinedUserParms);
 
+    m_LinkIndexDirty = true;
+    m_LinkIndexStamp = -1;
+    m_PropagateDepth = 0;
+    m_DeferChanges = false;
 }
 
 void LinkMgrSingleton::Init()
@@ -53,7 +57,17 @@ void LinkMgrSingleton::Wype()
     DelAllLinks();
     m_LinkVec = deque< Link* >();
 
-    m_UpdatedParmVec = vector< string >();
+    m_UpdatedParmVec = vector< Parm* >();
+    m_LinkIndex.clear();
+    m_LinkIndexDirty = true;
+    m_PropagateDepth = 0;
+    m_BatchParms.clear();
+    m_ChangedParms.clear();
+    m_ProcessedParms.clear();
+    m_RequeueParmVec.clear();
+    m_DeferChanges = false;
+    m_DeferredParmVec.clear();
+    m_DeferredParmIDs.clear();
 
     m_BaseLinkableContainers = vector< string >();
     m_LinkableContainers = vector< string >();
@@ -149,6 +163,11 @@ void LinkMgrSingleton::CheckLinks()
         m_LinkVec.erase( m_LinkVec.begin() + del_indices[i] );
     }
 
+    if ( del_indices.size() )
+    {
+        m_LinkIndexDirty = true;
+    }
+
 }
 
 
@@ -207,15 +226,6 @@ bool LinkMgrSingleton::UsedInLink( const string & pid )
 //==== Add New Link ====//
 bool LinkMgrSingleton::AddLink( const string& pidA, const string& pidB )
 {
-    //==== Make Sure Parm Are Not Already Linked ====//
-    for ( int i = 0 ; i < ( int )m_LinkVec.size() ; i++ )
-    {
-        if ( m_LinkVec[i]->GetParmA() == pidA && m_LinkVec[i]->GetParmB() == pidB  )
-        {
-            return false;
-        }
-    }
-
     //==== Check If ParmIDs Are Valid ====//
     Parm* pA = ParmMgr.FindParm( pidA );
     Parm* pB = ParmMgr.FindParm( pidB );
@@ -225,6 +235,20 @@ bool LinkMgrSingleton::AddLink( const string& pidA, const string& pidB )
         return false;
     }
 
+    //==== Make Sure Parm Are Not Already Linked ====//
+    BuildLinkIndex();
+    unordered_map< Parm*, vector< LinkTarget > >::iterator iter = m_LinkIndex.find( pA );
+    if ( iter != m_LinkIndex.end() )
+    {
+        for ( int i = 0 ; i < ( int )iter->second.size() ; i++ )
+        {
+            if ( iter->second[i].m_ParmB == pB )
+            {
+                return false;
+            }
+        }
+    }
+
     Link* pl = new Link();
 
     pl->SetParmA( pidA );
@@ -240,6 +264,8 @@ bool LinkMgrSingleton::AddLink( const string& pidA, const string& pidB )
     m_LinkVec.push_back( pl );
     m_CurrLinkIndex = ( int )m_LinkVec.size() - 1;
 
+    IndexLink( pl );
+
     return true;
 }
 
@@ -258,6 +284,7 @@ void LinkMgrSingleton::DelCurrLink()
     delete pl;
 
     m_CurrLinkIndex = -1;
+    m_LinkIndexDirty = true;
 }
 
 //==== Delete All Links ====//
@@ -270,6 +297,8 @@ void LinkMgrSingleton::DelAllLinks()
 
     m_LinkVec.clear();
     m_CurrLinkIndex = -1;
+    m_LinkIndex.clear();
+    m_LinkIndexDirty = true;
 }
 //==== Link All Parms In A Group ====//
 bool LinkMgrSingleton::LinkAllGroup()
@@ -371,6 +400,56 @@ void LinkMgrSingleton::ResetWorkingLink()
     m_WorkingLink->SetOffsetFlag( true );
 }
 
+//==== Add Link To Index Without A Full Rebuild ====//
+void LinkMgrSingleton::IndexLink( Link* link )
+{
+    if ( m_LinkIndexDirty )
+    {
+        return;                                     // Whole Index Is Rebuilt On Next Use
+    }
+
+    Parm* pA = ParmMgr.FindParm( link->GetParmA() );
+    Parm* pB = ParmMgr.FindParm( link->GetParmB() );
+
+    if ( !pA || !pB )
+    {
+        m_LinkIndexDirty = true;
+        return;
+    }
+
+    LinkTarget target;
+    target.m_Link = link;
+    target.m_ParmB = pB;
+    m_LinkIndex[ pA ].push_back( target );
+}
+
+//==== Rebuild ParmA -> Link Index If Links Or Parms Have Changed ====//
+void LinkMgrSingleton::BuildLinkIndex()
+{
+    if ( !m_LinkIndexDirty && m_LinkIndexStamp == ParmMgr.GetNumParmChanges() )
+    {
+        return;
+    }
+
+    m_LinkIndexDirty = false;
+    m_LinkIndexStamp = ParmMgr.GetNumParmChanges();
+    m_LinkIndex.clear();
+
+    for ( int i = 0 ; i < ( int )m_LinkVec.size() ; i++ )
+    {
+        Parm* pA = ParmMgr.FindParm( m_LinkVec[i]->GetParmA() );
+        Parm* pB = ParmMgr.FindParm( m_LinkVec[i]->GetParmB() );
+
+        if ( pA && pB )                             // Invalid Links Are Removed By CheckLinks
+        {
+            LinkTarget target;
+            target.m_Link = m_LinkVec[i];
+            target.m_ParmB = pB;
+            m_LinkIndex[ pA ].push_back( target );
+        }
+    }
+}
+
 //==== Parm Changed ====//
 void LinkMgrSingleton::ParmChanged( const string& pid, bool start_flag  )
 {
@@ -379,94 +458,343 @@ void LinkMgrSingleton::ParmChanged( const string& pid, bool start_flag  )
     if ( !parm_ptr )
         return;
 
-    //==== Check For Advanced Links ====//
-    bool adv_link_flag = AdvLinkMgr.IsInputParm( pid );
+    //==== Parm Is Downstream Of A Running Propagation - It Is Handled In Order ====//
+    //==== Unless Its Turn Has Passed, Then It Is Queued For Another Pass ====//
+    if ( m_PropagateDepth > 0 && m_BatchParms.find( parm_ptr ) != m_BatchParms.end() )
+    {
+        m_ChangedParms.insert( parm_ptr );
+        if ( m_ProcessedParms.erase( parm_ptr ) )
+        {
+            m_RequeueParmVec.push_back( parm_ptr );
+        }
+        return;
+    }
 
-    //==== Look for Reg Links  ====//
-    vector < Link* > parm_link_vec;
-    for ( int i = 0 ; i < ( int )m_LinkVec.size() ; i++ )
+    //==== Abort if No Links ====//
+    BuildLinkIndex();
+    if ( m_LinkIndex.find( parm_ptr ) == m_LinkIndex.end() && AdvLinkMgr.GetInputLinks( parm_ptr ).empty() )
+        return;
+
+    //==== Hold Change Until PropagateDeferredChanges ====//
+    // IDs are held rather than pointers, the parm may be deleted before the commit
+    if ( m_DeferChanges && m_PropagateDepth == 0 )
     {
-        if ( m_LinkVec[i]->GetParmA() == pid )
+        if ( m_DeferredParmIDs.insert( pid ).second )
         {
-            parm_link_vec.push_back( m_LinkVec[i] );
+            m_DeferredParmVec.push_back( pid );
         }
+        return;
     }
 
-    //==== Check Links ====//
-    bool reg_link_flag = false;
-    if ( parm_link_vec.size() )
+    vector< Parm* > root_vec( 1, parm_ptr );
+    PropagateChange( root_vec );
+    PropagateRequeued( root_vec );
+    EndPropagation();
+
+    if ( start_flag )
     {
-        reg_link_flag = true;
+        Vehicle* veh = VehicleMgr.GetVehicle();
+        if ( veh )
+        {
+            veh->ParmChanged( parm_ptr, Parm::SET );
+        }
     }
+}
 
-    //==== Abort if No Links ====//
-    if ( !adv_link_flag && !reg_link_flag )
+//==== Clear Link Update Flags Once The Outermost Propagation Is Done ====//
+void LinkMgrSingleton::EndPropagation()
+{
+    if ( m_PropagateDepth > 0 )
+    {
+        return;
+    }
+
+    for ( int i = 0 ; i < ( int )m_UpdatedParmVec.size() ; i++ )
+    {
+        m_UpdatedParmVec[i]->SetLinkUpdateFlag( false );
+    }
+    m_UpdatedParmVec.clear();
+    m_BatchParms.clear();
+    m_ChangedParms.clear();
+    m_ProcessedParms.clear();
+    m_RequeueParmVec.clear();
+}
+
+//==== Propagate Again From Parms That Changed After Their Turn ====//
+// A parm can change again after its place in the order has passed, e.g. when a
+// container update recomputes it.  Queued parms start a new pass until the queue
+// is empty.  Link update flags are cleared between passes so the new values reach
+// parms that were already updated, except for the parms that were set directly,
+// which links still may not overwrite.  Passes are bounded by the number of parms
+// reached, so a loop that never settles still ends.
+void LinkMgrSingleton::PropagateRequeued( const vector< Parm* > & root_vec )
+{
+    if ( m_PropagateDepth > 0 )
+    {
         return;
+    }
+
+    int max_pass = ( int )m_BatchParms.size();
+    for ( int pass = 0 ; !m_RequeueParmVec.empty() && pass < max_pass ; pass++ )
+    {
+        vector< Parm* > requeue_vec;
+        requeue_vec.swap( m_RequeueParmVec );
 
-    //==== Set Link Update Flag ====//
-    parm_ptr->SetLinkUpdateFlag( true );
-    m_UpdatedParmVec.push_back( parm_ptr->GetID() );
+        for ( int i = 0 ; i < ( int )m_UpdatedParmVec.size() ; i++ )
+        {
+            m_UpdatedParmVec[i]->SetLinkUpdateFlag( false );
+        }
+        m_UpdatedParmVec.clear();
+        m_BatchParms.clear();
+        m_ChangedParms.clear();
+        m_ProcessedParms.clear();
+
+        for ( int i = 0 ; i < ( int )root_vec.size() ; i++ )
+        {
+            if ( !root_vec[i]->GetLinkUpdateFlag() )
+            {
+                root_vec[i]->SetLinkUpdateFlag( true );
+                m_UpdatedParmVec.push_back( root_vec[i] );
+            }
+        }
+
+        BuildLinkIndex();
+        PropagateChange( requeue_vec );
+    }
+    m_RequeueParmVec.clear();
+}
+
+//==== Start Collecting Changed Parms ====//
+void LinkMgrSingleton::BeginDeferredChanges()
+{
+    m_DeferChanges = true;
+}
+
+//==== Propagate All Collected Parms Together, Return Number Of Driving Parms ====//
+int LinkMgrSingleton::PropagateDeferredChanges()
+{
+    m_DeferChanges = false;
+
+    vector< string > id_vec;
+    id_vec.swap( m_DeferredParmVec );
+    m_DeferredParmIDs.clear();
+    m_ChangedParms.clear();
+
+    //==== Skip Parms Deleted Since They Changed ====//
+    vector< Parm* > root_vec;
+    root_vec.reserve( id_vec.size() );
+    for ( int i = 0 ; i < ( int )id_vec.size() ; i++ )
+    {
+        Parm* parm_ptr = ParmMgr.FindParm( id_vec[i] );
+        if ( parm_ptr )
+        {
+            root_vec.push_back( parm_ptr );
+        }
+    }
 
-    //==== Update Linked Parms ====//
-    for ( int i = 0 ; i < ( int )parm_link_vec.size() ; i++ )
+    if ( root_vec.size() )
     {
-        Link* pl = parm_link_vec[i];
-        Parm* pB = ParmMgr.FindParm( pl->GetParmB() );
+        BuildLinkIndex();
+        PropagateChange( root_vec );
+        PropagateRequeued( root_vec );
+        EndPropagation();
+    }
 
-        if ( pB && ( pB->GetLinkUpdateFlag() == false ) )       // Prevent Circular
+    return ( int )root_vec.size();
+}
+
+//==== Update Everything Driven By Changed Parms ====//
+// Parms and adv links reachable from the changed parms are put in topological
+// order (reversed depth first post order, edges back into the search path are
+// circular and dropped).  Each one is then updated once, after every parm that
+// drives it has its final value.  Parms whose value did not change stop the
+// propagation just like an unchanged SetFromLink does.
+void LinkMgrSingleton::PropagateChange( const vector< Parm* > & root_vec )
+{
+    //==== Search Node - Either A Parm Or An Adv Link ====//
+    struct SearchNode
+    {
+        Parm* m_Parm;
+        AdvLink* m_AdvLink;
+        int m_NextChild;
+    };
+
+    unordered_set< Parm* > visit_parms;
+    unordered_set< AdvLink* > visit_links;
+    vector< SearchNode > stack;
+    vector< SearchNode > post_order;
+
+    //==== Roots Are Searched Last To First So The First Root Leads The Order ====//
+    for ( int r = ( int )root_vec.size() - 1 ; r >= 0 ; r-- )
+    {
+        if ( !visit_parms.insert( root_vec[r] ).second )
         {
-            double offset = 0.0;
-            if ( pl->GetOffsetFlag() )
+            continue;
+        }
+
+        SearchNode root;
+        root.m_Parm = root_vec[r];
+        root.m_AdvLink = NULL;
+        root.m_NextChild = 0;
+        stack.push_back( root );
+
+        while ( !stack.empty() )
+        {
+            SearchNode & node = stack.back();
+
+            Parm* child_parm = NULL;
+            AdvLink* child_link = NULL;
+            bool has_child = false;
+
+            if ( node.m_Parm )
             {
-                offset = pl->m_Offset();
+                unordered_map< Parm*, vector< LinkTarget > >::iterator iter = m_LinkIndex.find( node.m_Parm );
+                int num_reg = ( iter != m_LinkIndex.end() ) ? ( int )iter->second.size() : 0;
+                const vector< AdvLink* > & adv_vec = AdvLinkMgr.GetInputLinks( node.m_Parm );
+
+                if ( node.m_NextChild < num_reg )
+                {
+                    child_parm = iter->second[ node.m_NextChild ].m_ParmB;
+                    has_child = true;
+                }
+                else if ( node.m_NextChild < num_reg + ( int )adv_vec.size() )
+                {
+                    child_link = adv_vec[ node.m_NextChild - num_reg ];
+                    has_child = true;
+                }
             }
-            double scale = 1.0;
-            if ( pl->GetScaleFlag() )
+            else
             {
-                scale = pl->m_Scale();
+                const vector< Parm* > & out_vec = AdvLinkMgr.GetOutputParms( node.m_AdvLink );
+                if ( node.m_NextChild < ( int )out_vec.size() )
+                {
+                    child_parm = out_vec[ node.m_NextChild ];
+                    has_child = true;
+                }
             }
 
-            double val = parm_ptr->Get() * scale + offset;
-
-            if ( pl->GetLowerLimitFlag() && val < pl->m_LowerLimit() )      // Constraints
+            if ( !has_child )
             {
-                val = pl->m_LowerLimit();
+                post_order.push_back( node );
+                stack.pop_back();
+                continue;
             }
 
-            if ( pl->GetUpperLimitFlag() && val > pl->m_UpperLimit() )      // Constraints
+            node.m_NextChild++;
+
+            //==== Skip Visited Nodes And Parms Already Updated By An Outer Propagation ====//
+            if ( child_parm )
+            {
+                if ( child_parm->GetLinkUpdateFlag() || m_BatchParms.find( child_parm ) != m_BatchParms.end() ||
+                     !visit_parms.insert( child_parm ).second )
+                {
+                    continue;
+                }
+            }
+            else if ( !visit_links.insert( child_link ).second )
             {
-                val = pl->m_UpperLimit();
+                continue;
             }
 
-            pB->SetFromLink( val );
+            SearchNode child;
+            child.m_Parm = child_parm;
+            child.m_AdvLink = child_link;
+            child.m_NextChild = 0;
+            stack.push_back( child );
         }
     }
 
-    //==== Update Adv Link ===//
-    if ( adv_link_flag )
+    m_BatchParms.insert( visit_parms.begin(), visit_parms.end() );
+    m_ChangedParms.insert( root_vec.begin(), root_vec.end() );
+
+    //==== Changed Parms Are Not Overwritten By Links From Each Other ====//
+    for ( int r = 0 ; r < ( int )root_vec.size() ; r++ )
     {
-        AdvLinkMgr.UpdateLinks( pid );
+        if ( !root_vec[r]->GetLinkUpdateFlag() )
+        {
+            root_vec[r]->SetLinkUpdateFlag( true );
+            m_UpdatedParmVec.push_back( root_vec[r] );
+        }
     }
 
-    //==== Clean Up ====/
-    if ( start_flag )      
+    //==== Update In Topological Order ====//
+    m_PropagateDepth++;
+
+    unordered_set< AdvLink* > triggered_links;
+    for ( int n = ( int )post_order.size() - 1 ; n >= 0 ; n-- )
     {
-        for ( int i = 0 ; i < ( int )m_UpdatedParmVec.size() ; i++ )
+        if ( post_order[n].m_AdvLink )
         {
-            Parm* parm_ptr = ParmMgr.FindParm( m_UpdatedParmVec[i] );
-            if ( parm_ptr )
+            AdvLink* link_ptr = post_order[n].m_AdvLink;
+            if ( triggered_links.find( link_ptr ) != triggered_links.end() )
             {
-                parm_ptr->SetLinkUpdateFlag( false );
+                link_ptr->ForceUpdate();
             }
+            continue;
         }
-        m_UpdatedParmVec.clear();
 
-        Vehicle* veh = VehicleMgr.GetVehicle();
-        if ( veh )
+        Parm* parm_ptr = post_order[n].m_Parm;
+        m_ProcessedParms.insert( parm_ptr );
+        if ( m_ChangedParms.find( parm_ptr ) == m_ChangedParms.end() )
         {
-            veh->ParmChanged( parm_ptr, Parm::SET );
+            continue;
+        }
+
+        //==== Set Link Update Flag ====//
+        if ( !parm_ptr->GetLinkUpdateFlag() )
+        {
+            parm_ptr->SetLinkUpdateFlag( true );
+            m_UpdatedParmVec.push_back( parm_ptr );
+        }
+
+        //==== Update Linked Parms (Copy In Case An Update Rebuilds The Index) ====//
+        vector< LinkTarget > target_vec;
+        unordered_map< Parm*, vector< LinkTarget > >::iterator iter = m_LinkIndex.find( parm_ptr );
+        if ( iter != m_LinkIndex.end() )
+        {
+            target_vec = iter->second;
         }
+
+        for ( int i = 0 ; i < ( int )target_vec.size() ; i++ )
+        {
+            Link* pl = target_vec[i].m_Link;
+            Parm* pB = target_vec[i].m_ParmB;
+
+            if ( pB->GetLinkUpdateFlag() == false )       // Prevent Circular
+            {
+                double offset = 0.0;
+                if ( pl->GetOffsetFlag() )
+                {
+                    offset = pl->m_Offset();
+                }
+                double scale = 1.0;
+                if ( pl->GetScaleFlag() )
+                {
+                    scale = pl->m_Scale();
+                }
+
+                double val = parm_ptr->Get() * scale + offset;
+
+                if ( pl->GetLowerLimitFlag() && val < pl->m_LowerLimit() )      // Constraints
+                {
+                    val = pl->m_LowerLimit();
+                }
+
+                if ( pl->GetUpperLimitFlag() && val > pl->m_UpperLimit() )      // Constraints
+                {
+                    val = pl->m_UpperLimit();
+                }
+
+                pB->SetFromLink( val );
+            }
+        }
+
+        //==== Adv Links Run Once After All Their Changed Inputs ====//
+        const vector< AdvLink* > & adv_vec = AdvLinkMgr.GetInputLinks( parm_ptr );
+        triggered_links.insert( adv_vec.begin(), adv_vec.end() );
     }
+
+    m_PropagateDepth--;
 }
 
 
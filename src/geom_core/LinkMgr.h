@@ -13,9 +13,22 @@
 
 #include "Link.h"
 #include <deque>
+#include <unordered_map>
+#include <unordered_set>
 using std::string;
 using std::vector;
 using std::deque;
+using std::unordered_map;
+using std::unordered_set;
+
+class AdvLink;
+
+//==== Link Resolved To Parm Pointers ====//
+struct LinkTarget
+{
+    Link* m_Link;
+    Parm* m_ParmB;
+};
 
 
 //==== Parm Link Manager ====//
@@ -44,9 +57,12 @@ public:
     virtual bool UsedInLink( const string & pid );
 
     virtual bool AddLink( const string& pA, const string& pB );         // Link Two Parms
-    virtual void AddLink( Link* link )                      {  m_LinkVec.push_back( link ); }
+    virtual void AddLink( Link* link )                      {  m_LinkVec.push_back( link ); IndexLink( link ); }
     virtual void ParmChanged( const string& pid, bool start_flag );     // A Parm Has Changed Check Links
 
+    virtual void BeginDeferredChanges();                    // Collect Changed Parms Instead Of Propagating
+    virtual int PropagateDeferredChanges();                 // Propagate Collected Parms As One Batch
+
     virtual void SetCurrLinkIndex( int i )                  { m_CurrLinkIndex = i; }
     virtual int  GetCurrLinkIndex()                         { return m_CurrLinkIndex; }
     virtual Link* GetCurrLink();
@@ -98,6 +114,13 @@ private:
     void Init();
     void Wype();
 
+    //==== Link Index ====//
+    void IndexLink( Link* link );
+    void BuildLinkIndex();
+    void PropagateChange( const vector< Parm* > & root_vec );
+    void PropagateRequeued( const vector< Parm* > & root_vec );
+    void EndPropagation();
+
     int m_CurrLinkIndex;
     Link *m_WorkingLink;
 
@@ -105,7 +128,21 @@ private:
 
     deque< Link* > m_LinkVec;
 
-    vector< string > m_UpdatedParmVec;      // Keep Track Of Linked Parm To Prevent Circular Links
+    vector< Parm* > m_UpdatedParmVec;       // Keep Track Of Linked Parm To Prevent Circular Links
+
+    unordered_map< Parm*, vector< LinkTarget > > m_LinkIndex;  // ParmA -> Links Driven By It
+    bool m_LinkIndexDirty;
+    int m_LinkIndexStamp;
+
+    int m_PropagateDepth;                   // Nesting Of Running Propagations
+    unordered_set< Parm* > m_BatchParms;    // Parms Reached By Running Propagations
+    unordered_set< Parm* > m_ChangedParms;  // Batch Parms Whose Value Actually Changed
+    unordered_set< Parm* > m_ProcessedParms;  // Batch Parms Whose Turn In The Order Has Passed
+    vector< Parm* > m_RequeueParmVec;       // Processed Parms That Changed Again - Propagated In Another Pass
+
+    bool m_DeferChanges;
+    vector< string > m_DeferredParmVec;     // IDs Of Changed Parms Waiting For PropagateDeferredChanges
+    unordered_set< string > m_DeferredParmIDs;  // Same IDs For Duplicate Checks
 
     vector< string > m_BaseLinkableContainers;              // Base Registered Parm Containers
     vector< string > m_LinkableContainers;                  // All valid Linkable Container
@@ -2886,6 +2886,7 @@ void MeshGeom::MassSliceX( int numSlices, bool writefile )
     res->Add( NameValData( "Num_Open_Meshes_Removed", info.m_NumOpenMeshedDeleted ) );
     res->Add( NameValData( "Num_Open_Meshes_Merged", info.m_NumOpenMeshesMerged ) );
     res->Add( NameValData( "Mesh_GeomID", this->GetID() ) );
+    res->Add( NameValData( "Mass_Prop_Mode", vsp::MASS_PROP_SLICE ) );
 
     //==== Count Tris ====//
     int numTris = 0;
@@ -3321,14 +3322,399 @@ void MeshGeom::MassSliceX( int numSlices, bool writefile )
     }
 }
 
-void MeshGeom::degenGeomMassSliceX( vector< DegenGeom > &degenGeom )
+//==== Order Of Moments Stored By MassSurfIntegral ====//
+// 0: mass (or volume), 1-3: first moments, 4-6: xx, yy, zz, 7-9: xy, xz, yz
+#define NUM_MASS_MOM 10
+
+//==== Does Mesh A Take Precedence Over Mesh B - Matches MassDeterIntExtTri ====//
+static bool MassOutRanks( TMesh* a, int ia, TMesh* b, int ib )
 {
-    int i, j, s, numSlices = 250;
+    if ( a->m_MassPrior != b->m_MassPrior )
+    {
+        return a->m_MassPrior > b->m_MassPrior;
+    }
+    return ia < ib;
+}
+
+//==== Add Volume Moments Of Signed Tetrahedron (Origin, v0, v1, v2) ====//
+static void AddTetraMoments( double* mom, double vol, const vec3d & v0, const vec3d & v1, const vec3d & v2 )
+{
+    vec3d sum = v0 + v1 + v2;
+    double f = vol / 20.0;
+
+    mom[0] += vol;
+    mom[1] += 0.25 * vol * sum.x();
+    mom[2] += 0.25 * vol * sum.y();
+    mom[3] += 0.25 * vol * sum.z();
+
+    mom[4] += f * ( v0.x() * v0.x() + v1.x() * v1.x() + v2.x() * v2.x() + sum.x() * sum.x() );
+    mom[5] += f * ( v0.y() * v0.y() + v1.y() * v1.y() + v2.y() * v2.y() + sum.y() * sum.y() );
+    mom[6] += f * ( v0.z() * v0.z() + v1.z() * v1.z() + v2.z() * v2.z() + sum.z() * sum.z() );
+
+    mom[7] += f * ( v0.x() * v0.y() + v1.x() * v1.y() + v2.x() * v2.y() + sum.x() * sum.y() );
+    mom[8] += f * ( v0.x() * v0.z() + v1.x() * v1.z() + v2.x() * v2.z() + sum.x() * sum.z() );
+    mom[9] += f * ( v0.y() * v0.z() + v1.y() * v1.z() + v2.y() * v2.z() + sum.y() * sum.z() );
+}
+
+//==== Add Point Mass Moments (Position Relative To Reference Point) ====//
+static void AddPointMoments( double* mom, double mass, const vec3d & p )
+{
+    mom[0] += mass;
+    mom[1] += mass * p.x();
+    mom[2] += mass * p.y();
+    mom[3] += mass * p.z();
+    mom[4] += mass * p.x() * p.x();
+    mom[5] += mass * p.y() * p.y();
+    mom[6] += mass * p.z() * p.z();
+    mom[7] += mass * p.x() * p.y();
+    mom[8] += mass * p.x() * p.z();
+    mom[9] += mass * p.y() * p.z();
+}
+
+//==== Convert Moments About Reference Point To CG And Inertia About CG ====//
+static void MomentsToMassProps( const double* mom, const vec3d & ref, vec3d & cg, double* inertia )
+{
+    vec3d c( 0, 0, 0 );
+    if ( mom[0] )
+    {
+        c = vec3d( mom[1], mom[2], mom[3] ) * ( 1.0 / mom[0] );
+    }
+    cg = c + ref;
+
+    inertia[0] = mom[5] + mom[6] - mom[0] * ( c.y() * c.y() + c.z() * c.z() );
+    inertia[1] = mom[4] + mom[6] - mom[0] * ( c.x() * c.x() + c.z() * c.z() );
+    inertia[2] = mom[4] + mom[5] - mom[0] * ( c.x() * c.x() + c.y() * c.y() );
+    inertia[3] = mom[7] - mom[0] * c.x() * c.y();
+    inertia[4] = mom[8] - mom[0] * c.x() * c.z();
+    inertia[5] = mom[9] - mom[0] * c.y() * c.z();
+}
+
+//==== Compute Mass Properties With Divergence Theorem Over Trimmed Surfaces ====//
+// Each exterior piece of a component surface closes the region owned by that
+// component (and, reversed, the region of the component it is buried in), so
+// volume, CG and inertia follow from signed tetrahedra swept from a reference
+// point - no slice meshes or prisms are built.
+void MeshGeom::MassSurfIntegral( bool writefile )
+{
+    int i, j, s;
 
     //==== Check For Open Meshes and Merge or Delete Them ====//
     MeshInfo info;
     MergeRemoveOpenMeshes( &info );
 
+    //==== Create Results ====//
+    Results* res = ResultsMgr.CreateResults( "Mass_Properties" );
+    res->Add( NameValData( "Num_Degen_Triangles_Removed", info.m_NumDegenerateTriDeleted ) );
+    res->Add( NameValData( "Num_Open_Meshes_Removed", info.m_NumOpenMeshedDeleted ) );
+    res->Add( NameValData( "Num_Open_Meshes_Merged", info.m_NumOpenMeshesMerged ) );
+    res->Add( NameValData( "Mesh_GeomID", this->GetID() ) );
+    res->Add( NameValData( "Mass_Prop_Mode", vsp::MASS_PROP_SURF_INTEGRAL ) );
+
+    //==== Count Tris ====//
+    int numTris = 0;
+    for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
+    {
+        numTris += m_TMeshVec[i]->m_TVec.size();
+    }
+
+    //==== Augment ID with index to make symmetric copies unique. ====//
+    for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
+    {
+        m_TMeshVec[i]->m_PtrID.append( std::to_string( (long long) i ) );
+    }
+
+    res->Add( NameValData( "Num_Total_Meshes", ( int )m_TMeshVec.size() ) );
+    res->Add( NameValData( "Num_Total_Tris", numTris ) );
+
+    //==== Create Bnd Box for  Mesh Geoms ====//
+    BndBox b;
+    for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
+    {
+        m_TMeshVec[i]->LoadBndBox();
+        b.Update( m_TMeshVec[i]->m_TBox.m_Box );
+    }
+    m_BBox = b;
+
+    //==== Intersect All Mesh Geoms ====//
+    for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
+    {
+        for ( j = i + 1 ; j < ( int )m_TMeshVec.size() ; j++ )
+        {
+            m_TMeshVec[i]->Intersect( m_TMeshVec[j] );
+        }
+    }
+
+    //==== Split Intersected Tri in Mesh ====//
+    for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
+    {
+        m_TMeshVec[i]->Split();
+    }
+
+    //==== Gather Leaf Tris ====//
+    vector< TTri* > triVec;
+    vector< int > triMeshVec;
+    for ( s = 0 ; s < ( int )m_TMeshVec.size() ; s++ )
+    {
+        TMesh* tm = m_TMeshVec[s];
+        for ( i = 0 ; i < ( int )tm->m_TVec.size() ; i++ )
+        {
+            TTri* tri = tm->m_TVec[i];
+            if ( tri->m_SplitVec.size() )
+            {
+                tri->m_InteriorFlag = 1;
+                for ( j = 0 ; j < ( int )tri->m_SplitVec.size() ; j++ )
+                {
+                    triVec.push_back( tri->m_SplitVec[j] );
+                    triMeshVec.push_back( s );
+                }
+            }
+            else
+            {
+                triVec.push_back( tri );
+                triMeshVec.push_back( s );
+            }
+        }
+    }
+
+    int nmesh = ( int )m_TMeshVec.size();
+    int ntri = ( int )triVec.size();
+    vec3d ref = m_BBox.GetCenter();
+
+    //==== Unit Density Volume Moments And Shell Mass Moments Per Mesh ====//
+    vector< double > volMom( nmesh * NUM_MASS_MOM, 0.0 );
+    vector< double > shellMom( nmesh * NUM_MASS_MOM, 0.0 );
+
+    #pragma omp parallel private( i, j )
+    {
+        vector< double > locVolMom( nmesh * NUM_MASS_MOM, 0.0 );
+        vector< double > locShellMom( nmesh * NUM_MASS_MOM, 0.0 );
+        vector< double > tParmVec;
+        vec3d dir( 1.0, 0.000001, 0.000001 );
+
+        #pragma omp for schedule( dynamic, 256 )
+        for ( i = 0 ; i < ntri ; i++ )
+        {
+            TTri* tri = triVec[i];
+            int k = triMeshVec[i];
+            TMesh* tm = m_TMeshVec[k];
+
+            //==== Find Highest Ranked Mesh Enclosing This Tri ====//
+            vec3d orig = ( tri->m_N0->m_Pnt + tri->m_N1->m_Pnt ) * 0.5;
+            orig = ( orig + tri->m_N2->m_Pnt ) * 0.5;
+
+            int outer = -1;
+            for ( int m = 0 ; m < nmesh ; m++ )
+            {
+                if ( m != k )
+                {
+                    tParmVec.clear();
+                    m_TMeshVec[m]->m_TBox.RayCast( orig, dir, tParmVec );
+                    if ( tParmVec.size() % 2 )
+                    {
+                        if ( outer < 0 || MassOutRanks( m_TMeshVec[m], m, m_TMeshVec[outer], outer ) )
+                        {
+                            outer = m;
+                        }
+                    }
+                }
+            }
+            tri->m_InteriorFlag = ( outer >= 0 );
+
+            //==== Shell Contribution - Exterior Tris Only ====//
+            if ( outer < 0 && tm->m_ShellFlag )
+            {
+                TriShellMassProp tsmp( tm->m_PtrID, tm->m_ShellMassArea,
+                                       tri->m_N0->m_Pnt, tri->m_N1->m_Pnt, tri->m_N2->m_Pnt );
+
+                double* mom = &locShellMom[ k * NUM_MASS_MOM ];
+                AddPointMoments( mom, tsmp.m_Mass, tsmp.m_CG - ref );
+                mom[4] += 0.5 * ( tsmp.m_Iyy + tsmp.m_Izz - tsmp.m_Ixx );
+                mom[5] += 0.5 * ( tsmp.m_Ixx + tsmp.m_Izz - tsmp.m_Iyy );
+                mom[6] += 0.5 * ( tsmp.m_Ixx + tsmp.m_Iyy - tsmp.m_Izz );
+                mom[7] += tsmp.m_Ixy;
+                mom[8] += tsmp.m_Ixz;
+                mom[9] += tsmp.m_Iyz;
+            }
+
+            //==== Tri Only Bounds A Region If Its Mesh Owns The Inside ====//
+            if ( outer >= 0 && !MassOutRanks( tm, k, m_TMeshVec[outer], outer ) )
+            {
+                continue;
+            }
+
+            vec3d v0 = tri->m_N0->m_Pnt - ref;
+            vec3d v1 = tri->m_N1->m_Pnt - ref;
+            vec3d v2 = tri->m_N2->m_Pnt - ref;
+
+            double vol = dot( v0, cross( v1, v2 ) ) / 6.0;
+
+            //==== Orient Outward Using Surface Normal ====//
+            if ( dot( cross( v1 - v0, v2 - v0 ), tri->m_Norm ) < 0.0 )
+            {
+                vol = -vol;
+            }
+
+            AddTetraMoments( &locVolMom[ k * NUM_MASS_MOM ], vol, v0, v1, v2 );
+
+            //==== Same Surface Closes The Enclosing Region From Inside ====//
+            if ( outer >= 0 )
+            {
+                AddTetraMoments( &locVolMom[ outer * NUM_MASS_MOM ], -vol, v0, v1, v2 );
+            }
+        }
+
+        #pragma omp critical
+        {
+            for ( j = 0 ; j < nmesh * NUM_MASS_MOM ; j++ )
+            {
+                volMom[j] += locVolMom[j];
+                shellMom[j] += locShellMom[j];
+            }
+        }
+    }
+
+    //==== Combine Into Component And Total Properties ====//
+    vector< string > name_vec;
+    vector< string > id_vec;
+    vector< double > mass_vec;
+    vector< vec3d > cg_vec;
+    vector< double > ixx_vec;
+    vector< double > iyy_vec;
+    vector< double > izz_vec;
+    vector< double > ixy_vec;
+    vector< double > ixz_vec;
+    vector< double > iyz_vec;
+    vector< double > vol_vec;
+
+    double totalMom[NUM_MASS_MOM] = { 0.0 };
+    double totalVol = 0.0;
+
+    for ( s = 0 ; s < nmesh ; s++ )
+    {
+        TMesh* tm = m_TMeshVec[s];
+        double* vmom = &volMom[ s * NUM_MASS_MOM ];
+        double* smom = &shellMom[ s * NUM_MASS_MOM ];
+
+        double compMom[NUM_MASS_MOM];
+        for ( j = 0 ; j < NUM_MASS_MOM ; j++ )
+        {
+            compMom[j] = tm->m_Density * vmom[j] + smom[j];
+            totalMom[j] += compMom[j];
+        }
+        totalVol += vmom[0];
+
+        vec3d cg;
+        double inertia[6];
+        MomentsToMassProps( compMom, ref, cg, inertia );
+
+        //==== Load Component Results ====//
+        name_vec.push_back( tm->m_NameStr );
+        id_vec.push_back( tm->m_PtrID );
+        mass_vec.push_back( compMom[0] );
+        cg_vec.push_back( cg );
+        ixx_vec.push_back( inertia[0] );
+        iyy_vec.push_back( inertia[1] );
+        izz_vec.push_back( inertia[2] );
+        ixy_vec.push_back( inertia[3] );
+        ixz_vec.push_back( inertia[4] );
+        iyz_vec.push_back( inertia[5] );
+        vol_vec.push_back( vmom[0] );
+    }
+
+    //==== Add in Point Masses ====//
+    for ( i = 0 ; i < ( int )m_PointMassVec.size() ; i++ )
+    {
+        AddPointMoments( totalMom, m_PointMassVec[i]->m_Mass, m_PointMassVec[i]->m_CG - ref );
+    }
+
+    double totalInertia[6];
+    MomentsToMassProps( totalMom, ref, m_CenterOfGrav, totalInertia );
+
+    m_MassPropFlag = 1;
+    m_TotalMass = totalMom[0];
+    m_TotalIxx = totalInertia[0];
+    m_TotalIyy = totalInertia[1];
+    m_TotalIzz = totalInertia[2];
+    m_TotalIxy = totalInertia[3];
+    m_TotalIxz = totalInertia[4];
+    m_TotalIyz = totalInertia[5];
+
+    res->Add( NameValData( "Num_Comps", ( int )name_vec.size() ) );
+    res->Add( NameValData( "Comp_Name", name_vec ) );
+    res->Add( NameValData( "Comp_ID", id_vec ) );
+    res->Add( NameValData( "Comp_Mass", mass_vec ) );
+    res->Add( NameValData( "Comp_CG", cg_vec ) );
+    res->Add( NameValData( "Comp_Ixx", ixx_vec ) );
+    res->Add( NameValData( "Comp_Iyy", iyy_vec ) );
+    res->Add( NameValData( "Comp_Izz", izz_vec ) );
+    res->Add( NameValData( "Comp_Ixy", ixy_vec ) );
+    res->Add( NameValData( "Comp_Ixz", ixz_vec ) );
+    res->Add( NameValData( "Comp_Iyz", iyz_vec ) );
+    res->Add( NameValData( "Comp_Vol", vol_vec ) );
+
+    //==== Totals ====//
+    res->Add( NameValData( "Total_Mass", m_TotalMass ) );
+    res->Add( NameValData( "Total_CG", m_CenterOfGrav ) );
+    res->Add( NameValData( "Total_Ixx", m_TotalIxx ) );
+    res->Add( NameValData( "Total_Iyy", m_TotalIyy ) );
+    res->Add( NameValData( "Total_Izz", m_TotalIzz ) );
+    res->Add( NameValData( "Total_Ixy", m_TotalIxy ) );
+    res->Add( NameValData( "Total_Ixz", m_TotalIxz ) );
+    res->Add( NameValData( "Total_Iyz", m_TotalIyz ) );
+    res->Add( NameValData( "Total_Volume", totalVol ) );
+
+    //==== Get Rid of TMeshes  that are not shells ====//
+    vector<TMesh*> newTMeshVec;
+    for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
+    {
+        if ( m_TMeshVec[i]->m_ShellFlag )
+        {
+            newTMeshVec.push_back( m_TMeshVec[i] );
+        }
+        else
+        {
+            delete m_TMeshVec[i];
+        }
+    }
+    m_TMeshVec = newTMeshVec;
+
+    if( writefile )
+    {
+        string f_name = m_Vehicle->getExportFileName( vsp::MASS_PROP_TXT_TYPE );
+        res->WriteMassProp( f_name );
+    }
+}
+
+//==== Intersected - Reuse Meshes Already Processed by degenGeomIntersectTrim ====//
+void MeshGeom::degenGeomMassSliceX( vector< DegenGeom > &degenGeom, bool intersected )
+{
+    int i, j, s, numSlices = 250;
+
+    if ( !intersected )
+    {
+        //==== Check For Open Meshes and Merge or Delete Them ====//
+        MeshInfo info;
+        MergeRemoveOpenMeshes( &info );
+    }
+    else
+    {
+        //==== Intersection Edges Have Already Been Consumed by Split ====//
+        for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
+        {
+            for ( j = 0 ; j < ( int )m_TMeshVec[i]->m_TVec.size() ; j++ )
+            {
+                TTri* tri = m_TMeshVec[i]->m_TVec[j];
+                for ( int e = 0 ; e < ( int )tri->m_ISectEdgeVec.size() ; e++ )
+                {
+                    delete tri->m_ISectEdgeVec[e]->m_N0;
+                    delete tri->m_ISectEdgeVec[e]->m_N1;
+                    delete tri->m_ISectEdgeVec[e];
+                }
+                tri->m_ISectEdgeVec.clear();
+            }
+        }
+    }
+
     //==== Augment ID with index to make symmetric copies unique. ====//
     for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
     {
@@ -3416,26 +3802,28 @@ void MeshGeom::degenGeomMassSliceX( vector< DegenGeom > &degenGeom )
         tm->MassDeterIntExt( m_TMeshVec );
     }
 
-
-    //==== Intersect All Mesh Geoms ====//
-    for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
+    if ( !intersected )
     {
-        for ( j = i + 1 ; j < ( int )m_TMeshVec.size() ; j++ )
+        //==== Intersect All Mesh Geoms ====//
+        for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
         {
-            m_TMeshVec[i]->Intersect( m_TMeshVec[j] );
+            for ( j = i + 1 ; j < ( int )m_TMeshVec.size() ; j++ )
+            {
+                m_TMeshVec[i]->Intersect( m_TMeshVec[j] );
+            }
         }
-    }
 
-    //==== Split Intersected Tri in Mesh ====//
-    for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
-    {
-        m_TMeshVec[i]->Split();
-    }
+        //==== Split Intersected Tri in Mesh ====//
+        for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
+        {
+            m_TMeshVec[i]->Split();
+        }
 
-    //==== Determine Which Triangle Are Interior/Exterior ====//
-    for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
-    {
-        m_TMeshVec[i]->DeterIntExt( m_TMeshVec );
+        //==== Determine Which Triangle Are Interior/Exterior ====//
+        for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
+        {
+            m_TMeshVec[i]->DeterIntExt( m_TMeshVec );
+        }
     }
 
     //==== Do Shell Calcs ====//
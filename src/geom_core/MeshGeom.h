@@ -156,7 +156,8 @@ public:
     virtual void IntersectTrim( int halfFlag = 0, int intSubsFlag = 1 );
     virtual void degenGeomIntersectTrim( vector< DegenGeom > &degenGeom );
     virtual void MassSliceX( int numSlice, bool writefile = true );
-    virtual void degenGeomMassSliceX( vector< DegenGeom > &degenGeom );
+    virtual void MassSurfIntegral( bool writefile = true );
+    virtual void degenGeomMassSliceX( vector< DegenGeom > &degenGeom, bool intersected = false );
     virtual void AreaSlice( int numSlices, vec3d norm, bool autoBounds, double start = 0, double end = 0 );
 
     virtual void WaveStartEnd( const double &sliceAngle, const vec3d &center );
@@ -11,6 +11,7 @@
 #include "VehicleMgr.h"
 #include "UsingCpp11.h"
 #include "APIDefines.h"
+#include "Util.h"
 #include <assert.h>
 #include <time.h>
 #include <algorithm>
@@ -44,6 +45,7 @@ bool ParmMgrSingleton::AddParm( Parm* p  )
     }
 
     //==== Check If Already Added ====//
+    std::lock_guard< std::mutex > lock( m_MapMutex );
     if ( m_ParmMap.find( p->GetID() ) != m_ParmMap.end() )
     {
         return false;
@@ -58,6 +60,8 @@ bool ParmMgrSingleton::AddParm( Parm* p  )
 //==== Remove Parm From Map ====//
 void ParmMgrSingleton::RemoveParm( Parm* p  )
 {
+    std::lock_guard< std::mutex > lock( m_MapMutex );
+
     unordered_map< string, Parm* >::iterator iter;
     iter = m_ParmMap.find( p->GetID() );
 
@@ -73,6 +77,7 @@ void ParmMgrSingleton::AddParmContainer( ParmContainer* pc  )
 {
     if ( pc )
     {
+        std::lock_guard< std::mutex > lock( m_MapMutex );
         m_NumParmChanges++;
         m_ParmContainerMap[pc->GetID()] = pc;
     }
@@ -81,6 +86,8 @@ void ParmMgrSingleton::AddParmContainer( ParmContainer* pc  )
 //==== Remove Parm Container From Map ====//
 void ParmMgrSingleton::RemoveParmContainer( ParmContainer* pc  )
 {
+    std::lock_guard< std::mutex > lock( m_MapMutex );
+
     unordered_map< string, ParmContainer* >::iterator iter;
     iter = m_ParmContainerMap.find( pc->GetID() );
 
@@ -108,6 +115,8 @@ bool NameCompare( const string a, const string b )
 //==== Find Parm GivenID ====//
 Parm* ParmMgrSingleton::FindParm( const string & id )
 {
+    std::lock_guard< std::mutex > lock( m_MapMutex );
+
     unordered_map< string, Parm* >::iterator iter;
 
     iter = m_ParmMap.find( id );
@@ -121,6 +130,8 @@ Parm* ParmMgrSingleton::FindParm( const string & id )
 //==== Find Parm Name Group Container ====//
 string ParmMgrSingleton::FindParmID( const string & name, const string & group, const string & container )
 {
+    std::lock_guard< std::mutex > lock( m_MapMutex );
+
     unordered_map< string, Parm* >::iterator iter;
 
     for ( iter = m_ParmMap.begin() ; iter != m_ParmMap.end() ; iter++ )
@@ -144,6 +155,8 @@ string ParmMgrSingleton::FindParmID( const string & name, const string & group,
 //==== Find Parm Container GivenID ====//
 ParmContainer* ParmMgrSingleton::FindParmContainer( const string & id )
 {
+    std::lock_guard< std::mutex > lock( m_MapMutex );
+
     unordered_map< string, ParmContainer* >::iterator iter;
 
     iter = m_ParmContainerMap.find( id );
@@ -196,21 +209,7 @@ void ParmMgrSingleton::UnDo()
 //==== Create A Unique ID  =====//
 string ParmMgrSingleton::GenerateID( int length )
 {
-    static bool seed = false;
-    if ( !seed )
-    {
-        seed = true;
-        srand( ( unsigned int )time( NULL ) );
-    }
-
-    static char str[256];
-    for ( int i = 0 ; i < length ; i++ )
-    {
-        str[i] = ( char )( ( rand() % 26 ) + 65 );
-    }
-    string id( str, length );
-
-    return id;
+    return GenerateRandomID( length );
 }
 
 
@@ -250,6 +249,8 @@ string ParmMgrSingleton::RemapID( const string & oldID, const string & suggestID
         return oldID;
     }
 
+    std::lock_guard< std::mutex > lock( m_RemapMutex );
+
     newID = m_IDRemap[oldID];
 
     if( newID.compare( "" ) == 0 )                          // oldID not yet in map
@@ -287,6 +288,7 @@ string ParmMgrSingleton::RemapID( const string & oldID, const string & suggestID
 
 void ParmMgrSingleton::ResetRemapID()
 {
+    std::lock_guard< std::mutex > lock( m_RemapMutex );
     m_IDRemap.clear();
 }
 
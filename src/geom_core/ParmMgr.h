@@ -20,6 +20,8 @@
 #include <map>
 #include <unordered_map>
 #include <stack>
+#include <mutex>
+#include <atomic>
 
 using std::string;
 using std::unordered_map;
@@ -44,8 +46,11 @@ private:
 
     unordered_map< string, string > m_IDRemap;                      // oldID->newID Map
 
-    int m_NumParmChanges;
-    int m_ChangeCnt;
+    std::mutex m_MapMutex;                                          // Guards Parm And Container Maps
+    std::mutex m_RemapMutex;                                        // Guards ID Remap
+
+    std::atomic< int > m_NumParmChanges;
+    std::atomic< int > m_ChangeCnt;
 
     string RemapID( const string & oldID, const string & suggestID, int size );
 
@@ -78,7 +83,7 @@ public:
     string GetActiveParmID()                { return m_ActiveParmID; }
     Parm* GetActiveParm()                   { return FindParm( m_ActiveParmID ); }
     int GetNumParmChanges()                 { return m_NumParmChanges; }
-    int GetChangeCnt()                      { m_ChangeCnt++; return m_ChangeCnt; }
+    int GetChangeCnt()                      { return ++m_ChangeCnt; }
 
     Parm* CreateParm( int type );
 
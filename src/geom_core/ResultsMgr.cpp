@@ -14,6 +14,8 @@
 #include "Util.h"
 #include "StlHelper.h"
 #include <ctime>
+#include <cstring>
+#include <algorithm>
 
 #ifdef WIN32
 #include <windows.h>
@@ -169,8 +171,10 @@ vector< string > NameValCollection::GetAllDataNames()
 }
 
 //==== Find Res Data Given Name and Index ====//
-NameValData NameValCollection::Find( const string & name, int index )
+const NameValData & NameValCollection::Find( const string & name, int index )
 {
+    static const NameValData default_data;
+
     map< string, vector< NameValData > >::iterator iter = m_DataMap.find( name );
 
     if ( iter !=  m_DataMap.end() )
@@ -180,7 +184,7 @@ NameValData NameValCollection::Find( const string & name, int index )
             return iter->second[index];
         }
     }
-    return NameValData();
+    return default_data;
 }
 
 //==== Find Res Data Given Name and Index ====//
@@ -211,7 +215,13 @@ Results::Results( const string & name, const string & id ) : NameValCollection(
 //===== Find Current Time and Set Stamp =====//
 void Results::SetDateTime()
 {
-    m_Timestamp = time( 0 ); // get time now
+    SetDateTime( time( 0 ) ); // get time now
+}
+
+//===== Set Stamp From Given Time =====//
+void Results::SetDateTime( time_t stamp )
+{
+    m_Timestamp = stamp;
     struct tm * now = localtime( &m_Timestamp );
 
     m_Year = now->tm_year + 1900;
@@ -284,6 +294,200 @@ void Results::WriteCSVFile( FILE* fid )
     }
 }
 
+//==== Binary Results Helpers - Native Byte Order, Checked Against File Header ====//
+static void WriteBinaryString( FILE* fid, const string & str )
+{
+    int len = ( int )str.size();
+    fwrite( &len, sizeof( int ), 1, fid );
+    if ( len > 0 )
+    {
+        fwrite( str.data(), 1, len, fid );
+    }
+}
+
+static bool ReadBinaryString( FILE* fid, string & str )
+{
+    int len = 0;
+    if ( fread( &len, sizeof( int ), 1, fid ) != 1 || len < 0 )
+    {
+        return false;
+    }
+
+    str.resize( len );
+    if ( len > 0 && fread( &str[0], 1, len, fid ) != ( size_t )len )
+    {
+        return false;
+    }
+    return true;
+}
+
+//===== Write All Data As One Record Per Entry With A Bulk Payload =====//
+void Results::WriteBinary( FILE* fid )
+{
+    if ( !fid )
+    {
+        return;
+    }
+
+    WriteBinaryString( fid, m_Name );
+
+    long long stamp = ( long long )m_Timestamp;
+    fwrite( &stamp, sizeof( long long ), 1, fid );
+
+    int num_data = 0;
+    map< string, vector< NameValData > >::iterator iter;
+    for ( iter = m_DataMap.begin() ; iter != m_DataMap.end() ; iter++ )
+    {
+        num_data += ( int )iter->second.size();
+    }
+    fwrite( &num_data, sizeof( int ), 1, fid );
+
+    for ( iter = m_DataMap.begin() ; iter != m_DataMap.end() ; iter++ )
+    {
+        for ( int i = 0 ; i < ( int )iter->second.size() ; i++ )
+        {
+            const NameValData & nvd = iter->second[i];
+            int type = nvd.GetType();
+            int num = 0;
+
+            WriteBinaryString( fid, nvd.GetName() );
+            fwrite( &type, sizeof( int ), 1, fid );
+
+            if ( type == vsp::INT_DATA )
+            {
+                num = ( int )nvd.GetIntData().size();
+                fwrite( &num, sizeof( int ), 1, fid );
+                if ( num > 0 )
+                {
+                    fwrite( &nvd.GetIntData()[0], sizeof( int ), num, fid );
+                }
+            }
+            else if ( type == vsp::DOUBLE_DATA )
+            {
+                num = ( int )nvd.GetDoubleData().size();
+                fwrite( &num, sizeof( int ), 1, fid );
+                if ( num > 0 )
+                {
+                    fwrite( &nvd.GetDoubleData()[0], sizeof( double ), num, fid );
+                }
+            }
+            else if ( type == vsp::STRING_DATA )
+            {
+                num = ( int )nvd.GetStringData().size();
+                fwrite( &num, sizeof( int ), 1, fid );
+                for ( int d = 0 ; d < num ; d++ )
+                {
+                    WriteBinaryString( fid, nvd.GetStringData()[d] );
+                }
+            }
+            else if ( type == vsp::VEC3D_DATA )
+            {
+                const vector< vec3d > & v_data = nvd.GetVec3dData();
+                num = ( int )v_data.size();
+                fwrite( &num, sizeof( int ), 1, fid );
+
+                vector< double > xyz( 3 * num );
+                for ( int d = 0 ; d < num ; d++ )
+                {
+                    xyz[3 * d    ] = v_data[d].x();
+                    xyz[3 * d + 1] = v_data[d].y();
+                    xyz[3 * d + 2] = v_data[d].z();
+                }
+                if ( num > 0 )
+                {
+                    fwrite( &xyz[0], sizeof( double ), 3 * num, fid );
+                }
+            }
+            else
+            {
+                fwrite( &num, sizeof( int ), 1, fid );
+            }
+        }
+    }
+}
+
+//===== Read Data Written By WriteBinary - Name Is Read By The Caller =====//
+bool Results::ReadBinary( FILE* fid )
+{
+    long long stamp = 0;
+    int num_data = 0;
+
+    if ( !fid ||
+         fread( &stamp, sizeof( long long ), 1, fid ) != 1 ||
+         fread( &num_data, sizeof( int ), 1, fid ) != 1 || num_data < 0 )
+    {
+        return false;
+    }
+    SetDateTime( ( time_t )stamp );
+
+    for ( int i = 0 ; i < num_data ; i++ )
+    {
+        string name;
+        int type = 0;
+        int num = 0;
+
+        if ( !ReadBinaryString( fid, name ) ||
+             fread( &type, sizeof( int ), 1, fid ) != 1 ||
+             fread( &num, sizeof( int ), 1, fid ) != 1 || num < 0 )
+        {
+            return false;
+        }
+
+        if ( type == vsp::INT_DATA )
+        {
+            vector< int > i_data( num );
+            if ( num > 0 && fread( &i_data[0], sizeof( int ), num, fid ) != ( size_t )num )
+            {
+                return false;
+            }
+            Add( NameValData( name, i_data ) );
+        }
+        else if ( type == vsp::DOUBLE_DATA )
+        {
+            vector< double > d_data( num );
+            if ( num > 0 && fread( &d_data[0], sizeof( double ), num, fid ) != ( size_t )num )
+            {
+                return false;
+            }
+            Add( NameValData( name, d_data ) );
+        }
+        else if ( type == vsp::STRING_DATA )
+        {
+            vector< string > s_data( num );
+            for ( int d = 0 ; d < num ; d++ )
+            {
+                if ( !ReadBinaryString( fid, s_data[d] ) )
+                {
+                    return false;
+                }
+            }
+            Add( NameValData( name, s_data ) );
+        }
+        else if ( type == vsp::VEC3D_DATA )
+        {
+            vector< double > xyz( 3 * num );
+            if ( num > 0 && fread( &xyz[0], sizeof( double ), 3 * num, fid ) != ( size_t )( 3 * num ) )
+            {
+                return false;
+            }
+
+            vector< vec3d > v_data( num );
+            for ( int d = 0 ; d < num ; d++ )
+            {
+                v_data[d].set_xyz( xyz[3 * d], xyz[3 * d + 1], xyz[3 * d + 2] );
+            }
+            Add( NameValData( name, v_data ) );
+        }
+        else
+        {
+            NameValData nvd( name );
+            nvd.Init( name, type );
+            Add( nvd );
+        }
+    }
+    return true;
+}
+
 //==== Write The Mass Prop Results ====//
 void Results::WriteMassProp( const string & file_name )
 {
@@ -606,11 +810,18 @@ ResultsMgrSingleton::~ResultsMgrSingleton()
 //==== Create and Add Results Object and Return Ptr ====//
 Results* ResultsMgrSingleton::CreateResults( const string & name )
 {
+    std::lock_guard< std::recursive_mutex > lock( m_ResultsMutex );
+
     string id = GenerateRandomID( 7 );
+    while ( m_ResultsMap.find( id ) != m_ResultsMap.end() )   // Many Results Make Collisions Likely
+    {
+        id = GenerateRandomID( 7 );
+    }
     Results* res_ptr = new Results( name, id );     // Create Results
 
     m_ResultsMap[id] = res_ptr;                     // Map ID to Ptr
     m_NameIDMap[name].push_back( id );              // Map Name to Vector of IDs
+    m_LatestIDMap[name] = id;                       // Newest Stamp Wins Ties Like FindLatestResultsID
     return res_ptr;
 }
 
@@ -618,6 +829,8 @@ Results* ResultsMgrSingleton::CreateResults( const string & name )
 //==== Create Results And Load With Geometry Data ====//
 string ResultsMgrSingleton::CreateGeomResults( const string & geom_id, const string & name )
 {
+    std::lock_guard< std::recursive_mutex > lock( m_ResultsMutex );
+
     Results* res_ptr = CreateResults( name );
 
     Vehicle* veh = VehicleMgr.GetVehicle();
@@ -641,61 +854,94 @@ string ResultsMgrSingleton::CreateGeomResults( const string & geom_id, const str
 //==== Delete All Results ====//
 void ResultsMgrSingleton::DeleteAllResults()
 {
+    std::lock_guard< std::recursive_mutex > lock( m_ResultsMutex );
+
     //==== Delete All Created Results =====//
-    map< string, Results* >::iterator iter;
+    unordered_map< string, Results* >::iterator iter;
     for ( iter = m_ResultsMap.begin() ; iter != m_ResultsMap.end() ; iter++ )
     {
         delete iter->second;
     }
     m_ResultsMap.clear();
     m_NameIDMap.clear();
+    m_LatestIDMap.clear();
 }
 
 //==== Delete All Results ====//
 void ResultsMgrSingleton:: DeleteResult( const string & id )
 {
-    //==== Find Name Given ID ====//
-    map< string, vector< string > >::iterator iter;
+    std::lock_guard< std::recursive_mutex > lock( m_ResultsMutex );
 
-    //==== Find Name To Match ID And Remove====//
-    for ( iter = m_NameIDMap.begin() ; iter != m_NameIDMap.end() ; iter++ )
+    unordered_map< string, Results* >::iterator res_iter = m_ResultsMap.find( id );
+
+    if ( res_iter == m_ResultsMap.end() )
     {
-        bool found = false;
-        for ( int i = 0 ; i < ( int )iter->second.size() ; i++ )
+        return;
+    }
+
+    //==== Results Know Their Name - Only Search That Name's IDs ====//
+    string name = res_iter->second->GetName();
+
+    delete res_iter->second;
+    m_ResultsMap.erase( res_iter );
+
+    map< string, vector< string > >::iterator iter = m_NameIDMap.find( name );
+    if ( iter != m_NameIDMap.end() )
+    {
+        //==== Erase In Place, Newest First - Keeps Creation Order Without Rebuilding The Vector ====//
+        vector< string >::reverse_iterator id_iter = std::find( iter->second.rbegin(), iter->second.rend(), id );
+        if ( id_iter != iter->second.rend() )
         {
-            if ( iter->second[i] == id )
-            {
-                found = true;
-            }
+            iter->second.erase( ( ++id_iter ).base() );
         }
-        if ( found )
+        if ( iter->second.size() == 0 )
         {
-            vector_remove_val( iter->second, id );
-            if ( iter->second.size() == 0 )
-            {
-                m_NameIDMap.erase( iter );
-            }
-
-            break;
+            m_NameIDMap.erase( iter );
         }
     }
 
-    //==== Delete All Created Results =====//
-    map< string, Results* >::iterator res_iter;
+    //==== Only Rescan When The Latest Was Removed ====//
+    unordered_map< string, string >::iterator latest_iter = m_LatestIDMap.find( name );
+    if ( latest_iter != m_LatestIDMap.end() && latest_iter->second == id )
+    {
+        UpdateLatestID( name );
+    }
+}
 
-    res_iter = m_ResultsMap.find( id );
+//==== Rescan The IDs For A Name And Store The One With The Latest Stamp ====//
+void ResultsMgrSingleton::UpdateLatestID( const string & name )
+{
+    std::lock_guard< std::recursive_mutex > lock( m_ResultsMutex );
 
-    if ( res_iter != m_ResultsMap.end() )
+    map< string, vector< string > >::iterator iter = m_NameIDMap.find( name );
+    if ( iter == m_NameIDMap.end() )
     {
-        delete res_iter->second;
-        m_ResultsMap.erase( res_iter );
+        m_LatestIDMap.erase( name );
+        return;
     }
+
+    string latest_id;
+    time_t latest_stamp = 0;
+    for ( int i = 0 ; i < ( int )( iter->second.size() ) ; i++ )
+    {
+        string id = iter->second[i];
+        Results* res_ptr = FindResultsPtr( id );
+
+        if ( res_ptr && res_ptr->GetTimestamp() >= latest_stamp )
+        {
+            latest_stamp = res_ptr->GetTimestamp();
+            latest_id = id;
+        }
+    }
+    m_LatestIDMap[name] = latest_id;
 }
 
 
 //==== Find The Number of Results Given Name ====//
 int ResultsMgrSingleton::GetNumResults( const string & name )
 {
+    std::lock_guard< std::recursive_mutex > lock( m_ResultsMutex );
+
     map< string, vector< string > >::iterator iter = m_NameIDMap.find( name );
 
     if ( iter == m_NameIDMap.end() )
@@ -709,6 +955,8 @@ int ResultsMgrSingleton::GetNumResults( const string & name )
 //==== Find Results ID Given Name and Optional Index =====//
 string ResultsMgrSingleton::FindResultsID( const string & name, int index )
 {
+    std::lock_guard< std::recursive_mutex > lock( m_ResultsMutex );
+
     map< string, vector< string > >::iterator iter = m_NameIDMap.find( name );
     if ( iter == m_NameIDMap.end() )
     {
@@ -726,33 +974,23 @@ string ResultsMgrSingleton::FindResultsID( const string & name, int index )
 //==== Find The Latest Results ID For the Given Name
 string ResultsMgrSingleton::FindLatestResultsID( const string & name )
 {
-    map< string, vector< string > >::iterator iter = m_NameIDMap.find( name );
-    if ( iter == m_NameIDMap.end() )
-    {
-        return string();
-    }
+    std::lock_guard< std::recursive_mutex > lock( m_ResultsMutex );
 
-    string latest_id;
-    time_t latest_stamp = 0;
-    for ( int i = 0 ; i < ( int )( iter->second.size() ) ; i++ )
+    unordered_map< string, string >::iterator iter = m_LatestIDMap.find( name );
+    if ( iter == m_LatestIDMap.end() )
     {
-        string id = iter->second[i];
-        Results* res_ptr = FindResultsPtr( id );
-
-        if ( res_ptr && res_ptr->GetTimestamp() >= latest_stamp )
-        {
-            latest_stamp = res_ptr->GetTimestamp();
-            latest_id = id;
-        }
+        return string();
     }
-    return latest_id;
+    return iter->second;
 }
 
 
 //==== Find Results Ptr Given ID =====//
 Results* ResultsMgrSingleton::FindResultsPtr( const string & id )
 {
-    map< string, Results* >::iterator id_iter = m_ResultsMap.find( id );
+    std::lock_guard< std::recursive_mutex > lock( m_ResultsMutex );
+
+    unordered_map< string, Results* >::iterator id_iter = m_ResultsMap.find( id );
 
     if ( id_iter ==  m_ResultsMap.end() )
     {
@@ -765,6 +1003,8 @@ Results* ResultsMgrSingleton::FindResultsPtr( const string & id )
 //==== Find Results Ptr Given Name and Optional Index =====//
 Results* ResultsMgrSingleton::FindResults( const string & name, int index )
 {
+    std::lock_guard< std::recursive_mutex > lock( m_ResultsMutex );
+
     string id = FindResultsID( name, index );
     return FindResultsPtr( id );
 }
@@ -773,7 +1013,9 @@ Results* ResultsMgrSingleton::FindResults( const string & name, int index )
 //==== Get Results TimeStamp Given ID ====//
 time_t ResultsMgrSingleton::GetResultsTimestamp( const string & results_id )
 {
-    map< string, Results* >::iterator iter = m_ResultsMap.find( results_id );
+    std::lock_guard< std::recursive_mutex > lock( m_ResultsMutex );
+
+    unordered_map< string, Results* >::iterator iter = m_ResultsMap.find( results_id );
 
     if ( iter ==  m_ResultsMap.end() )
     {
@@ -787,6 +1029,8 @@ time_t ResultsMgrSingleton::GetResultsTimestamp( const string & results_id )
 //==== Get Results TimeStamp Given ID ====//
 int ResultsMgrSingleton::GetNumData( const string & results_id, const string & data_name )
 {
+    std::lock_guard< std::recursive_mutex > lock( m_ResultsMutex );
+
     Results* results_ptr = FindResultsPtr( results_id );
     if ( !results_ptr )
     {
@@ -798,6 +1042,8 @@ int ResultsMgrSingleton::GetNumData( const string & results_id, const string & d
 
 int ResultsMgrSingleton::GetResultsType( const string & results_id, const string & data_name )
 {
+    std::lock_guard< std::recursive_mutex > lock( m_ResultsMutex );
+
     Results* results_ptr = FindResultsPtr( results_id );
     if ( !results_ptr )
     {
@@ -816,6 +1062,8 @@ int ResultsMgrSingleton::GetResultsType( const string & results_id, const string
 //==== Get The Names of All Results ====//
 vector< string > ResultsMgrSingleton::GetAllResultsNames()
 {
+    std::lock_guard< std::recursive_mutex > lock( m_ResultsMutex );
+
     vector< string > name_vec;
     map< string, vector< string > >::iterator iter;
     for ( iter = m_NameIDMap.begin() ; iter != m_NameIDMap.end() ; iter++ )
@@ -828,6 +1076,8 @@ vector< string > ResultsMgrSingleton::GetAllResultsNames()
 //==== Get The Names of All Data for A Givent Result ====//
 vector< string > ResultsMgrSingleton::GetAllDataNames( const string & results_id )
 {
+    std::lock_guard< std::recursive_mutex > lock( m_ResultsMutex );
+
     vector< string > name_vec;
     Results* results_ptr = FindResultsPtr( results_id );
     if ( !results_ptr )
@@ -838,16 +1088,26 @@ vector< string > ResultsMgrSingleton::GetAllDataNames( const string & results_id
     return results_ptr->GetAllDataNames();
 }
 
-//==== Get Int Results Given Results ID and Name of Data and Index (Default 0) ====//
-const vector<int> & ResultsMgrSingleton::GetIntResults( const string & results_id, const string & name, int index )
+//==== Find Data Given Results ID and Name of Data and Index (Default 0) ====//
+NameValData* ResultsMgrSingleton::FindResultsData( const string & results_id, const string & name, int index )
 {
+    std::lock_guard< std::recursive_mutex > lock( m_ResultsMutex );
+
     Results* results_ptr = FindResultsPtr( results_id );
     if ( !results_ptr )
     {
-        return m_DefaultIntVec;
+        return NULL;
     }
 
-    NameValData* rd_ptr = results_ptr->FindPtr( name, index );
+    return results_ptr->FindPtr( name, index );
+}
+
+//==== Get Int Results Given Results ID and Name of Data and Index (Default 0) ====//
+const vector<int> & ResultsMgrSingleton::GetIntResults( const string & results_id, const string & name, int index )
+{
+    std::lock_guard< std::recursive_mutex > lock( m_ResultsMutex );
+
+    NameValData* rd_ptr = FindResultsData( results_id, name, index );
     if ( !rd_ptr )
     {
         return m_DefaultIntVec;
@@ -859,13 +1119,9 @@ const vector<int> & ResultsMgrSingleton::GetIntResults( const string & results_i
 //==== Get Double Results Given Results ID and Name of Data and Index (Default 0) ====//
 const vector<double> & ResultsMgrSingleton::GetDoubleResults( const string & results_id, const string & name, int index )
 {
-    Results* results_ptr = FindResultsPtr( results_id );
-    if ( !results_ptr )
-    {
-        return m_DefaultDoubleVec;
-    }
+    std::lock_guard< std::recursive_mutex > lock( m_ResultsMutex );
 
-    NameValData* rd_ptr = results_ptr->FindPtr( name, index );
+    NameValData* rd_ptr = FindResultsData( results_id, name, index );
     if ( !rd_ptr )
     {
         return m_DefaultDoubleVec;
@@ -877,13 +1133,9 @@ const vector<double> & ResultsMgrSingleton::GetDoubleResults( const string & res
 //==== Get string Results Given Results ID and Name of Data and Index (Default 0) ====//
 const vector<string> & ResultsMgrSingleton::GetStringResults( const string & results_id, const string & name, int index )
 {
-    Results* results_ptr = FindResultsPtr( results_id );
-    if ( !results_ptr )
-    {
-        return m_DefaultStringVec;
-    }
+    std::lock_guard< std::recursive_mutex > lock( m_ResultsMutex );
 
-    NameValData* rd_ptr = results_ptr->FindPtr( name, index );
+    NameValData* rd_ptr = FindResultsData( results_id, name, index );
     if ( !rd_ptr )
     {
         return m_DefaultStringVec;
@@ -895,13 +1147,9 @@ const vector<string> & ResultsMgrSingleton::GetStringResults( const string & res
 //==== Get Vec3d Results Given Results ID and Name of Data and Index (Default 0) ====//
 const vector<vec3d> & ResultsMgrSingleton::GetVec3dResults( const string & results_id, const string & name, int index )
 {
-    Results* results_ptr = FindResultsPtr( results_id );
-    if ( !results_ptr )
-    {
-        return m_DefaultVec3dVec;
-    }
+    std::lock_guard< std::recursive_mutex > lock( m_ResultsMutex );
 
-    NameValData* rd_ptr = results_ptr->FindPtr( name, index );
+    NameValData* rd_ptr = FindResultsData( results_id, name, index );
     if ( !rd_ptr )
     {
         return m_DefaultVec3dVec;
@@ -913,6 +1161,8 @@ const vector<vec3d> & ResultsMgrSingleton::GetVec3dResults( const string & resul
 //==== Check If Results ID is Valid ====//
 bool ResultsMgrSingleton::ValidResultsID( const string & results_id )
 {
+    std::lock_guard< std::recursive_mutex > lock( m_ResultsMutex );
+
     Results* results_ptr = FindResultsPtr( results_id );
     if ( !results_ptr )
     {
@@ -924,6 +1174,8 @@ bool ResultsMgrSingleton::ValidResultsID( const string & results_id )
 //==== Check If Data Name and Index is Valid ====//
 bool ResultsMgrSingleton::ValidDataNameIndex( const string & results_id, const string & name, int index )
 {
+    std::lock_guard< std::recursive_mutex > lock( m_ResultsMutex );
+
     Results* results_ptr = FindResultsPtr( results_id );
     if ( !results_ptr )
     {
@@ -1013,6 +1265,8 @@ void ResultsMgrSingleton::TestSpeed()
 
 int ResultsMgrSingleton::WriteCSVFile( const string & file_name, const vector < string > &resids )
 {
+    std::lock_guard< std::recursive_mutex > lock( m_ResultsMutex );
+
     FILE* fid = fopen( file_name.c_str(), "w" );
     if( fid )
     {
@@ -1033,3 +1287,103 @@ int ResultsMgrSingleton::WriteCSVFile( const string & file_name, const vector <
         return vsp::VSP_FILE_WRITE_FAILURE;
     }
 }
+
+int ResultsMgrSingleton::WriteBinaryFile( const string & file_name, const vector < string > &resids )
+{
+    std::lock_guard< std::recursive_mutex > lock( m_ResultsMutex );
+
+    FILE* fid = fopen( file_name.c_str(), "wb" );
+    if ( !fid )
+    {
+        return vsp::VSP_FILE_WRITE_FAILURE;
+    }
+
+    //==== Header - Magic, Version, Byte Order Marker ====//
+    int version = 1;
+    int byte_order = 1;
+    fwrite( "VSPRES", 1, 6, fid );
+    fwrite( &version, sizeof( int ), 1, fid );
+    fwrite( &byte_order, sizeof( int ), 1, fid );
+
+    vector< Results* > res_vec;
+    for ( int i = 0 ; i < ( int )resids.size() ; i++ )
+    {
+        Results* resptr = FindResultsPtr( resids[i] );
+        if ( resptr )
+        {
+            res_vec.push_back( resptr );
+        }
+    }
+
+    int num_res = ( int )res_vec.size();
+    fwrite( &num_res, sizeof( int ), 1, fid );
+
+    for ( int i = 0 ; i < num_res ; i++ )
+    {
+        res_vec[i]->WriteBinary( fid );
+    }
+
+    bool ok = ( ferror( fid ) == 0 );
+    if ( fclose( fid ) != 0 )
+    {
+        ok = false;
+    }
+
+    return ok ? vsp::VSP_OK : vsp::VSP_FILE_WRITE_FAILURE;
+}
+
+vector< string > ResultsMgrSingleton::ReadBinaryFile( const string & file_name )
+{
+    std::lock_guard< std::recursive_mutex > lock( m_ResultsMutex );
+
+    vector< string > id_vec;
+
+    FILE* fid = fopen( file_name.c_str(), "rb" );
+    if ( !fid )
+    {
+        return id_vec;
+    }
+
+    char magic[6];
+    int version = 0;
+    int byte_order = 0;
+    int num_res = 0;
+
+    if ( fread( magic, 1, 6, fid ) != 6 || strncmp( magic, "VSPRES", 6 ) != 0 ||
+         fread( &version, sizeof( int ), 1, fid ) != 1 || version != 1 ||
+         fread( &byte_order, sizeof( int ), 1, fid ) != 1 || byte_order != 1 ||
+         fread( &num_res, sizeof( int ), 1, fid ) != 1 )
+    {
+        fclose( fid );
+        return id_vec;
+    }
+
+    for ( int i = 0 ; i < num_res ; i++ )
+    {
+        string name;
+        if ( !ReadBinaryString( fid, name ) )
+        {
+            break;
+        }
+
+        string prev_latest_id = FindLatestResultsID( name );
+
+        Results* res = CreateResults( name );
+        if ( !res->ReadBinary( fid ) )
+        {
+            DeleteResult( res->GetID() );
+            break;
+        }
+
+        //==== Stored Stamp May Be Older Than Existing Results ====//
+        Results* prev_latest = FindResultsPtr( prev_latest_id );
+        if ( prev_latest && prev_latest->GetTimestamp() > res->GetTimestamp() )
+        {
+            m_LatestIDMap[name] = prev_latest_id;
+        }
+        id_vec.push_back( res->GetID() );
+    }
+
+    fclose( fid );
+    return id_vec;
+}
@@ -14,11 +14,14 @@
 #include "Vec3d.h"
 
 #include <map>
+#include <unordered_map>
 #include <list>
 #include <vector>
 #include <string>
+#include <mutex>
 
 using std::map;
+using std::unordered_map;
 using std::vector;
 using std::string;
 
@@ -124,7 +127,7 @@ public:
 
     int GetNumData( const string & name );
     vector< string > GetAllDataNames();
-    NameValData Find( const string & name, int index = 0 );
+    const NameValData & Find( const string & name, int index = 0 );
     NameValData* FindPtr( const string & name, int index = 0 );
 
 protected:
@@ -145,9 +148,12 @@ public:
     Results( const string & name, const string & id );
 
     void SetDateTime();
+    void SetDateTime( time_t stamp );
 
     void WriteCSVFile( const string & file_name );
     void WriteCSVFile( FILE* fid );
+    void WriteBinary( FILE* fid );
+    bool ReadBinary( FILE* fid );
     void WriteMassProp( const string & file_name );
     void WriteCompGeomTxtFile( const string & file_name );
     void WriteCompGeomCsvFile( const string & file_name );
@@ -177,6 +183,8 @@ protected:
 
 
 //==== Results Manager ====//
+// All methods may be called from any thread.  A Results object is filled by the thread that
+// created it before its ID is handed out; returned data references live until it is deleted.
 class ResultsMgrSingleton
 {
 public:
@@ -210,6 +218,7 @@ public:
     const vector<double> & GetDoubleResults( const string & id, const string & name, int index = 0 );
     const vector<string> & GetStringResults( const string & id, const string & name, int index = 0 );
     const vector<vec3d> & GetVec3dResults( const string & id, const string & name, int index = 0 );
+    NameValData* FindResultsData( const string & id, const string & name, int index = 0 );
     time_t GetResultsTimestamp( const string & results_id );
 
     bool ValidResultsID( const string & results_id );
@@ -220,14 +229,24 @@ public:
 
     int WriteCSVFile( const string & file_name, const vector < string > &resids );
 
+    // Compact binary archive of whole Results, read back as new Results with fresh IDs
+    int WriteBinaryFile( const string & file_name, const vector < string > &resids );
+    vector< string > ReadBinaryFile( const string & file_name );
+
 private:
     ResultsMgrSingleton();
     ~ResultsMgrSingleton();
     ResultsMgrSingleton( ResultsMgrSingleton const& copy );          // Not Implemented
     ResultsMgrSingleton& operator=( ResultsMgrSingleton const& copy ); // Not Implemented
 
-    map< string, Results* > m_ResultsMap;                   // Map ID to Results
+    void UpdateLatestID( const string & name );
+
+    unordered_map< string, Results* > m_ResultsMap;         // Map ID to Results
     map< string, vector< string > > m_NameIDMap;            // Map Name to ID
+    unordered_map< string, string > m_LatestIDMap;          // Map Name to ID With The Latest Timestamp
+
+    // Guards the maps above - Recursive Because Public Methods Call Each Other
+    std::recursive_mutex m_ResultsMutex;
 
     //==== Default Return Vectors ====//
     vector< int > m_DefaultIntVec;
@@ -22,6 +22,11 @@
 #include "ResultsMgr.h"
 #include "StringUtil.h"
 #include "FileUtil.h"
+#include "main.h"
+
+#include <algorithm>
+#include <set>
+#include <sys/stat.h>
 
 using namespace vsp;
 
@@ -43,6 +48,48 @@ void MessageCallback( const asSMessageInfo *msg, void *param )
     printf( "%s", str );
 }
 
+//==== Compiled Byte Code Held In Memory ====//
+class ByteCodeStream : public asIBinaryStream
+{
+public:
+    ByteCodeStream() : m_ReadPos( 0 )                   {}
+
+    virtual void Write( const void* ptr, asUINT size )
+    {
+        const unsigned char* data = ( const unsigned char* ) ptr;
+        m_Buffer.insert( m_Buffer.end(), data, data + size );
+    }
+
+    //==== Reads Past The End Return Zeros ====//
+    virtual void Read( void* ptr, asUINT size )
+    {
+        size_t avail = ( m_ReadPos < m_Buffer.size() ) ? m_Buffer.size() - m_ReadPos : 0;
+        size_t n = ( size < avail ) ? size : avail;
+        if ( n > 0 )
+        {
+            memcpy( ptr, &m_Buffer[m_ReadPos], n );
+        }
+        if ( n < size )
+        {
+            memset( ( unsigned char* ) ptr + n, 0, size - n );
+        }
+        m_ReadPos += size;
+    }
+
+    vector< unsigned char > m_Buffer;
+    size_t m_ReadPos;
+};
+
+//==== Byte Code File Header ====//
+struct ByteCodeHeader
+{
+    char m_Tag[8];
+    unsigned long long m_EngineHash;
+    unsigned long long m_ContentHash;
+    unsigned long long m_ContentSize;
+    unsigned long long m_ByteCodeSize;
+};
+
 //==================================================================================================//
 //========================================= ScriptMgr      =========================================//
 //==================================================================================================//
@@ -51,7 +98,9 @@ void MessageCallback( const asSMessageInfo *msg, void *param )
 //==== Constructor ====//
 ScriptMgrSingleton::ScriptMgrSingleton()
 {
-
+    m_ScriptEngine = NULL;
+    m_EngineHash = 0;
+    m_LastLoadFromByteCode = false;
 }
 
 //==== Set Up Script Engine, Script Error Callbacks ====//
@@ -101,6 +150,47 @@ void ScriptMgrSingleton::Init( )
     RegisterAPI( m_ScriptEngine );
     RegisterUtility(  m_ScriptEngine );
 
+    //==== Fingerprint Registered Interface - Byte Code Is Only Valid For The Same Interface ====//
+    //==== Enum Values Are Compiled Inline, So They Are Part Of The Interface ====//
+    string interface_str = ANGELSCRIPT_VERSION_STRING;
+    interface_str.append( VSPVERSION4 );
+    for ( asUINT i = 0 ; i < se->GetGlobalFunctionCount() ; i++ )
+    {
+        interface_str.append( se->GetGlobalFunctionByIndex( i )->GetDeclaration() );
+    }
+    for ( asUINT i = 0 ; i < se->GetGlobalPropertyCount() ; i++ )
+    {
+        const char* name = NULL;
+        const char* name_space = NULL;
+        int type_id = 0;
+        bool is_const = false;
+        se->GetGlobalPropertyByIndex( i, &name, &name_space, &type_id, &is_const );
+        interface_str.append( is_const ? "const " : "" );
+        interface_str.append( se->GetTypeDeclaration( type_id, true ) );
+        interface_str.append( name_space ? name_space : "" );
+        interface_str.append( name ? name : "" );
+    }
+    for ( asUINT i = 0 ; i < se->GetEnumCount() ; i++ )
+    {
+        int enum_type_id = 0;
+        interface_str.append( se->GetEnumByIndex( i, &enum_type_id ) );
+        for ( int j = 0 ; j < se->GetEnumValueCount( enum_type_id ) ; j++ )
+        {
+            int val = 0;
+            interface_str.append( se->GetEnumValueByIndex( enum_type_id, j, &val ) );
+            interface_str.append( StringUtil::int_to_string( val, "=%d;" ) );
+        }
+    }
+    for ( asUINT i = 0 ; i < se->GetObjectTypeCount() ; i++ )
+    {
+        asIObjectType* type = se->GetObjectTypeByIndex( i );
+        interface_str.append( type->GetName() );
+        for ( asUINT j = 0 ; j < type->GetMethodCount() ; j++ )
+        {
+            interface_str.append( type->GetMethodByIndex( j )->GetDeclaration() );
+        }
+    }
+    m_EngineHash = ComputeContentHash( interface_str );
 
 }
 
@@ -183,28 +273,221 @@ string ScriptMgrSingleton::ReadScriptFromMemory( const string &  module_name, co
     }
 
     //==== Make Sure Not Dupicate Of Any Other Module ====//
-    for ( iter = m_ModuleContentMap.begin() ; iter != m_ModuleContentMap.end() ; iter++ )
+    unsigned long long content_hash = ComputeContentHash( script_content );
+    string dup_module_name = FindModuleByContent( script_content, content_hash );
+    if ( dup_module_name.size() )
+        return dup_module_name;
+
+    ClearFunctionCache( updated_module_name );
+
+    //==== Load Compiled Module Or Build From Source ====//
+    m_LastLoadFromByteCode = LoadByteCode( updated_module_name, script_content, content_hash );
+    if ( !m_LastLoadFromByteCode )
     {
-        if ( iter->second == script_content )
-            return iter->first;
-    }
+        //==== Start A New Module ====//
+        r = m_ScriptBuilder.StartNewModule( m_ScriptEngine, updated_module_name.c_str() );
+        if( r < 0 )        return string();
 
-    //==== Start A New Module ====//
-    r = m_ScriptBuilder.StartNewModule( m_ScriptEngine, updated_module_name.c_str() );
-    if( r < 0 )        return string();
+        r = m_ScriptBuilder.AddSectionFromMemory( updated_module_name.c_str(), script_content.c_str(), script_content.size()  );
+        if ( r < 0 )    return string();
 
-    r = m_ScriptBuilder.AddSectionFromMemory( updated_module_name.c_str(), script_content.c_str(), script_content.size()  );
-    if ( r < 0 )    return string();
+        r = m_ScriptBuilder.BuildModule();
+        if ( r < 0 )    return string();
 
-    r = m_ScriptBuilder.BuildModule();
-    if ( r < 0 )    return string();
+        SaveByteCode( updated_module_name, script_content, content_hash );
+    }
 
     //==== Add To Map ====//
     m_ModuleContentMap[ updated_module_name ] = script_content;
+    m_ContentHashMap[ content_hash ].push_back( updated_module_name );
 
     return updated_module_name;
 }
 
+//==== 64 Bit FNV-1a Hash - Stable Across Runs and Platforms ====//
+unsigned long long ScriptMgrSingleton::ComputeContentHash( const string & content )
+{
+    unsigned long long hash = 14695981039346656037ULL;
+    for ( size_t i = 0 ; i < content.size() ; i++ )
+    {
+        hash ^= ( unsigned char ) content[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+//==== Find Module With Identical Content ====//
+string ScriptMgrSingleton::FindModuleByContent( const string & script_content, unsigned long long content_hash )
+{
+    map< unsigned long long, vector< string > >::iterator hash_iter = m_ContentHashMap.find( content_hash );
+    if ( hash_iter == m_ContentHashMap.end() )
+        return string();
+
+    for ( int i = 0 ; i < ( int )hash_iter->second.size() ; i++ )
+    {
+        map< string, string >::iterator iter = m_ModuleContentMap.find( hash_iter->second[i] );
+        if ( iter != m_ModuleContentMap.end() && iter->second == script_content )
+            return iter->first;
+    }
+    return string();
+}
+
+//==== Remove Byte Code Built For Another Interface, And The Oldest Unused Files Past The Limit ====//
+int ScriptMgrSingleton::PruneByteCodeCache( int max_files )
+{
+    if ( m_ByteCodeCacheDir.empty() )
+        return 0;
+
+    //==== Byte Code Files Still In Use ====//
+    set< string > keep_set;
+    map< string, string >::iterator iter;
+    for ( iter = m_ModuleContentMap.begin() ; iter != m_ModuleContentMap.end() ; ++iter )
+    {
+        keep_set.insert( GetByteCodeFileName( iter->second ) );
+    }
+
+    char prefix[32];
+    sprintf( prefix, "%016llx", m_EngineHash );
+
+    int num_removed = 0;
+    int num_current = 0;
+    vector< pair< time_t, string > > unused_vec;
+    string suffix = ".vspbc";
+    vector< string > file_vec = ScanFolder( m_ByteCodeCacheDir.c_str() );
+    for ( int i = 0 ; i < ( int )file_vec.size() ; i++ )
+    {
+        const string & f = file_vec[i];
+        if ( f.size() <= suffix.size() || f.compare( f.size() - suffix.size(), suffix.size(), suffix ) != 0 )
+            continue;
+
+        string file_name = m_ByteCodeCacheDir;
+        file_name.append( f );
+
+        if ( f.compare( 0, 16, prefix ) != 0 )
+        {
+            if ( remove( file_name.c_str() ) == 0 )
+                num_removed++;
+            continue;
+        }
+
+        num_current++;
+
+        struct stat st;
+        if ( keep_set.find( file_name ) == keep_set.end() && stat( file_name.c_str(), &st ) == 0 )
+        {
+            unused_vec.push_back( pair< time_t, string >( st.st_mtime, file_name ) );
+        }
+    }
+
+    //==== Oldest First ====//
+    std::sort( unused_vec.begin(), unused_vec.end() );
+    for ( int i = 0 ; i < ( int )unused_vec.size() && num_current > max_files ; i++ )
+    {
+        if ( remove( unused_vec[i].second.c_str() ) == 0 )
+        {
+            num_removed++;
+            num_current--;
+        }
+    }
+    return num_removed;
+}
+
+//==== Byte Code File Name For Script Content ====//
+string ScriptMgrSingleton::GetByteCodeFileName( const string & script_content )
+{
+    if ( m_ByteCodeCacheDir.empty() )
+        return string();
+
+    char str[64];
+    sprintf( str, "%016llx%016llx.vspbc", m_EngineHash, ComputeContentHash( script_content ) );
+
+    string file_name = m_ByteCodeCacheDir;
+    file_name.append( str );
+    return file_name;
+}
+
+//==== Load Module From Byte Code Cache ====//
+bool ScriptMgrSingleton::LoadByteCode( const string & module_name, const string & script_content, unsigned long long content_hash )
+{
+    //==== Included Files Are Not Part Of The Hash ====//
+    if ( m_ByteCodeCacheDir.empty() || script_content.find( "#include" ) != string::npos )
+        return false;
+
+    string file_name = GetByteCodeFileName( script_content );
+    FILE* fp = fopen( file_name.c_str(), "rb" );
+    if ( !fp )
+        return false;
+
+    ByteCodeHeader header;
+    ByteCodeStream stream;
+    bool valid = ( fread( &header, sizeof( header ), 1, fp ) == 1 );
+    if ( valid )
+    {
+        valid = ( strncmp( header.m_Tag, "VSPBC01", 8 ) == 0 &&
+                  header.m_EngineHash == m_EngineHash &&
+                  header.m_ContentHash == content_hash &&
+                  header.m_ContentSize == script_content.size() );
+    }
+    if ( valid )
+    {
+        stream.m_Buffer.resize( header.m_ByteCodeSize );
+        valid = ( header.m_ByteCodeSize > 0 &&
+                  fread( &stream.m_Buffer[0], 1, stream.m_Buffer.size(), fp ) == stream.m_Buffer.size() );
+    }
+    fclose( fp );
+
+    //==== Stale Or Truncated - Drop It, A Fresh Copy Is Saved After The Build ====//
+    if ( !valid )
+    {
+        remove( file_name.c_str() );
+        return false;
+    }
+
+    asIScriptModule* mod = m_ScriptEngine->GetModule( module_name.c_str(), asGM_ALWAYS_CREATE );
+    if ( !mod )
+        return false;
+
+    if ( mod->LoadByteCode( &stream ) < 0 )
+    {
+        m_ScriptEngine->DiscardModule( module_name.c_str() );
+        remove( file_name.c_str() );
+        return false;
+    }
+    return true;
+}
+
+//==== Save Built Module To Byte Code Cache ====//
+void ScriptMgrSingleton::SaveByteCode( const string & module_name, const string & script_content, unsigned long long content_hash )
+{
+    if ( m_ByteCodeCacheDir.empty() || script_content.find( "#include" ) != string::npos )
+        return;
+
+    asIScriptModule* mod = m_ScriptEngine->GetModule( module_name.c_str() );
+    if ( !mod )
+        return;
+
+    ByteCodeStream stream;
+    if ( mod->SaveByteCode( &stream ) < 0 || stream.m_Buffer.empty() )
+        return;
+
+    ByteCodeHeader header;
+    memset( &header, 0, sizeof( header ) );
+    strncpy( header.m_Tag, "VSPBC01", 8 );
+    header.m_EngineHash = m_EngineHash;
+    header.m_ContentHash = content_hash;
+    header.m_ContentSize = script_content.size();
+    header.m_ByteCodeSize = stream.m_Buffer.size();
+
+    string file_name = GetByteCodeFileName( script_content );
+    FILE* fp = fopen( file_name.c_str(), "wb" );
+    if ( fp )
+    {
+        fwrite( &header, sizeof( header ), 1, fp );
+        fwrite( &stream.m_Buffer[0], 1, stream.m_Buffer.size(), fp );
+        fclose( fp );
+    }
+}
+
 //==== Extract Content From File Into String ====//
 string ScriptMgrSingleton::ExtractContent( const string & file_name )
 {
@@ -234,7 +517,20 @@ bool ScriptMgrSingleton::RemoveScript( const string &  module_name )
         return false;                           // Could not find module name;
     }
 
+    //==== Remove From Content Index ====//
+    map< unsigned long long, vector< string > >::iterator hash_iter = m_ContentHashMap.find( ComputeContentHash( iter->second ) );
+    if ( hash_iter != m_ContentHashMap.end() )
+    {
+        vector< string > & name_vec = hash_iter->second;
+        name_vec.erase( std::remove( name_vec.begin(), name_vec.end(), module_name ), name_vec.end() );
+        if ( name_vec.empty() )
+        {
+            m_ContentHashMap.erase( hash_iter );
+        }
+    }
+
     m_ModuleContentMap.erase( iter );
+    ClearFunctionCache( module_name );
 
     int ret = m_ScriptEngine->DiscardModule( module_name.c_str() );
 
@@ -244,33 +540,74 @@ bool ScriptMgrSingleton::RemoveScript( const string &  module_name )
 }
 
 
-//==== Execute Function in Module ====//
-bool ScriptMgrSingleton::ExecuteScript(  const char* module_name,  const char* function_name, bool arg_flag, double arg )
+//==== Find Function In Module - Handles Are Cached Per Module and Declaration ====//
+asIScriptFunction* ScriptMgrSingleton::FindFunction( const string & module_name, const string & function_name )
 {
-    int r;
-
-    // Find the function that is to be called.
-    asIScriptModule *mod = m_ScriptEngine->GetModule( module_name );
+    map< string, asIScriptFunction* > & func_map = m_FunctionCache[ module_name ];
+    map< string, asIScriptFunction* >::iterator iter = func_map.find( function_name );
+    if ( iter != func_map.end() )
+    {
+        return iter->second;
+    }
 
+    asIScriptModule *mod = m_ScriptEngine->GetModule( module_name.c_str() );
     if ( !mod )
     {
-        printf( "Error ExecuteScript GetModule %s\n", module_name );
-        return false;
+        printf( "Error ExecuteScript GetModule %s\n", module_name.c_str() );
+        return NULL;
+    }
+
+    //==== Missing Functions Are Cached Too ====//
+    asIScriptFunction *func = mod->GetFunctionByDecl( function_name.c_str() );
+    func_map[ function_name ] = func;
+    return func;
+}
+
+//==== Forget Function Handles When Module Is Discarded ====//
+void ScriptMgrSingleton::ClearFunctionCache( const string & module_name )
+{
+    m_FunctionCache.erase( module_name );
+}
+
+//==== Reuse Contexts - Nested Script Calls Each Take Their Own ====//
+asIScriptContext* ScriptMgrSingleton::RequestContext()
+{
+    if ( m_ContextPool.empty() )
+    {
+        return m_ScriptEngine->CreateContext();
     }
 
-    asIScriptFunction *func = mod->GetFunctionByDecl( function_name );
+    asIScriptContext* ctx = m_ContextPool.back();
+    m_ContextPool.pop_back();
+    return ctx;
+}
+
+void ScriptMgrSingleton::ReturnContext( asIScriptContext* ctx )
+{
+    ctx->Unprepare();
+    m_ContextPool.push_back( ctx );
+}
+
+//==== Execute Function in Module ====//
+bool ScriptMgrSingleton::ExecuteScript(  const char* module_name,  const char* function_name, bool arg_flag, double arg )
+{
+    int r;
+
+    // Find the function that is to be called.
+    asIScriptFunction *func = FindFunction( module_name, function_name );
     if( func == 0 )
     {
         return false;
     }
 
-    // Create our context, prepare it, and then execute
-    asIScriptContext *ctx = m_ScriptEngine->CreateContext();
+    // Take a context from the pool, prepare it, and then execute
+    asIScriptContext *ctx = RequestContext();
     ctx->Prepare( func );
     if ( arg_flag )
     {
         ctx->SetArgDouble( 0, arg );
     }
+    bool success = true;
     r = ctx->Execute();
     if( r != asEXECUTION_FINISHED )
     {
@@ -280,9 +617,10 @@ bool ScriptMgrSingleton::ExecuteScript(  const char* module_name,  const char* f
             // An exception occurred, let the script writer know what happened so it can be corrected.
             printf( "An exception '%s' occurred \n", ctx->GetExceptionString() );
         }
-        return false;
+        success = false;
     }
-    return true;
+    ReturnContext( ctx );
+    return success;
 }
 
 //==== Return Script Content Given Module Name ====//
@@ -1004,6 +1342,14 @@ void ScriptMgrSingleton::RegisterEnums( asIScriptEngine* se )
     r = se->RegisterEnumValue( "VSPAERO_ANALYSIS_METHOD", "VORTEX_LATTICE", VORTEX_LATTICE );
     assert( r >= 0 );
     r = se->RegisterEnumValue( "VSPAERO_ANALYSIS_METHOD", "PANEL", PANEL );
+    assert( r >= 0 );
+
+    r = se->RegisterEnum( "MASS_PROP_MODE" );
+    assert( r >= 0 );
+    r = se->RegisterEnumValue( "MASS_PROP_MODE", "MASS_PROP_SLICE", MASS_PROP_SLICE );
+    assert( r >= 0 );
+    r = se->RegisterEnumValue( "MASS_PROP_MODE", "MASS_PROP_SURF_INTEGRAL", MASS_PROP_SURF_INTEGRAL );
+    assert( r >= 0 );
 
 }
 
@@ -1313,6 +1659,10 @@ void ScriptMgrSingleton::RegisterAPI( asIScriptEngine* se )
     //==== Vehicle Functions ====//
     r = se->RegisterGlobalFunction( "void Update()", asFUNCTION( vsp::Update ), asCALL_CDECL );
     assert( r >= 0 );
+    r = se->RegisterGlobalFunction( "void BeginUpdateTransaction()", asFUNCTION( vsp::BeginUpdateTransaction ), asCALL_CDECL );
+    assert( r >= 0 );
+    r = se->RegisterGlobalFunction( "int CommitUpdateTransaction()", asFUNCTION( vsp::CommitUpdateTransaction ), asCALL_CDECL );
+    assert( r >= 0 );
     r = se->RegisterGlobalFunction( "void VSPExit( int error_code )", asFUNCTION( vsp::VSPExit ), asCALL_CDECL );
     assert( r >= 0 );
     r = se->RegisterGlobalFunction( "void ClearVSPModel()", asFUNCTION( vsp::ClearVSPModel ), asCALL_CDECL );
@@ -1356,7 +1706,7 @@ void ScriptMgrSingleton::RegisterAPI( asIScriptEngine* se )
     //==== Computations ====//
     r = se->RegisterGlobalFunction( "void SetComputationFileName( int file_type, const string & in file_name )", asFUNCTION( vsp::SetComputationFileName ), asCALL_CDECL );
     assert( r >= 0 );
-    r = se->RegisterGlobalFunction( "string ComputeMassProps( int set, int num_slices )", asFUNCTION( vsp::ComputeMassProps ), asCALL_CDECL );
+    r = se->RegisterGlobalFunction( "string ComputeMassProps( int set, int num_slices, int mode = MASS_PROP_SLICE )", asFUNCTION( vsp::ComputeMassProps ), asCALL_CDECL );
     assert( r >= 0 );
     r = se->RegisterGlobalFunction( "string ComputeCompGeom( int set, bool half_mesh, int file_export_types )", asFUNCTION( vsp::ComputeCompGeom ), asCALL_CDECL );
     assert( r >= 0 );
@@ -1389,6 +1739,12 @@ void ScriptMgrSingleton::RegisterAPI( asIScriptEngine* se )
     assert( r >= 0 );
     r = se->RegisterGlobalFunction( "string ExecAnalysis( const string & in analysis )", asFUNCTION( vsp::ExecAnalysis ), asCALL_CDECL );
     assert( r >= 0 );
+    r = se->RegisterGlobalFunction( "int ExecAnalysisAsync( const string & in analysis )", asFUNCTION( vsp::ExecAnalysisAsync ), asCALL_CDECL );
+    assert( r >= 0 );
+    r = se->RegisterGlobalFunction( "bool AsyncAnalysisReady( int handle )", asFUNCTION( vsp::AsyncAnalysisReady ), asCALL_CDECL );
+    assert( r >= 0 );
+    r = se->RegisterGlobalFunction( "string WaitAsyncAnalysis( int handle )", asFUNCTION( vsp::WaitAsyncAnalysis ), asCALL_CDECL );
+    assert( r >= 0 );
     r = se->RegisterGlobalFunction( "int GetNumAnalysisInputData( const string & in analysis, const string & in name )", asFUNCTION( vsp::GetNumAnalysisInputData ), asCALL_CDECL );
     assert( r >= 0 );
     r = se->RegisterGlobalFunction( "int GetAnalysisInputType( const string & in analysis, const string & in name )", asFUNCTION( vsp::GetAnalysisInputType ), asCALL_CDECL );
@@ -1445,6 +1801,10 @@ void ScriptMgrSingleton::RegisterAPI( asIScriptEngine* se )
     assert( r >= 0 );
     r = se->RegisterGlobalFunction( "void WriteResultsCSVFile( const string & in id, const string & in file_name )", asFUNCTION( vsp::WriteResultsCSVFile ), asCALL_CDECL );
     assert( r >= 0 );
+    r = se->RegisterGlobalFunction( "void WriteResultsBinaryFile( array<string>@ id_arr, const string & in file_name )", asMETHOD( ScriptMgrSingleton, WriteResultsBinaryFile ), asCALL_THISCALL_ASGLOBAL, &ScriptMgr );
+    assert( r >= 0 );
+    r = se->RegisterGlobalFunction( "array<string>@  ReadResultsBinaryFile( const string & in file_name )", asMETHOD( ScriptMgrSingleton, ReadResultsBinaryFile ), asCALL_THISCALL_ASGLOBAL, &ScriptMgr );
+    assert( r >= 0 );
 
     r = se->RegisterGlobalFunction( "void WriteTestResults()", asMETHOD( ResultsMgrSingleton, WriteTestResults ), asCALL_THISCALL_ASGLOBAL, &ResultsMgr );
     assert( r >= 0 );
@@ -1482,6 +1842,24 @@ void ScriptMgrSingleton::RegisterAPI( asIScriptEngine* se )
     assert( r >= 0 );
     r = se->RegisterGlobalFunction( "int GetNumMainSurfs( const string & in geom_id )", asFUNCTION( vsp::GetNumMainSurfs ), asCALL_CDECL );
     assert( r >= 0 );
+    r = se->RegisterGlobalFunction( "int GetNumTotalSurfs( const string & in geom_id )", asFUNCTION( vsp::GetNumTotalSurfs ), asCALL_CDECL );
+    assert( r >= 0 );
+    r = se->RegisterGlobalFunction( "vec3d CompPnt01( const string & in geom_id, int surf_indx, double u, double w )", asFUNCTION( vsp::CompPnt01 ), asCALL_CDECL );
+    assert( r >= 0 );
+    r = se->RegisterGlobalFunction( "vec3d CompNorm01( const string & in geom_id, int surf_indx, double u, double w )", asFUNCTION( vsp::CompNorm01 ), asCALL_CDECL );
+    assert( r >= 0 );
+    r = se->RegisterGlobalFunction( "void CompCurvature01( const string & in geom_id, int surf_indx, double u, double w, double &out k1, double &out k2, double &out ka, double &out kg )", asFUNCTION( vsp::CompCurvature01 ), asCALL_CDECL );
+    assert( r >= 0 );
+    r = se->RegisterGlobalFunction( "double ProjPnt01( const string & in geom_id, int surf_indx, const vec3d & in pt, double &out u, double &out w )", asFUNCTION( vsp::ProjPnt01 ), asCALL_CDECL );
+    assert( r >= 0 );
+    r = se->RegisterGlobalFunction( "array<vec3d>@ CompVecPnt01( const string & in geom_id, int surf_indx, array<double>@ u_arr, array<double>@ w_arr )", asMETHOD( ScriptMgrSingleton, CompVecPnt01 ), asCALL_THISCALL_ASGLOBAL, &ScriptMgr );
+    assert( r >= 0 );
+    r = se->RegisterGlobalFunction( "array<vec3d>@ CompVecNorm01( const string & in geom_id, int surf_indx, array<double>@ u_arr, array<double>@ w_arr )", asMETHOD( ScriptMgrSingleton, CompVecNorm01 ), asCALL_THISCALL_ASGLOBAL, &ScriptMgr );
+    assert( r >= 0 );
+    r = se->RegisterGlobalFunction( "void CompVecCurvature01( const string & in geom_id, int surf_indx, array<double>@ u_arr, array<double>@ w_arr, array<double>@ k1_arr, array<double>@ k2_arr, array<double>@ ka_arr, array<double>@ kg_arr )", asMETHOD( ScriptMgrSingleton, CompVecCurvature01 ), asCALL_THISCALL_ASGLOBAL, &ScriptMgr );
+    assert( r >= 0 );
+    r = se->RegisterGlobalFunction( "void ProjVecPnt01( const string & in geom_id, int surf_indx, array<vec3d>@ pnt_arr, array<double>@ u_arr, array<double>@ w_arr, array<double>@ d_arr )", asMETHOD( ScriptMgrSingleton, ProjVecPnt01 ), asCALL_THISCALL_ASGLOBAL, &ScriptMgr );
+    assert( r >= 0 );
     r = se->RegisterGlobalFunction( "string AddSubSurf( const string & in geom_id, int type, int surfindex = 0 )", asFUNCTION( vsp::AddSubSurf ), asCALL_CDECL );
     assert( r >= 0 );
     r = se->RegisterGlobalFunction( "void DeleteSubSurf( const string & in geom_id, const string & in sub_id )", asFUNCTION( vsp::DeleteSubSurf ), asCALL_CDECL );
@@ -1924,26 +2302,77 @@ CScriptArray* ScriptMgrSingleton::GetAllDataNames( const string & results_id )
 
 CScriptArray* ScriptMgrSingleton::GetIntResults( const string & id, const string & name, int index )
 {
-    m_ProxyIntArray = vsp::GetIntResults( id, name, index );
-    return GetProxyIntArray();
+    //==== Copy Straight From Stored Results - Skip The Proxy Vector ====//
+    const vector< int > & data = vsp::GetIntResults( id, name, index );
+
+    //==== This Will Get Deleted By The Script Engine ====//
+    CScriptArray* sarr = new CScriptArray( data.size(), m_IntArrayType );
+    for ( int i = 0 ; i < ( int )sarr->GetSize() ; i++ )
+    {
+        sarr->SetValue( i, ( void* )&data[i] );
+    }
+    return sarr;
 }
 
 CScriptArray* ScriptMgrSingleton::GetDoubleResults( const string & id, const string & name, int index )
 {
-    m_ProxyDoubleArray = vsp::GetDoubleResults( id, name, index );
-    return GetProxyDoubleArray();
+    //==== Copy Straight From Stored Results - Skip The Proxy Vector ====//
+    const vector< double > & data = vsp::GetDoubleResults( id, name, index );
+
+    //==== This Will Get Deleted By The Script Engine ====//
+    CScriptArray* sarr = new CScriptArray( data.size(), m_DoubleArrayType );
+    for ( int i = 0 ; i < ( int )sarr->GetSize() ; i++ )
+    {
+        sarr->SetValue( i, ( void* )&data[i] );
+    }
+    return sarr;
 }
 
 CScriptArray* ScriptMgrSingleton::GetStringResults( const string & id, const string & name, int index )
 {
-    m_ProxyStringArray = vsp::GetStringResults( id, name, index );
-    return GetProxyStringArray();
+    //==== Copy Straight From Stored Results - Skip The Proxy Vector ====//
+    const vector< string > & data = vsp::GetStringResults( id, name, index );
+
+    //==== This Will Get Deleted By The Script Engine ====//
+    CScriptArray* sarr = new CScriptArray( data.size(), m_StringArrayType );
+    for ( int i = 0 ; i < ( int )sarr->GetSize() ; i++ )
+    {
+        sarr->SetValue( i, ( void* )&data[i] );
+    }
+    return sarr;
 }
 
 CScriptArray* ScriptMgrSingleton::GetVec3dResults( const string & id, const string & name, int index )
 {
-    m_ProxyVec3dArray = vsp::GetVec3dResults( id, name, index );
-    return GetProxyVec3dArray();
+    //==== Copy Straight From Stored Results - Skip The Proxy Vector ====//
+    const vector< vec3d > & data = vsp::GetVec3dResults( id, name, index );
+
+    //==== This Will Get Deleted By The Script Engine ====//
+    CScriptArray* sarr = new CScriptArray( data.size(), m_Vec3dArrayType );
+    for ( int i = 0 ; i < ( int )sarr->GetSize() ; i++ )
+    {
+        sarr->SetValue( i, ( void* )&data[i] );
+    }
+    return sarr;
+}
+
+void ScriptMgrSingleton::WriteResultsBinaryFile( CScriptArray* id_arr, const string & file_name )
+{
+    vector < string > id_vec;
+
+    id_vec.resize( id_arr->GetSize() );
+    for ( int i = 0 ; i < ( int )id_arr->GetSize() ; i++ )
+    {
+        id_vec[i] = * ( string* )( id_arr->At( i ) );
+    }
+
+    vsp::WriteResultsBinaryFile( id_vec, file_name );
+}
+
+CScriptArray* ScriptMgrSingleton::ReadResultsBinaryFile( const string & file_name )
+{
+    m_ProxyStringArray = vsp::ReadResultsBinaryFile( file_name );
+    return GetProxyStringArray();
 }
 
 CScriptArray* ScriptMgrSingleton::FindContainers()
@@ -2025,6 +2454,79 @@ void ScriptMgrSingleton::SetAirfoilPnts( const string& xsec_id, CScriptArray* up
     vsp::SetAirfoilPnts( xsec_id, up_pnt_vec, low_pnt_vec );
 }
 
+//==== Copy Script Array Of Doubles Into Vector ====//
+static void DoubleArrayToVec( CScriptArray* arr, vector < double > & vec )
+{
+    vec.resize( arr->GetSize() );
+    for ( int i = 0 ; i < ( int )arr->GetSize() ; i++ )
+    {
+        vec[i] = * ( double* )( arr->At( i ) );
+    }
+}
+
+//==== Resize And Fill Script Array Of Doubles From Vector ====//
+static void VecToDoubleArray( const vector < double > & vec, CScriptArray* arr )
+{
+    arr->Resize( vec.size() );
+    for ( int i = 0 ; i < ( int )vec.size() ; i++ )
+    {
+        arr->SetValue( i, ( void* ) &vec[i] );
+    }
+}
+
+CScriptArray* ScriptMgrSingleton::CompVecPnt01( const string & geom_id, int surf_indx, CScriptArray* u_arr, CScriptArray* w_arr )
+{
+    vector < double > u_vec, w_vec;
+    DoubleArrayToVec( u_arr, u_vec );
+    DoubleArrayToVec( w_arr, w_vec );
+
+    m_ProxyVec3dArray = vsp::CompVecPnt01( geom_id, surf_indx, u_vec, w_vec );
+    return GetProxyVec3dArray();
+}
+
+CScriptArray* ScriptMgrSingleton::CompVecNorm01( const string & geom_id, int surf_indx, CScriptArray* u_arr, CScriptArray* w_arr )
+{
+    vector < double > u_vec, w_vec;
+    DoubleArrayToVec( u_arr, u_vec );
+    DoubleArrayToVec( w_arr, w_vec );
+
+    m_ProxyVec3dArray = vsp::CompVecNorm01( geom_id, surf_indx, u_vec, w_vec );
+    return GetProxyVec3dArray();
+}
+
+void ScriptMgrSingleton::CompVecCurvature01( const string & geom_id, int surf_indx, CScriptArray* u_arr, CScriptArray* w_arr,
+                                             CScriptArray* k1_arr, CScriptArray* k2_arr, CScriptArray* ka_arr, CScriptArray* kg_arr )
+{
+    vector < double > u_vec, w_vec;
+    DoubleArrayToVec( u_arr, u_vec );
+    DoubleArrayToVec( w_arr, w_vec );
+
+    vector < double > k1_vec, k2_vec, ka_vec, kg_vec;
+    vsp::CompVecCurvature01( geom_id, surf_indx, u_vec, w_vec, k1_vec, k2_vec, ka_vec, kg_vec );
+
+    VecToDoubleArray( k1_vec, k1_arr );
+    VecToDoubleArray( k2_vec, k2_arr );
+    VecToDoubleArray( ka_vec, ka_arr );
+    VecToDoubleArray( kg_vec, kg_arr );
+}
+
+void ScriptMgrSingleton::ProjVecPnt01( const string & geom_id, int surf_indx, CScriptArray* pnt_arr, CScriptArray* u_arr, CScriptArray* w_arr, CScriptArray* d_arr )
+{
+    vector< vec3d > pnt_vec;
+    pnt_vec.resize( pnt_arr->GetSize() );
+    for ( int i = 0 ; i < ( int )pnt_arr->GetSize() ; i++ )
+    {
+        pnt_vec[i] = * ( vec3d* )( pnt_arr->At( i ) );
+    }
+
+    vector < double > u_vec, w_vec, d_vec;
+    vsp::ProjVecPnt01( geom_id, surf_indx, pnt_vec, u_vec, w_vec, d_vec );
+
+    VecToDoubleArray( u_vec, u_arr );
+    VecToDoubleArray( w_vec, w_arr );
+    VecToDoubleArray( d_vec, d_arr );
+}
+
 void ScriptMgrSingleton::SetUpperCST( const string& xsec_id, int deg, CScriptArray* coefs_arr )
 {
     vector < double > coefs_vec;
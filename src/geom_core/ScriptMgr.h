@@ -59,6 +59,13 @@ public:
 
     bool ExecuteScript(  const char* module_name,  const char* function_name, bool arg_flag = false, double arg = 0.0 );
 
+    //==== Compiled Script Cache - Empty Dir Disables ====//
+    void SetByteCodeCacheDir( const string & dir )          { m_ByteCodeCacheDir = dir; }
+    string GetByteCodeCacheDir()                            { return m_ByteCodeCacheDir; }
+    string GetByteCodeFileName( const string & script_content );
+    bool GetLastLoadFromByteCode()                          { return m_LastLoadFromByteCode; }
+    int PruneByteCodeCache( int max_files = 256 );
+
     void AddToMessages( const string & msg )                { m_ScriptMessages += msg; }
     void ClearMessages()                                    { m_ScriptMessages.clear(); }
     string GetMessages()                                    { return m_ScriptMessages; }   
@@ -111,11 +118,29 @@ private:
     void RegisterAPI( asIScriptEngine* se );
     void RegisterUtility( asIScriptEngine* se );
 
+    //==== Function Handles and Contexts ====//
+    asIScriptFunction* FindFunction( const string & module_name, const string & function_name );
+    void ClearFunctionCache( const string & module_name );
+    asIScriptContext* RequestContext();
+    void ReturnContext( asIScriptContext* ctx );
+
+    //==== Module Content Index and Byte Code Cache ====//
+    static unsigned long long ComputeContentHash( const string & content );
+    string FindModuleByContent( const string & script_content, unsigned long long content_hash );
+    bool LoadByteCode( const string & module_name, const string & script_content, unsigned long long content_hash );
+    void SaveByteCode( const string & module_name, const string & script_content, unsigned long long content_hash );
+
     //==== Member Variables ====//
     asIScriptEngine* m_ScriptEngine;
 //    map< string, CScriptBuilder > m_BuilderMap;
     CScriptBuilder m_ScriptBuilder;
     map< string, string > m_ModuleContentMap;
+    map< unsigned long long, vector< string > > m_ContentHashMap;
+    map< string, map< string, asIScriptFunction* > > m_FunctionCache;
+    vector< asIScriptContext* > m_ContextPool;
+    unsigned long long m_EngineHash;
+    string m_ByteCodeCacheDir;
+    bool m_LastLoadFromByteCode;
     string m_ScriptMessages;
 
     //==== Test Proxy Stuff ====//
@@ -149,6 +174,8 @@ private:
     CScriptArray* GetDoubleResults( const string & id, const string & name, int index );
     CScriptArray* GetStringResults( const string & id, const string & name, int index );
     CScriptArray* GetVec3dResults( const string & id, const string & name, int index );
+    void WriteResultsBinaryFile( CScriptArray* id_arr, const string & file_name );
+    CScriptArray* ReadResultsBinaryFile( const string & file_name );
     CScriptArray* FindContainers();
     CScriptArray* FindContainersWithName( const string & name );
     CScriptArray* FindContainerGroupNames( const string & parm_container_id );
@@ -162,6 +189,12 @@ private:
     void SetAirfoilPnts( const string& xsec_id, CScriptArray* up_pnt_arr, CScriptArray* low_pnt_arr );
     void SetVec3dArray( CScriptArray* arr );
 
+    CScriptArray* CompVecPnt01( const string & geom_id, int surf_indx, CScriptArray* u_arr, CScriptArray* w_arr );
+    CScriptArray* CompVecNorm01( const string & geom_id, int surf_indx, CScriptArray* u_arr, CScriptArray* w_arr );
+    void CompVecCurvature01( const string & geom_id, int surf_indx, CScriptArray* u_arr, CScriptArray* w_arr,
+                             CScriptArray* k1_arr, CScriptArray* k2_arr, CScriptArray* ka_arr, CScriptArray* kg_arr );
+    void ProjVecPnt01( const string & geom_id, int surf_indx, CScriptArray* pnt_arr, CScriptArray* u_arr, CScriptArray* w_arr, CScriptArray* d_arr );
+
     void SetUpperCST( const string& xsec_id, int deg, CScriptArray* coefs );
     void SetLowerCST( const string& xsec_id, int deg, CScriptArray* coefs );
 
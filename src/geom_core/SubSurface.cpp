@@ -1266,3 +1266,161 @@ void SSControlSurf::UpdatePolygonPnts()
 
     m_PolyPntsReadyFlag = true;
 }
+
+//////////////////////////////////////////////////////////////////////
+//========================== SSTagIndex ============================//
+//////////////////////////////////////////////////////////////////////
+
+SSTagIndex::SSTagIndex()
+{
+    m_NU = m_NW = 0;
+    m_DU = m_DW = 1.0;
+}
+
+SSTagIndex::~SSTagIndex()
+{
+}
+
+//==== Bin Polygon Sub-Surfaces Into A UW Grid ====//
+void SSTagIndex::Build( const vector< SubSurface* > & sub_surfs )
+{
+    m_SubSurfs = sub_surfs;
+    int ss_num = ( int )m_SubSurfs.size();
+
+    m_AlwaysTest.assign( ss_num, true );
+    m_OutsideTag.assign( ss_num, false );
+    m_CellVec.clear();
+    m_NU = m_NW = 0;
+
+    vector< vec2d > ss_min( ss_num );
+    vector< vec2d > ss_max( ss_num );
+    vec2d all_min( 1.0e12, 1.0e12 );
+    vec2d all_max( -1.0e12, -1.0e12 );
+    int num_poly = 0;
+
+    for ( int s = 0 ; s < ss_num ; s++ )
+    {
+        SubSurface* ss = m_SubSurfs[s];
+
+        // Lazily built polygons must be ready before tagging goes parallel
+        ss->UpdatePolygonPnts();
+
+        if ( !ss->GetPolyFlag() )
+        {
+            continue;
+        }
+
+        m_AlwaysTest[s] = false;
+        m_OutsideTag[s] = ( ss->m_TestType() == vsp::OUTSIDE );
+
+        ss_min[s] = vec2d( 1.0e12, 1.0e12 );
+        ss_max[s] = vec2d( -1.0e12, -1.0e12 );
+
+        vector< vector< vec2d > > & poly_vec = ss->GetPolyPntsVec();
+        for ( int p = 0 ; p < ( int )poly_vec.size() ; p++ )
+        {
+            for ( int i = 0 ; i < ( int )poly_vec[p].size() ; i++ )
+            {
+                const vec2d & pnt = poly_vec[p][i];
+                ss_min[s].set_xy( min( ss_min[s].x(), pnt.x() ), min( ss_min[s].y(), pnt.y() ) );
+                ss_max[s].set_xy( max( ss_max[s].x(), pnt.x() ), max( ss_max[s].y(), pnt.y() ) );
+            }
+        }
+
+        if ( ss_min[s].x() > ss_max[s].x() )
+        {
+            continue; // Empty polygon, no point can be inside
+        }
+
+        all_min.set_xy( min( all_min.x(), ss_min[s].x() ), min( all_min.y(), ss_min[s].y() ) );
+        all_max.set_xy( max( all_max.x(), ss_max[s].x() ), max( all_max.y(), ss_max[s].y() ) );
+        num_poly++;
+    }
+
+    if ( num_poly == 0 )
+    {
+        return;
+    }
+
+    // Pad the boxes so points on a polygon edge still reach the full test
+    double tol = 1.0e-9 * max( 1.0, max( all_max.x() - all_min.x(), all_max.y() - all_min.y() ) );
+    all_min = all_min - vec2d( tol, tol );
+    all_max = all_max + vec2d( tol, tol );
+
+    m_NU = m_NW = min( 64, max( 4, 8 * num_poly ) );
+    m_Min = all_min;
+    m_DU = max( ( all_max.x() - all_min.x() ) / m_NU, tol );
+    m_DW = max( ( all_max.y() - all_min.y() ) / m_NW, tol );
+    m_CellVec.resize( m_NU * m_NW );
+
+    for ( int s = 0 ; s < ss_num ; s++ )
+    {
+        if ( m_AlwaysTest[s] || ss_min[s].x() > ss_max[s].x() )
+        {
+            continue;
+        }
+
+        int i0 = max( 0, ( int )floor( ( ss_min[s].x() - tol - m_Min.x() ) / m_DU ) );
+        int i1 = min( m_NU - 1, ( int )floor( ( ss_max[s].x() + tol - m_Min.x() ) / m_DU ) );
+        int j0 = max( 0, ( int )floor( ( ss_min[s].y() - tol - m_Min.y() ) / m_DW ) );
+        int j1 = min( m_NW - 1, ( int )floor( ( ss_max[s].y() + tol - m_Min.y() ) / m_DW ) );
+
+        for ( int i = i0 ; i <= i1 ; i++ )
+        {
+            for ( int j = j0 ; j <= j1 ; j++ )
+            {
+                m_CellVec[ i * m_NW + j ].push_back( s );
+            }
+        }
+    }
+}
+
+//==== Find Grid Cell Containing UW Point, -1 If Outside ====//
+int SSTagIndex::CellIndex( double u, double w ) const
+{
+    if ( m_CellVec.empty() )
+    {
+        return -1;
+    }
+
+    double fu = ( u - m_Min.x() ) / m_DU;
+    double fw = ( w - m_Min.y() ) / m_DW;
+
+    if ( fu < 0.0 || fw < 0.0 || fu >= m_NU || fw >= m_NW )
+    {
+        return -1;
+    }
+
+    return ( int )fu * m_NW + ( int )fw;
+}
+
+//==== Tag Point Against All Sub-Surfaces ====//
+void SSTagIndex::Subtag( const vec3d & center, vector< int > & tags ) const
+{
+    int cell = CellIndex( center.x(), center.y() );
+    const vector< int > * cand = ( cell >= 0 ) ? &m_CellVec[cell] : NULL;
+    int c = 0;
+
+    for ( int s = 0 ; s < ( int )m_SubSurfs.size() ; s++ )
+    {
+        bool in_ss;
+        if ( m_AlwaysTest[s] )
+        {
+            in_ss = m_SubSurfs[s]->Subtag( center );
+        }
+        else if ( cand && c < ( int )cand->size() && ( *cand )[c] == s )
+        {
+            in_ss = m_SubSurfs[s]->Subtag( center );
+            c++;
+        }
+        else
+        {
+            in_ss = m_OutsideTag[s];
+        }
+
+        if ( in_ss )
+        {
+            tags.push_back( m_SubSurfs[s]->m_Tag );
+        }
+    }
+}
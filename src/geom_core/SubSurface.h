@@ -243,4 +243,40 @@ protected:
     DrawObj m_ArrowDO;
 };
 
+// Uniform UW grid over the polygon bounding boxes of the sub-surfaces on one
+// surface.  Each cell lists the polygon sub-surfaces that may contain a point
+// in that cell, so the point in polygon test is skipped for all others.  Build
+// also updates every polygon up front so Subtag may be called from several
+// threads at once.
+class SSTagIndex
+{
+public:
+    SSTagIndex();
+    virtual ~SSTagIndex();
+
+    virtual void Build( const std::vector< SubSurface* > & sub_surfs );
+
+    // Append the tag of each sub-surface containing center, in sub-surface order
+    virtual void Subtag( const vec3d & center, std::vector< int > & tags ) const;
+
+    virtual int GetNumCells() const
+    {
+        return m_NU * m_NW;
+    }
+
+protected:
+    int CellIndex( double u, double w ) const;
+
+    std::vector< SubSurface* > m_SubSurfs;
+    std::vector< bool > m_AlwaysTest; // Non polygon sub-surfaces are tested everywhere
+    std::vector< bool > m_OutsideTag; // Result for a point outside all polygon bounding boxes
+
+    int m_NU;
+    int m_NW;
+    vec2d m_Min;
+    double m_DU;
+    double m_DW;
+    std::vector< std::vector< int > > m_CellVec; // Sorted candidate sub-surface indices per cell
+};
+
 #endif
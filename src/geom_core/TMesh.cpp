@@ -3905,25 +3905,34 @@ void TMesh::SubTag( int part_num, bool tag_subs )
     // Split tris will be subtagged the same as their parent
     vector<SubSurface*> sub_surfs;
     if ( tag_subs ) sub_surfs = SubSurfaceMgr.GetSubSurfs( m_PtrID, m_SurfNum );
-    int ss_num = ( int )sub_surfs.size();
 
-    for ( int t = 0 ; t < ( int )m_TVec.size(); t ++ )
+    SSTagIndex ss_index;
+    ss_index.Build( sub_surfs );
+
+    int ntri = ( int )m_TVec.size();
+
+    #pragma omp parallel
     {
-        TTri* tri = m_TVec[t];
-        tri->m_Tags.push_back( part_num ); // Give Tri overall surface ID number
-        for ( int s = 0; s < ss_num; s++ )
+        set< vector< int > > loc_combos;
+
+        #pragma omp for schedule( dynamic, 256 )
+        for ( int t = 0 ; t < ntri ; t++ )
         {
-            if ( sub_surfs[s]->Subtag( tri ) )
+            TTri* tri = m_TVec[t];
+            tri->m_Tags.push_back( part_num ); // Give Tri overall surface ID number
+            ss_index.Subtag( tri->ComputeCenterUW(), tri->m_Tags );
+
+            loc_combos.insert( tri->m_Tags );
+
+            for ( int st = 0; st < ( int )tri->m_SplitVec.size() ; st++ ) // Set split tris to have same tags as main tri
             {
-                tri->m_Tags.push_back( sub_surfs[s]->m_Tag );
+                tri->m_SplitVec[st]->m_Tags = tri->m_Tags;
             }
         }
 
-        SubSurfaceMgr.m_TagCombos.insert( tri->m_Tags );
-
-        for ( int st = 0; st < ( int )tri->m_SplitVec.size() ; st++ ) // Set split tris to have same tags as main tri
+        #pragma omp critical
         {
-            tri->m_SplitVec[st]->m_Tags = tri->m_Tags;
+            SubSurfaceMgr.m_TagCombos.insert( loc_combos.begin(), loc_combos.end() );
         }
     }
 }
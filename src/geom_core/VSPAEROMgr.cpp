@@ -244,6 +244,10 @@ void VSPAEROMgrSingleton::UpdateFilenames()    //A.K.A. SetupDegenFile()
 
             m_ModelNameBase = m_DegenFileFull;
             pos = m_ModelNameBase.find( ".csv" );
+            if ( pos < 0 )
+            {
+                pos = m_ModelNameBase.find( ".dgb" );
+            }
             if ( pos >= 0 )
             {
                 m_ModelNameBase.erase( pos, m_ModelNameBase.length() - 1 );
@@ -314,6 +318,17 @@ string VSPAEROMgrSingleton::ComputeGeometry()
 
     veh->WriteDegenGeomFile();
 
+    // vspaero reads <base>.dgb ahead of <base>.csv and <base>.tri, so in any
+    // mode remove whichever degen file was not just written
+    if ( Vehicle::IsDegenGeomBinaryFileName( m_DegenFileFull ) )
+    {
+        remove( ( m_ModelNameBase + string( ".csv" ) ).c_str() );
+    }
+    else
+    {
+        remove( ( m_ModelNameBase + string( ".dgb" ) ).c_str() );
+    }
+
     // restore original values
     veh->setExportDegenGeomMFile( exptMfile_orig );
     veh->setExportDegenGeomCsvFile( exptCSVfile_orig );
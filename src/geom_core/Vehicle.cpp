@@ -43,6 +43,7 @@ using namespace vsp;
 #include <map>
 #include <algorithm>
 #include <utility>
+#include <chrono>
 
 #include <api/dll_iges.h>
 
@@ -55,6 +56,7 @@ Vehicle::Vehicle()
     m_STEPMergePoints.Init( "MergePoints", "STEPSettings", this, true, 0, 1 );
     m_STEPToCubic.Init( "ToCubic", "STEPSettings", this, false, 0, 1 );
     m_STEPToCubicTol.Init( "ToCubicTol", "STEPSettings", this, 1e-6, 1e-12, 1e12 );
+    m_STEPStreamWrite.Init( "StreamWrite", "STEPSettings", this, false, 0, 1 );
 
     m_IGESLenUnit.Init( "LenUnit", "IGESSettings", this, vsp::LEN_FT, vsp::LEN_MM, vsp::LEN_FT );
     m_IGESSplitSurfs.Init( "SplitSurfs", "IGESSettings", this, true, 0, 1 );
@@ -75,7 +77,13 @@ Vehicle::Vehicle()
 
     m_STLMultiSolid.Init( "MultiSolid", "STLSettings", this, false, 0, 1 );
 
+    m_NumMassSlices.Init( "NumMassSlices", "MassProperties", this, 20, 1, 1000000 );
+    m_NumMassSlices.SetDescript( "Number of slices used to build the mass properties mesh" );
+    m_MassPropMode.Init( "MassPropMode", "MassProperties", this, vsp::MASS_PROP_SLICE, vsp::MASS_PROP_SLICE, vsp::NUM_MASS_PROP_MODES - 1 );
+    m_MassPropMode.SetDescript( "Mass properties by slice mesh or by surface integral" );
+
     m_UpdatingBBox = false;
+    m_UpdateTransactionDepth = 0;
     m_BbXLen.Init( "X_Len", "BBox", this, 0, 0, 1e12 );
     m_BbXLen.SetDescript( "X length of vehicle bounding box" );
     m_BbYLen.Init( "Y_Len", "BBox", this, 0, 0, 1e12 );
@@ -169,7 +177,8 @@ void Vehicle::Init()
     m_IxxIyyIzz = vec3d( 0, 0, 0 );
     m_IxyIxzIyz = vec3d( 0, 0, 0 );
     m_CG = vec3d( 0, 0, 0 );
-    m_NumMassSlices = 20;
+    m_NumMassSlices.Set( 20 );
+    m_MassPropMode.Set( vsp::MASS_PROP_SLICE );
     m_TotalMass = 0;
 
     m_STEPLenUnit.Set( vsp::LEN_FT );
@@ -178,6 +187,7 @@ void Vehicle::Init()
     m_STEPMergePoints.Set( true );
     m_STEPToCubic.Set( false );
     m_STEPToCubicTol.Set( 1e-6 );
+    m_STEPStreamWrite.Set( false );
 
     m_IGESLenUnit.Set( vsp::LEN_FT );
     m_IGESSplitSurfs.Set( true );
@@ -201,6 +211,7 @@ void Vehicle::Init()
     m_BEMPropID = string();
 
     m_UpdatingBBox = false;
+    m_UpdateTransactionDepth = 0;
     m_BbXLen.Set( 0 );
     m_BbYLen.Set( 0 );
     m_BbZLen.Set( 0 );
@@ -236,7 +247,6 @@ void Vehicle::Wype()
     m_IxxIyyIzz = vec3d();
     m_IxyIxzIyz = vec3d();
     m_CG = vec3d();
-    m_NumMassSlices = int();
     m_TotalMass = double();
 
 
@@ -378,6 +388,109 @@ void Vehicle::ForceUpdate()
     Update();
 }
 
+//==== Start Collecting Parm Changes Without Updating ====//
+void Vehicle::BeginUpdateTransaction()
+{
+    if ( m_UpdateTransactionDepth == 0 )
+    {
+        LinkMgr.BeginDeferredChanges();
+    }
+    m_UpdateTransactionDepth++;
+}
+
+//==== Propagate Collected Changes And Update Only Affected Geoms ====//
+int Vehicle::CommitUpdateTransaction()
+{
+    if ( m_UpdateTransactionDepth == 0 )
+    {
+        return 0;
+    }
+
+    m_UpdateTransactionDepth--;
+    if ( m_UpdateTransactionDepth > 0 )            // Nested - Outermost Commit Does The Work
+    {
+        return 0;
+    }
+
+    std::chrono::high_resolution_clock::time_point t0 = std::chrono::high_resolution_clock::now();
+
+    //==== Links Propagate Once, Still In Transaction So Driven Geoms Are Only Flagged ====//
+    m_UpdateTransactionDepth++;
+    int num_link_parms = LinkMgr.PropagateDeferredChanges();
+    m_UpdateTransactionDepth--;
+
+    //==== Update Flagged Geoms Along With Their Descendants ====//
+    int num_updated = 0;
+    for ( int i = 0 ; i < ( int )m_TopGeom.size() ; i++ )
+    {
+        Geom* g_ptr = FindGeom( m_TopGeom[i] );
+        if ( g_ptr )
+        {
+            num_updated += UpdateLateGeom( g_ptr );
+        }
+    }
+
+    ParmChanged( NULL, Parm::SET );
+
+    std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+
+    //==== Only Keep Stats For The Latest Commit ====//
+    while ( ResultsMgr.GetNumResults( "Update_Transaction" ) > 0 )
+    {
+        ResultsMgr.DeleteResult( ResultsMgr.FindResultsID( "Update_Transaction",  0 ) );
+    }
+    Results* res = ResultsMgr.CreateResults( "Update_Transaction" );
+    if ( res )
+    {
+        res->Add( NameValData( "Num_Geoms_Updated", num_updated ) );
+        res->Add( NameValData( "Num_Geoms", ( int )m_GeomStoreVec.size() ) );
+        res->Add( NameValData( "Num_Link_Parms", num_link_parms ) );
+        res->Add( NameValData( "Commit_Time", std::chrono::duration< double >( t1 - t0 ).count() ) );
+        res->Add( NameValData( "Tess_Cache_Hits", ( int )VspSurf::GetTessCacheHits() ) );
+        res->Add( NameValData( "Tess_Cache_Misses", ( int )VspSurf::GetTessCacheMisses() ) );
+    }
+
+    return num_updated;
+}
+
+//==== Update Geom And Descendants If Flagged, Otherwise Check Children - Return Count Updated ====//
+int Vehicle::UpdateLateGeom( Geom* geom_ptr )
+{
+    vector< string > child_vec = geom_ptr->GetChildIDVec();
+
+    if ( geom_ptr->GetLateUpdateFlag() )
+    {
+        //==== Geom::Update Also Updates All Descendants ====//
+        int num_updated = 1;
+        vector< string > desc_vec = child_vec;
+        while ( desc_vec.size() )
+        {
+            Geom* desc_ptr = FindGeom( desc_vec.back() );
+            desc_vec.pop_back();
+            if ( desc_ptr )
+            {
+                vector< string > grand_vec = desc_ptr->GetChildIDVec();
+                desc_vec.insert( desc_vec.end(), grand_vec.begin(), grand_vec.end() );
+                num_updated++;
+            }
+        }
+
+        geom_ptr->Update();
+        return num_updated;
+    }
+
+    int num_updated = 0;
+    for ( int i = 0 ; i < ( int )child_vec.size() ; i++ )
+    {
+        Geom* child_ptr = FindGeom( child_vec[i] );
+        if ( child_ptr )
+        {
+            num_updated += UpdateLateGeom( child_ptr );
+        }
+    }
+    return num_updated;
+}
+
 //===== Run Script ====//
 void Vehicle::RunScript( const string & file_name, const string & function_name )
 {
@@ -2230,6 +2343,12 @@ void Vehicle::FetchXFerSurfs( int write_set, vector< XferSurf > &xfersurfs )
 
 void Vehicle::WriteSTEPFile( const string & file_name, int write_set )
 {
+    if ( m_STEPStreamWrite() )
+    {
+        WriteSTEPFileStream( file_name, write_set );
+        return;
+    }
+
     STEPutil step( m_STEPLenUnit(), m_STEPTol() );
 
     vector< Geom* > geom_vec = FindGeomVec( GetGeomVec( false ) );
@@ -2250,6 +2369,34 @@ void Vehicle::WriteSTEPFile( const string & file_name, int write_set )
     step.WriteFile( file_name );
 }
 
+//==== Write STEP Without Building The SDAI Instance Graph ====//
+void Vehicle::WriteSTEPFileStream( const string & file_name, int write_set )
+{
+    STEPStreamWriter step( m_STEPLenUnit(), m_STEPTol() );
+
+    if ( !step.Open( file_name ) )
+    {
+        return;
+    }
+
+    vector< Geom* > geom_vec = FindGeomVec( GetGeomVec( false ) );
+    for ( int i = 0 ; i < ( int )geom_vec.size() ; i++ )
+    {
+        if( geom_vec[i]->GetSetFlag( write_set ) )
+        {
+            vector<VspSurf> surf_vec;
+            geom_vec[i]->GetSurfVec( surf_vec );
+
+            for ( int j = 0; j < surf_vec.size(); j++ )
+            {
+                step.AddSurf( &surf_vec[j], m_STEPSplitSurfs(), m_STEPMergePoints(), m_STEPToCubic(), m_STEPToCubicTol() );
+            }
+        }
+    }
+
+    step.Close();
+}
+
 void Vehicle::WriteIGESFile( const string & file_name, int write_set )
 {
     DLL_IGES model;
@@ -2581,7 +2728,7 @@ string Vehicle::CompGeomAndFlatten( int set, int halfFlag, int intSubsFlag )
     return id;
 }
 
-string Vehicle::MassProps( int set, int numSlices, bool hidegeom, bool writefile )
+string Vehicle::MassProps( int set, int numSlices, bool hidegeom, bool writefile, int mode )
 {
     string id = AddMeshGeom( set );
     if ( id.compare( "NONE" ) == 0 )
@@ -2627,7 +2774,14 @@ string Vehicle::MassProps( int set, int numSlices, bool hidegeom, bool writefile
 
     if ( mesh_ptr->m_TMeshVec.size() || mesh_ptr->m_PointMassVec.size() )
     {
-        mesh_ptr->MassSliceX( numSlices, writefile );
+        if ( mode == vsp::MASS_PROP_SURF_INTEGRAL )
+        {
+            mesh_ptr->MassSurfIntegral( writefile );
+        }
+        else
+        {
+            mesh_ptr->MassSliceX( numSlices, writefile );
+        }
         m_TotalMass = mesh_ptr->m_TotalMass;
         m_IxxIyyIzz = vec3d( mesh_ptr->m_TotalIxx, mesh_ptr->m_TotalIyy, mesh_ptr->m_TotalIzz );
         m_IxyIxzIyz = vec3d( mesh_ptr->m_TotalIxy, mesh_ptr->m_TotalIxz, mesh_ptr->m_TotalIyz );
@@ -2644,9 +2798,9 @@ string Vehicle::MassProps( int set, int numSlices, bool hidegeom, bool writefile
     return id;
 }
 
-string Vehicle::MassPropsAndFlatten( int set, int numSlices, bool hidegeom, bool writefile )
+string Vehicle::MassPropsAndFlatten( int set, int numSlices, bool hidegeom, bool writefile, int mode )
 {
-    string id = MassProps( set, numSlices, hidegeom, writefile );
+    string id = MassProps( set, numSlices, hidegeom, writefile, mode );
     Geom* geom = FindGeom( id );
     if ( !geom )
     {
@@ -3061,18 +3215,20 @@ void Vehicle::ExportFile( const string & file_name, int write_set, int file_type
 
 void Vehicle::CreateDegenGeom( int set )
 {
-    vector< string > geom_id_vec;
+    std::chrono::steady_clock::time_point t_start = std::chrono::steady_clock::now();
+
     m_DegenGeomVec.clear();
     m_DegenPtMassVec.clear();
 
-    vector< Geom* > geom_vec = FindGeomVec( GetGeomVec( false ) );
-    for ( int i = 0 ; i < ( int )geom_vec.size() ; i++ )
+    vector< Geom* > geom_vec;
+    vector< Geom* > all_geom_vec = FindGeomVec( GetGeomVec( false ) );
+    for ( int i = 0 ; i < ( int )all_geom_vec.size() ; i++ )
     {
-        if ( geom_vec[i]->GetSetFlag( set ) )
+        if ( all_geom_vec[i]->GetSetFlag( set ) )
         {
-            if( geom_vec[i]->GetType().m_Type == BLANK_GEOM_TYPE )
+            if( all_geom_vec[i]->GetType().m_Type == BLANK_GEOM_TYPE )
             {
-                BlankGeom *g = (BlankGeom*) geom_vec[i];
+                BlankGeom *g = (BlankGeom*) all_geom_vec[i];
                 if( g->m_PointMassFlag() )
                 {
                     DegenPtMass pm;
@@ -3084,37 +3240,75 @@ void Vehicle::CreateDegenGeom( int set )
             }
             else
             {
-                geom_vec[i]->CreateDegenGeom( m_DegenGeomVec );
+                geom_vec.push_back( all_geom_vec[i] );
             }
         }
     }
 
-    vector< string > active_vec_store = GetActiveGeomVec();
+    //==== Each Geom Only Touches Its Own Surfaces - Build in Parallel, Merge in Order ====//
+    vector< vector< DegenGeom > > geom_degen_vec( geom_vec.size() );
 
-    string id = AddMeshGeom( set );
-    if ( id.compare( "NONE" ) != 0 )
+    #pragma omp parallel for schedule( dynamic )
+    for ( int i = 0 ; i < ( int )geom_vec.size() ; i++ )
     {
-        MeshGeom* mesh_ptr = dynamic_cast<MeshGeom*> ( FindGeom( id ) );
-        if ( mesh_ptr != NULL )
-        {
-            mesh_ptr->degenGeomIntersectTrim(m_DegenGeomVec);
-            DeleteGeom( id );
-        }
+        geom_vec[i]->CreateDegenGeom( geom_degen_vec[i] );
+    }
+
+    for ( int i = 0 ; i < ( int )geom_degen_vec.size() ; i++ )
+    {
+        m_DegenGeomVec.insert( m_DegenGeomVec.end(), geom_degen_vec[i].begin(), geom_degen_vec[i].end() );
     }
 
+    std::chrono::steady_clock::time_point t_degen = std::chrono::steady_clock::now();
+
+    vector< string > active_vec_store = GetActiveGeomVec();
+
+    //==== One CompGeom Build Shared by Intersect/Trim and Mass Slicing ====//
+    string id = AddMeshGeom( set );
+
+    std::chrono::steady_clock::time_point t_mesh = std::chrono::steady_clock::now();
+    std::chrono::steady_clock::time_point t_trim = t_mesh;
+    std::chrono::steady_clock::time_point t_mass = t_mesh;
 
-    id = AddMeshGeom( set );
     if ( id.compare( "NONE" ) != 0 )
     {
         MeshGeom* mesh_ptr = dynamic_cast<MeshGeom*> ( FindGeom( id ) );
         if ( mesh_ptr != NULL )
         {
-            mesh_ptr->degenGeomMassSliceX(m_DegenGeomVec);
-            DeleteGeom( id );
+            mesh_ptr->degenGeomIntersectTrim( m_DegenGeomVec );
+            t_trim = std::chrono::steady_clock::now();
+
+            mesh_ptr->degenGeomMassSliceX( m_DegenGeomVec, true );
+            t_mass = std::chrono::steady_clock::now();
         }
+        DeleteGeom( id );
     }
 
     SetActiveGeomVec( active_vec_store );
+
+    std::chrono::steady_clock::time_point t_end = std::chrono::steady_clock::now();
+
+    Results* res = ResultsMgr.CreateResults( "DegenGeom" );
+    res->Add( NameValData( "Num_Degen_Geoms", ( int )m_DegenGeomVec.size() ) );
+    res->Add( NameValData( "Num_Point_Masses", ( int )m_DegenPtMassVec.size() ) );
+    res->Add( NameValData( "Degen_Create_Time", std::chrono::duration< double >( t_degen - t_start ).count() ) );
+    res->Add( NameValData( "Mesh_Build_Time", std::chrono::duration< double >( t_mesh - t_degen ).count() ) );
+    res->Add( NameValData( "Intersect_Trim_Time", std::chrono::duration< double >( t_trim - t_mesh ).count() ) );
+    res->Add( NameValData( "Mass_Slice_Time", std::chrono::duration< double >( t_mass - t_trim ).count() ) );
+    res->Add( NameValData( "Total_Time", std::chrono::duration< double >( t_end - t_start ).count() ) );
+    res->Add( NameValData( "Tess_Cache_Hits", ( int )VspSurf::GetTessCacheHits() ) );
+    res->Add( NameValData( "Tess_Cache_Misses", ( int )VspSurf::GetTessCacheMisses() ) );
+}
+
+//==== DegenGeom Export Written in Binary When File Name Ends in .dgb ====//
+bool Vehicle::IsDegenGeomBinaryFileName( const string & file_name )
+{
+    std::string::size_type loc = file_name.find_last_of( "." );
+    if ( loc == std::string::npos )
+    {
+        return false;
+    }
+    return file_name.compare( loc, std::string::npos, ".dgb" ) == 0;
 }
 
 //==== Write Degen Geom File ====//
@@ -3135,7 +3329,34 @@ string Vehicle::WriteDegenGeomFile()
     outStr += geomCntStr;
     outStr += " blank geoms\nto the following files:\n\n";
 
-    if ( getExportDegenGeomCsvFile() )
+    if ( getExportDegenGeomCsvFile() && IsDegenGeomBinaryFileName( getExportFileName( DEGEN_GEOM_CSV_TYPE ) ) )
+    {
+        string file_name = getExportFileName( DEGEN_GEOM_CSV_TYPE );
+        FILE* file_id = fopen( file_name.c_str(), "wb" );
+
+        if ( !file_id )
+        {
+            outStr += "\tFAILED TO OPEN: ";
+            outStr += file_name;
+            outStr += "\n";
+        }
+        else
+        {
+            DegenGeom::write_degenGeomBinaryHeader( file_id, geomCnt, m_DegenPtMassVec );
+
+            for ( int i = 0; i < (int)m_DegenGeomVec.size(); i++ )
+            {
+                m_DegenGeomVec[i].write_degenGeomBinary_file( file_id );
+            }
+
+            fclose( file_id );
+
+            outStr += "\t";
+            outStr += file_name;
+            outStr += "\n";
+        }
+    }
+    else if ( getExportDegenGeomCsvFile() )
     {
         string file_name = getExportFileName( DEGEN_GEOM_CSV_TYPE );
         FILE* file_id = fopen(file_name.c_str(), "w");
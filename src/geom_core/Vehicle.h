@@ -24,6 +24,7 @@
 #include "ClippingMgr.h"
 #include "SnapTo.h"
 #include "STEPutil.h"
+#include "STEPStream.h"
 #include "XferSurf.h"
 #include "MaterialMgr.h"
 #include "WaveDragMgr.h"
@@ -82,6 +83,11 @@ public:
     void Update( bool fullupdate = true );
     void ForceUpdate();
     void UpdateGui();
+
+    //==== Batched Parm Changes - Links And Geoms Are Updated Once At Commit ====//
+    void BeginUpdateTransaction();
+    int CommitUpdateTransaction();                  // Returns Number Of Geoms Updated
+    bool InUpdateTransaction()                                      { return m_UpdateTransactionDepth > 0; }
     void RunScript( const string & file_name, const string & function_name = "void main()" );
 
     Geom* FindGeom( const string & geom_id );
@@ -196,6 +202,7 @@ public:
     void WriteX3DViewpointProps( xmlNodePtr node, string orients, string cents, string posits, string sfov, string name );
     void WritePovRayFile( const string & file_name, int write_set );
     void WriteSTEPFile( const string & file_name, int write_set );
+    void WriteSTEPFileStream( const string & file_name, int write_set );
     void WriteIGESFile( const string & file_name, int write_set );
     void WriteBEMFile( const string & file_name, int write_set );
     void WriteDXFFile( const string & file_name, int write_set );
@@ -224,8 +231,8 @@ public:
     //Comp Geom
     string CompGeom( int set, int halfFlag, int intSubsFlag = 1 );
     string CompGeomAndFlatten( int set, int halfFlag, int intSubsFlag = 1 );
-    string MassProps( int set, int numSlices, bool hidegeom = true, bool writefile = true );
-    string MassPropsAndFlatten( int set, int numSlices, bool hidegeom = true, bool writefile = true );
+    string MassProps( int set, int numSlices, bool hidegeom = true, bool writefile = true, int mode = vsp::MASS_PROP_SLICE );
+    string MassPropsAndFlatten( int set, int numSlices, bool hidegeom = true, bool writefile = true, int mode = vsp::MASS_PROP_SLICE );
     string PSlice( int set, int numSlices, vec3d norm, bool autoBoundsFlag, double start = 0, double end = 0 );
     string PSliceAndFlatten( int set, int numSlices, vec3d norm, bool autoBoundsFlag, double start = 0, double end = 0 );
 
@@ -233,6 +240,7 @@ public:
     void CreateDegenGeom( int set );
     vector< DegenGeom > GetDegenGeomVec()    { return m_DegenGeomVec; }
     string WriteDegenGeomFile();
+    static bool IsDegenGeomBinaryFileName( const string & file_name );
 
     CfdMeshSettings* GetCfdSettingsPtr()
     {
@@ -269,7 +277,8 @@ public:
     vec3d m_IxxIyyIzz;
     vec3d m_IxyIxzIyz;
     vec3d m_CG;
-    int m_NumMassSlices;
+    IntParm m_NumMassSlices;
+    IntParm m_MassPropMode;
     double m_TotalMass;
 
     Parm m_BbXLen;
@@ -285,6 +294,7 @@ public:
     BoolParm m_STEPMergePoints;
     BoolParm m_STEPToCubic;
     Parm m_STEPToCubicTol;
+    BoolParm m_STEPStreamWrite;
 
     IntParm m_IGESLenUnit;
     BoolParm m_IGESSplitSurfs;
@@ -337,6 +347,9 @@ protected:
     bool m_UpdatingBBox;
     BndBox m_BBox;                              // Bounding Box Around All Geometries
 
+    int m_UpdateTransactionDepth;
+    int UpdateLateGeom( Geom* geom_ptr );
+
     vector< string > CopyGeomVec( const vector<string> & geom_vec );
     void InsertIntoActiveDeque( const string & add_id, const string & parent_id );  // Insert Geom After Parent
     void SetApplyAbsIgnoreFlag( const vector< string > &g_vec, bool val );
@@ -20,6 +20,7 @@ MassPropScreen::MassPropScreen( ScreenMgr *mgr ) : VspScreen( mgr )
     ui->numSlicesInput->callback( staticScreenCB, this );
     ui->fileExportButton->callback( staticScreenCB, this );
     ui->setChoice->callback( staticScreenCB, this );
+    ui->modeChoice->callback( staticScreenCB, this );
     ui->numSlicesSlider->range( 10, 200 );
     m_FLTK_Window = ui->UIWindow;
     m_SelectedSetIndex = 0;
@@ -38,10 +39,24 @@ bool MassPropScreen::Update()
     char str[255];
     char format[10] = " %6.3f";
 
-    m_MassPropUI->numSlicesSlider->value( vehiclePtr->m_NumMassSlices );
-    sprintf( str, " %d", vehiclePtr->m_NumMassSlices );
+    m_MassPropUI->numSlicesSlider->value( vehiclePtr->m_NumMassSlices() );
+    sprintf( str, " %d", vehiclePtr->m_NumMassSlices() );
     m_MassPropUI->numSlicesInput->value( str );
 
+    m_MassPropUI->modeChoice->value( vehiclePtr->m_MassPropMode() );
+
+    //==== Slices Only Apply To The Slice Mode ====//
+    if ( vehiclePtr->m_MassPropMode() == vsp::MASS_PROP_SLICE )
+    {
+        m_MassPropUI->numSlicesSlider->activate();
+        m_MassPropUI->numSlicesInput->activate();
+    }
+    else
+    {
+        m_MassPropUI->numSlicesSlider->deactivate();
+        m_MassPropUI->numSlicesInput->deactivate();
+    }
+
     sprintf( str, format, vehiclePtr->m_TotalMass );
     m_MassPropUI->totalMassOutput->value( str );
 
@@ -107,15 +122,19 @@ void MassPropScreen::CallBack( Fl_Widget* w )
 
     if ( w == m_MassPropUI->computeButton )
     {
-        veh->MassPropsAndFlatten( m_SelectedSetIndex, veh->m_NumMassSlices );
+        veh->MassPropsAndFlatten( m_SelectedSetIndex, veh->m_NumMassSlices(), true, true, veh->m_MassPropMode() );
     }
     else if ( w == m_MassPropUI->numSlicesSlider )
     {
-        veh->m_NumMassSlices = ( int )m_MassPropUI->numSlicesSlider->value();
+        veh->m_NumMassSlices.Set( ( int )m_MassPropUI->numSlicesSlider->value() );
     }
     else if ( w == m_MassPropUI->numSlicesInput )
     {
-        veh->m_NumMassSlices = atoi( m_MassPropUI->numSlicesInput->value() );
+        veh->m_NumMassSlices.Set( atoi( m_MassPropUI->numSlicesInput->value() ) );
+    }
+    else if ( w == m_MassPropUI->modeChoice )
+    {
+        veh->m_MassPropMode.Set( m_MassPropUI->modeChoice->value() );
     }
     else if ( w == m_MassPropUI->fileExportButton )
     {
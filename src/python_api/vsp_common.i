@@ -20,6 +20,19 @@ namespace std {
 }
 
 %apply std::vector<vec3d> &INPUT { std::vector<vec3d> & pnt_vec };
+
+/* Surface query outputs are appended to the returned tuple so results can be passed straight to numpy.array */
+%apply double &OUTPUT { double & k1_out, double & k2_out, double & ka_out, double & kg_out, double & u_out, double & w_out };
+
+%typemap(in, numinputs=0) std::vector<double> & OUTVEC (std::vector<double> temp) {
+    $1 = &temp;
+}
+%typemap(argout) std::vector<double> & OUTVEC {
+    $result = SWIG_AppendOutput( $result, swig::from( *$1 ) );
+}
+%apply std::vector<double> & OUTVEC { std::vector<double> & k1_out_vec, std::vector<double> & k2_out_vec, std::vector<double> & ka_out_vec, std::vector<double> & kg_out_vec };
+%apply std::vector<double> & OUTVEC { std::vector<double> & u_out_vec, std::vector<double> & w_out_vec, std::vector<double> & d_out_vec };
+
 /* Let's just grab the original header file here */
 %include "APIDefines.h"
 %include "APIErrorMgr.h"
@@ -10,6 +10,7 @@
 
 #include "BndBox.h"
 #include <assert.h>
+#include <algorithm>
 
 
 //===== Constructor =====//
@@ -315,3 +316,133 @@ std::vector< vec3d > BndBox::GetBBoxDrawLines() const
     return lines;
 }
 
+
+//////////////////////////////////////////////////////////////////////
+//==== Static AABB Tree ====//
+//////////////////////////////////////////////////////////////////////
+//==== Order Box Indices By Center Along One Axis ====//
+struct BndBoxCenterCompare
+{
+    BndBoxCenterCompare( const std::vector< BndBox > & box_vec, int axis ) : m_BoxVec( box_vec ), m_Axis( axis ) {}
+
+    bool operator()( int a, int b ) const
+    {
+        return ( m_BoxVec[a].GetMin( m_Axis ) + m_BoxVec[a].GetMax( m_Axis ) ) <
+               ( m_BoxVec[b].GetMin( m_Axis ) + m_BoxVec[b].GetMax( m_Axis ) );
+    }
+
+    const std::vector< BndBox > & m_BoxVec;
+    int m_Axis;
+};
+
+BndBoxTree::BndBoxTree()
+{
+}
+
+void BndBoxTree::Clear()
+{
+    m_NodeVec.clear();
+    m_IdVec.clear();
+    m_BoxVec.clear();
+}
+
+//==== Build Top Down - Split At Median Center Along Longest Axis ====//
+void BndBoxTree::Build( const std::vector< BndBox > & box_vec )
+{
+    Clear();
+
+    m_BoxVec = box_vec;
+    m_IdVec.resize( box_vec.size() );
+    for ( int i = 0 ; i < ( int )box_vec.size() ; i++ )
+    {
+        m_IdVec[i] = i;
+    }
+
+    if ( m_BoxVec.size() > 0 )
+    {
+        m_NodeVec.reserve( 2 * m_BoxVec.size() );
+        BuildNode( 0, ( int )m_IdVec.size() );
+    }
+}
+
+int BndBoxTree::BuildNode( int begin_ind, int end_ind )
+{
+    int node_ind = ( int )m_NodeVec.size();
+    m_NodeVec.push_back( Node() );
+
+    BndBox box, center_box;
+    for ( int i = begin_ind ; i < end_ind ; i++ )
+    {
+        box.Update( m_BoxVec[ m_IdVec[i] ] );
+        center_box.Update( m_BoxVec[ m_IdVec[i] ].GetCenter() );
+    }
+
+    m_NodeVec[node_ind].m_Box = box;
+    m_NodeVec[node_ind].m_BeginInd = begin_ind;
+    m_NodeVec[node_ind].m_EndInd = end_ind;
+    m_NodeVec[node_ind].m_Child[0] = -1;
+    m_NodeVec[node_ind].m_Child[1] = -1;
+
+    if ( end_ind - begin_ind <= 4 )
+    {
+        return node_ind;
+    }
+
+    int axis = 0;
+    for ( int k = 1 ; k < 3 ; k++ )
+    {
+        if ( ( center_box.GetMax( k ) - center_box.GetMin( k ) ) > ( center_box.GetMax( axis ) - center_box.GetMin( axis ) ) )
+        {
+            axis = k;
+        }
+    }
+
+    int mid_ind = ( begin_ind + end_ind ) / 2;
+    std::nth_element( m_IdVec.begin() + begin_ind, m_IdVec.begin() + mid_ind, m_IdVec.begin() + end_ind,
+                      BndBoxCenterCompare( m_BoxVec, axis ) );
+
+    int child0 = BuildNode( begin_ind, mid_ind );
+    int child1 = BuildNode( mid_ind, end_ind );
+    m_NodeVec[node_ind].m_Child[0] = child0;
+    m_NodeVec[node_ind].m_Child[1] = child1;
+
+    return node_ind;
+}
+
+void BndBoxTree::Intersect( const BndBox & box, std::vector< int > & id_vec ) const
+{
+    if ( m_NodeVec.empty() )
+    {
+        return;
+    }
+
+    std::vector< int > stack;
+    stack.push_back( 0 );
+
+    while ( !stack.empty() )
+    {
+        const Node & node = m_NodeVec[ stack.back() ];
+        stack.pop_back();
+
+        if ( !Compare( box, node.m_Box ) )
+        {
+            continue;
+        }
+
+        if ( node.m_Child[0] < 0 )
+        {
+            for ( int i = node.m_BeginInd ; i < node.m_EndInd ; i++ )
+            {
+                if ( Compare( box, m_BoxVec[ m_IdVec[i] ] ) )
+                {
+                    id_vec.push_back( m_IdVec[i] );
+                }
+            }
+        }
+        else
+        {
+            stack.push_back( node.m_Child[0] );
+            stack.push_back( node.m_Child[1] );
+        }
+    }
+}
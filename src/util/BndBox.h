@@ -64,4 +64,40 @@ protected:
 
 };
 
+//==== Static AABB Tree - Finds Every Box That Compares With A Query Box ====//
+class VSPDLL BndBoxTree
+{
+public:
+
+    BndBoxTree();
+
+    void Build( const std::vector< BndBox > & box_vec );
+    void Clear();
+
+    // Indices of boxes for which Compare( box, box_vec[i] ) is true, in no particular order
+    void Intersect( const BndBox & box, std::vector< int > & id_vec ) const;
+
+    int GetNumNodes() const
+    {
+        return ( int )m_NodeVec.size();
+    }
+
+protected:
+
+    struct Node
+    {
+        BndBox m_Box;
+        int m_Child[2];                 // -1 For Leaves
+        int m_BeginInd;                 // Range In m_IdVec
+        int m_EndInd;
+    };
+
+    int BuildNode( int begin_ind, int end_ind );
+
+    std::vector< Node > m_NodeVec;
+    std::vector< int > m_IdVec;
+    std::vector< BndBox > m_BoxVec;
+
+};
+
 #endif
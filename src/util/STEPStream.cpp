@@ -0,0 +1,316 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+
+#include "STEPStream.h"
+#include "VspSurf.h"
+
+static string Ref( int id )
+{
+    return "#" + std::to_string( id );
+}
+
+STEPStreamWriter::STEPStreamWriter( const int & len, const double & tol )
+{
+    m_LenUnit = len;
+    m_Tol = tol;
+
+    m_File = NULL;
+
+    // Entities start at #1.
+    m_NextID = 1;
+
+    m_ContextID = 0;
+    m_ShapeRepID = 0;
+}
+
+STEPStreamWriter::~STEPStreamWriter()
+{
+    Close();
+}
+
+bool STEPStreamWriter::Open( const string & fname )
+{
+    Close();
+
+    m_File = fopen( fname.c_str(), "w" );
+    if ( !m_File )
+    {
+        return false;
+    }
+
+    // Large stdio buffer, entities are many and short.
+    m_Buffer.resize( 1 << 20 );
+    setvbuf( m_File, &m_Buffer[0], _IOFBF, m_Buffer.size() );
+
+    m_NextID = 1;
+
+    fputs( "ISO-10303-21;\n", m_File );
+    fputs( "HEADER;\n", m_File );
+    fputs( "FILE_DESCRIPTION((''),'1');\n", m_File );
+    fputs( "FILE_NAME('outfile.stp','',(''),(''),'','','');\n", m_File );
+    fputs( "FILE_SCHEMA(('CONFIG_CONTROL_DESIGN'));\n", m_File );
+    fputs( "ENDSEC;\n", m_File );
+    fputs( "DATA;\n", m_File );
+
+    STEPBoilerplate( ( vsp::LEN_UNITS ) m_LenUnit );
+
+    return true;
+}
+
+void STEPStreamWriter::Close()
+{
+    if ( m_File )
+    {
+        fputs( "ENDSEC;\n", m_File );
+        fputs( "END-ISO-10303-21;\n", m_File );
+        fclose( m_File );
+        m_File = NULL;
+    }
+    m_Buffer.clear();
+}
+
+//==== Part 21 Reals Must Contain a Decimal Point ====//
+string STEPStreamWriter::FormatReal( double val )
+{
+    char str[64];
+    snprintf( str, sizeof( str ), "%.15G", val );
+
+    string s( str );
+    if ( s.find( '.' ) == string::npos )
+    {
+        size_t epos = s.find( 'E' );
+        if ( epos == string::npos )
+        {
+            s += ".";
+        }
+        else
+        {
+            s.insert( epos, "." );
+        }
+    }
+    return s;
+}
+
+int STEPStreamWriter::AddEntity( const string & ent )
+{
+    int id = m_NextID;
+    m_NextID++;
+
+    if ( m_File )
+    {
+        fprintf( m_File, "#%d=", id );
+        fputs( ent.c_str(), m_File );
+        fputs( ";\n", m_File );
+    }
+    return id;
+}
+
+int STEPStreamWriter::MakePoint( const double & x, const double & y, const double & z )
+{
+    int id = m_NextID;
+    m_NextID++;
+
+    if ( m_File )
+    {
+        fprintf( m_File, "#%d=CARTESIAN_POINT('',(%s,%s,%s));\n", id,
+                 FormatReal( x ).c_str(), FormatReal( y ).c_str(), FormatReal( z ).c_str() );
+    }
+    return id;
+}
+
+int STEPStreamWriter::GeometricContext( const vsp::LEN_UNITS & len, const vsp::ANG_UNITS & angle )
+{
+    int dimensional_exp = AddEntity( "DIMENSIONAL_EXPONENTS(0.,0.,0.,0.,0.,0.,0.)" );
+
+    // First set up metric units if appropriate.  Default to mm, which is also
+    // used for unitless models.
+    // If imperial units, set up mm to be used as base to define imperial units.
+    string pfx = ".MILLI.";
+    switch( len )
+    {
+    case vsp::LEN_CM:
+        pfx = ".CENTI.";
+        break;
+    case vsp::LEN_M:
+        pfx = "$";
+        break;
+    case vsp::LEN_MM:
+    case vsp::LEN_IN:
+    case vsp::LEN_FT:
+    case vsp::LEN_YD:
+    case vsp::LEN_UNITLESS:
+        break;
+    }
+
+    int ua_length = AddEntity( "(LENGTH_UNIT()NAMED_UNIT(*)SI_UNIT(" + pfx + ",.METRE.))" );
+
+    // If imperial, create conversion based unit.
+    if( len == vsp::LEN_IN || len == vsp::LEN_FT || len == vsp::LEN_YD )
+    {
+        string lenname;
+        double lenconv = 1.0;
+
+        switch( len )
+        {
+        case vsp::LEN_IN:
+            lenname = "'INCH'";
+            lenconv = 25.4;
+            break;
+        case vsp::LEN_FT:
+            lenname = "'FOOT'";
+            lenconv = 25.4 * 12.0;
+            break;
+        case vsp::LEN_YD:
+            lenname = "'YARD'";
+            lenconv = 25.4 * 36.0;
+            break;
+        case vsp::LEN_MM:
+        case vsp::LEN_CM:
+        case vsp::LEN_M:
+        case vsp::LEN_UNITLESS:
+            break;
+        }
+
+        int len_measure_with_unit = AddEntity( "LENGTH_MEASURE_WITH_UNIT(LENGTH_MEASURE(" + FormatReal( lenconv ) + ")," + Ref( ua_length ) + ")" );
+        int dimensional_exp_len = AddEntity( "DIMENSIONAL_EXPONENTS(1.,0.,0.,0.,0.,0.,0.)" );
+
+        ua_length = AddEntity( "(CONVERSION_BASED_UNIT(" + lenname + "," + Ref( len_measure_with_unit ) + ")LENGTH_UNIT()NAMED_UNIT(" + Ref( dimensional_exp_len ) + "))" );
+    }
+
+    int uncertainty = AddEntity( "UNCERTAINTY_MEASURE_WITH_UNIT(LENGTH_MEASURE(" + FormatReal( m_Tol ) + ")," + Ref( ua_length ) +
+                                 ",'closure','Threshold below which geometry imperfections (such as overlaps) are not considered errors.')" );
+
+    // First set up radians as base angle unit.
+    int ua_plane_angle = AddEntity( "(NAMED_UNIT(*)PLANE_ANGLE_UNIT()SI_UNIT($,.RADIAN.))" );
+
+    // If degrees, create conversion based unit.
+    if( angle == vsp::ANG_DEG )
+    {
+        const double angconv = ( 3.14159265358979323846264338327950 / 180.0 );
+
+        int p_ang_measure_with_unit = AddEntity( "PLANE_ANGLE_MEASURE_WITH_UNIT(PLANE_ANGLE_MEASURE(" + FormatReal( angconv ) + ")," + Ref( ua_plane_angle ) + ")" );
+
+        ua_plane_angle = AddEntity( "(CONVERSION_BASED_UNIT('DEGREES'," + Ref( p_ang_measure_with_unit ) + ")NAMED_UNIT(" + Ref( dimensional_exp ) + ")PLANE_ANGLE_UNIT())" );
+    }
+
+    int ua_solid_angle = AddEntity( "(NAMED_UNIT(*)SI_UNIT($,.STERADIAN.)SOLID_ANGLE_UNIT())" );
+
+    // All units set up, stored in: ua_length, ua_plane_angle, ua_solid_angle
+    return AddEntity( "(GEOMETRIC_REPRESENTATION_CONTEXT(3)GLOBAL_UNCERTAINTY_ASSIGNED_CONTEXT((" + Ref( uncertainty ) +
+                      "))GLOBAL_UNIT_ASSIGNED_CONTEXT((" + Ref( ua_length ) + "," + Ref( ua_plane_angle ) + "," + Ref( ua_solid_angle ) +
+                      "))REPRESENTATION_CONTEXT('STANDARD','3D'))" );
+}
+
+int STEPStreamWriter::DefaultAxis()
+{
+    int pnt = MakePoint( 0.0, 0.0, 0.0 );
+    int axis = AddEntity( "DIRECTION('',(0.,0.,1.))" );
+    int refd = AddEntity( "DIRECTION('',(1.,0.,0.))" );
+
+    return AddEntity( "AXIS2_PLACEMENT_3D(''," + Ref( pnt ) + "," + Ref( axis ) + "," + Ref( refd ) + ")" );
+}
+
+int STEPStreamWriter::DateTime()
+{
+    int caldate = AddEntity( "CALENDAR_DATE(2000,1,1)" );
+    int tzone = AddEntity( "COORDINATED_UNIVERSAL_TIME_OFFSET(0,0,.BEHIND.)" );
+    int loctime = AddEntity( "LOCAL_TIME(12,0,0.," + Ref( tzone ) + ")" );
+
+    return AddEntity( "DATE_AND_TIME(" + Ref( caldate ) + "," + Ref( loctime ) + ")" );
+}
+
+int STEPStreamWriter::Classification( int per_org, int date_time, int prod_def_form )
+{
+    int level = AddEntity( "SECURITY_CLASSIFICATION_LEVEL('unclassified')" );
+    int clas = AddEntity( "SECURITY_CLASSIFICATION('',''," + Ref( level ) + ")" );
+    AddEntity( "CC_DESIGN_SECURITY_CLASSIFICATION(" + Ref( clas ) + ",(" + Ref( prod_def_form ) + "))" );
+
+    int class_role = AddEntity( "PERSON_AND_ORGANIZATION_ROLE('classification_officer')" );
+    AddEntity( "CC_DESIGN_PERSON_AND_ORGANIZATION_ASSIGNMENT(" + Ref( per_org ) + "," + Ref( class_role ) + ",(" + Ref( clas ) + "))" );
+
+    int class_datetime = AddEntity( "DATE_TIME_ROLE('classification_date')" );
+    AddEntity( "CC_DESIGN_DATE_AND_TIME_ASSIGNMENT(" + Ref( date_time ) + "," + Ref( class_datetime ) + ",(" + Ref( clas ) + "))" );
+
+    return clas;
+}
+
+void STEPStreamWriter::STEPBoilerplate( const vsp::LEN_UNITS & len )
+{
+    // Entities are written in the same order STEPutil creates them, so no
+    // entity references a later entity.
+
+    // Stand-in date and time.
+    int date_time = DateTime();
+
+    // Global units and tolerance.
+    m_ContextID = GeometricContext( len, vsp::ANG_DEG );
+
+    // Primary coordinate system.
+    int orig_transform = DefaultAxis();
+
+    // Basic context through product and shape representation
+    int app_context = AddEntity( "APPLICATION_CONTEXT('configuration controlled 3d designs of mechanical parts and assemblies')" );
+    int mech_context = AddEntity( "MECHANICAL_CONTEXT(''," + Ref( app_context ) + ",'mechanical')" );
+    AddEntity( "APPLICATION_PROTOCOL_DEFINITION('international standard','config_control_design',1994," + Ref( app_context ) + ")" );
+    int design_context = AddEntity( "DESIGN_CONTEXT(''," + Ref( app_context ) + ",'design')" );
+
+    int prod = AddEntity( "PRODUCT('','prodname','',(" + Ref( mech_context ) + "))" );
+    AddEntity( "PRODUCT_RELATED_PRODUCT_CATEGORY('assembly','',(" + Ref( prod ) + "))" );
+    int prod_def_form = AddEntity( "PRODUCT_DEFINITION_FORMATION_WITH_SPECIFIED_SOURCE('',''," + Ref( prod ) + ",.MADE.)" );
+    int prod_def = AddEntity( "PRODUCT_DEFINITION('',''," + Ref( prod_def_form ) + "," + Ref( design_context ) + ")" );
+    int pshape = AddEntity( "PRODUCT_DEFINITION_SHAPE('','ProductShapeDescription'," + Ref( prod_def ) + ")" );
+
+    m_ShapeRepID = AddEntity( "SHAPE_REPRESENTATION('',(" + Ref( orig_transform ) + ")," + Ref( m_ContextID ) + ")" );
+    AddEntity( "SHAPE_DEFINITION_REPRESENTATION(" + Ref( pshape ) + "," + Ref( m_ShapeRepID ) + ")" );
+
+    // Stand-in person and org.
+    int person = AddEntity( "PERSON('','Doe','John',$,$,$)" );
+    int org = AddEntity( "ORGANIZATION('','','')" );
+    int per_org = AddEntity( "PERSON_AND_ORGANIZATION(" + Ref( person ) + "," + Ref( org ) + ")" );
+
+    // Required roles.
+    int creator_role = AddEntity( "PERSON_AND_ORGANIZATION_ROLE('creator')" );
+    int owner_role = AddEntity( "PERSON_AND_ORGANIZATION_ROLE('design_owner')" );
+    int supplier_role = AddEntity( "PERSON_AND_ORGANIZATION_ROLE('design_supplier')" );
+
+    // Basic approval.
+    int approval_status = AddEntity( "APPROVAL_STATUS('approved')" );
+    int approval = AddEntity( "APPROVAL(" + Ref( approval_status ) + ",'')" );
+    AddEntity( "APPROVAL_DATE_TIME(" + Ref( date_time ) + "," + Ref( approval ) + ")" );
+    int app_role = AddEntity( "APPROVAL_ROLE('approver')" );
+    AddEntity( "APPROVAL_PERSON_ORGANIZATION(" + Ref( per_org ) + "," + Ref( approval ) + "," + Ref( app_role ) + ")" );
+
+    // Basic Classification.
+    int clas = Classification( per_org, date_time, prod_def_form );
+
+    // Basic CC approval.
+    AddEntity( "CC_DESIGN_APPROVAL(" + Ref( approval ) + ",(" + Ref( prod_def ) + "," + Ref( prod_def_form ) + "," + Ref( clas ) + "))" );
+    AddEntity( "CC_DESIGN_PERSON_AND_ORGANIZATION_ASSIGNMENT(" + Ref( per_org ) + "," + Ref( creator_role ) + ",(" + Ref( prod_def ) + "," + Ref( prod_def_form ) + "))" );
+    AddEntity( "CC_DESIGN_PERSON_AND_ORGANIZATION_ASSIGNMENT(" + Ref( per_org ) + "," + Ref( supplier_role ) + ",(" + Ref( prod_def_form ) + "))" );
+
+    int datetimerole = AddEntity( "DATE_TIME_ROLE('creation_date')" );
+    AddEntity( "CC_DESIGN_DATE_AND_TIME_ASSIGNMENT(" + Ref( date_time ) + "," + Ref( datetimerole ) + ",(" + Ref( prod_def ) + "))" );
+    AddEntity( "CC_DESIGN_PERSON_AND_ORGANIZATION_ASSIGNMENT(" + Ref( per_org ) + "," + Ref( owner_role ) + ",(" + Ref( prod ) + "))" );
+}
+
+void STEPStreamWriter::AddSurf( VspSurf *s, bool splitsurf, bool mergepts, bool tocubic, double tol )
+{
+    vector< int > surfs;
+    s->ToSTEP_BSpline_Quilt( this, surfs, splitsurf, mergepts, tocubic, tol );
+
+    string elements;
+    for( int i = 0; i < ( int )surfs.size(); ++i )
+    {
+        if ( i > 0 )
+        {
+            elements += ",";
+        }
+        elements += Ref( surfs[i] );
+    }
+
+    int gset = AddEntity( "GEOMETRIC_SET('',(" + elements + "))" );
+    int gbshape = AddEntity( "GEOMETRICALLY_BOUNDED_SURFACE_SHAPE_REPRESENTATION('',(" + Ref( gset ) + ")," + Ref( m_ContextID ) + ")" );
+    AddEntity( "SHAPE_REPRESENTATION_RELATIONSHIP('',''," + Ref( m_ShapeRepID ) + "," + Ref( gbshape ) + ")" );
+}
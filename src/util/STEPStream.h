@@ -0,0 +1,72 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+
+// STEPStream.h: Part 21 writer that streams entities straight to disk.
+//
+// Writes the same product structure as STEPutil without building the
+// SDAI instance graph.  Entity ids come from a running counter and each
+// entity is written as soon as it is made, so memory use does not grow
+// with the size of the model.
+//
+//////////////////////////////////////////////////////////////////////
+
+#if !defined(STEPSTREAM__INCLUDED_)
+#define STEPSTREAM__INCLUDED_
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "APIDefines.h"
+
+using std::string;
+using std::vector;
+
+class VspSurf;
+
+class STEPStreamWriter
+{
+
+public:
+    STEPStreamWriter( const int & len, const double & tol );
+    virtual ~STEPStreamWriter();
+
+    bool Open( const string & fname );
+    void Close();
+
+    int MakePoint( const double & x, const double & y, const double & z );
+    int AddEntity( const string & ent );
+    void AddSurf( VspSurf *s, bool splitsurf, bool mergepts, bool tocubic, double tol );
+
+    int GetNumEntities() const
+    {
+        return m_NextID - 1;
+    }
+
+    static string FormatReal( double val );
+
+protected:
+
+    int m_LenUnit;
+    double m_Tol;
+
+    FILE * m_File;
+    vector< char > m_Buffer;
+
+    int m_NextID;
+
+    int m_ContextID;
+    int m_ShapeRepID;
+
+    int GeometricContext( const vsp::LEN_UNITS & len, const vsp::ANG_UNITS & angle );
+    int DefaultAxis();
+    int DateTime();
+    int Classification( int per_org, int date_time, int prod_def_form );
+
+    void STEPBoilerplate( const vsp::LEN_UNITS & len );
+
+};
+
+#endif // !defined(STEPSTREAM__INCLUDED_)
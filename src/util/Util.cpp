@@ -6,23 +6,24 @@
 #include "Util.h"
 #include <math.h>
 #include <time.h>
+#include <mutex>
+#include <random>
 
-//==== Generate A Unique Random String of Length =====//
+//==== Generate A Unique Random String of Length - Safe To Call From Any Thread =====//
 string GenerateRandomID( int length )
 {
-    static bool seed = false;
-    if ( !seed )
-    {
-        seed = true;
-        srand( ( unsigned int )time( NULL ) );
-    }
+    static std::mutex id_mutex;
+    static std::mt19937 id_gen( ( unsigned int )time( NULL ) ^ std::random_device()() );
+    static std::uniform_int_distribution< int > id_dist( 0, 25 );
+
+    string id( length, 'A' );
 
-    static char str[256];
+    std::lock_guard< std::mutex > lock( id_mutex );
     for ( int i = 0 ; i < length ; i++ )
     {
-        str[i] = ( char )( ( rand() % 26 ) + 65 );
+        id[i] = ( char )( id_dist( id_gen ) + 65 );
     }
-    return string( str, length );
+    return id;
 }
 
 //==== Convert A Double To Bool ====//
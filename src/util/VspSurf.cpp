@@ -42,6 +42,13 @@ double Cluster( const double &t, const double &a, const double &b )
 }
 
 //===== Constructor  =====//
+std::atomic< long long > VspSurf::m_NextRevision( 0 );
+std::atomic< long long > VspSurf::m_TessCacheHits( 0 );
+std::atomic< long long > VspSurf::m_TessCacheMisses( 0 );
+
+// Number of distinct tesselations kept per surface, covers plain and degen grids from one update
+static const int NUM_TESS_CACHE = 4;
+
 VspSurf::VspSurf()
 {
     m_FlipNormal = false;
@@ -49,6 +56,8 @@ VspSurf::VspSurf()
     m_SurfType = vsp::NORMAL_SURF;
     m_SurfCfdType = vsp::CFD_NORMAL;
 
+    m_Revision = ++m_NextRevision;
+
     SetClustering( 1.0, 1.0 );
 }
 
@@ -57,6 +66,14 @@ VspSurf::~VspSurf()
 {
 }
 
+//==== New Revision From Global Counter So Copies Never Collide ====//
+void VspSurf::BumpRevision()
+{
+    m_Revision = ++m_NextRevision;
+    m_TessCache.clear();
+    m_SplitTessCache.clear();
+}
+
 void VspSurf::SetClustering( const double &le, const double &te )
 {
     m_LECluster = le;
@@ -92,17 +109,20 @@ double VspSurf::GetWMax() const
 void VspSurf::ReverseUDirection()
 {
     m_Surface.reverse_u();
+    BumpRevision();
 }
 
 void VspSurf::ReverseWDirection()
 {
     m_Surface.reverse_v();
+    BumpRevision();
 }
 
 //==== Flip U/W Directions =====//
 void VspSurf::SwapUWDirections()
 {
     m_Surface.swap_uv();
+    BumpRevision();
 }
 
 //==== Transform Control Points =====//
@@ -119,6 +139,7 @@ void VspSurf::Transform( Matrix4d & mat )
 
     m_Surface.rotate( rmat );
     m_Surface.translate( trans );
+    BumpRevision();
 }
 
 void VspSurf::GetBoundingBox( BndBox &bb ) const
@@ -593,6 +614,75 @@ vec3d VspSurf::CompNorm01( double u01, double v01 ) const
     return CompNorm( u01 * GetUMax(), v01 * GetWMax() );
 }
 
+//===== Compute Principal, Mean And Gaussian Curvature - Sign Follows CompNorm =====//
+void VspSurf::CompCurvature( double u, double w, double& k1, double& k2, double& ka, double& kg ) const
+{
+    vec3d S_u = CompTanU( u, w );
+    vec3d S_w = CompTanW( u, w );
+    vec3d S_uu = CompTanUU( u, w );
+    vec3d S_uw = CompTanUW( u, w );
+    vec3d S_ww = CompTanWW( u, w );
+    vec3d n = CompNorm( u, w );
+
+    //==== First And Second Fundamental Forms ====//
+    double E = dot( S_u, S_u );
+    double F = dot( S_u, S_w );
+    double G = dot( S_w, S_w );
+    double L = dot( n, S_uu );
+    double M = dot( n, S_uw );
+    double N = dot( n, S_ww );
+
+    double det = E * G - F * F;
+    if ( det <= 0.0 )
+    {
+        k1 = k2 = ka = kg = 0.0;        // Degenerate - Collapsed Edge Or Pole
+        return;
+    }
+
+    ka = ( E * N - 2.0 * F * M + G * L ) / ( 2.0 * det );
+    kg = ( L * N - M * M ) / det;
+
+    double disc = ka * ka - kg;
+    if ( disc < 0.0 )
+    {
+        disc = 0.0;
+    }
+    disc = sqrt( disc );
+
+    k1 = ka + disc;
+    k2 = ka - disc;
+}
+
+//===== Build Cached Derivative Patches Up To Third Order, Used By Normal Fallback =====//
+void VspSurf::ValidateDerivs() const
+{
+    surface_index_type nupatch = m_Surface.number_u_patches();
+    surface_index_type nvpatch = m_Surface.number_v_patches();
+
+    for ( surface_index_type ip = 0; ip < nupatch; ip++ )
+    {
+        for ( surface_index_type jp = 0; jp < nvpatch; jp++ )
+        {
+            const surface_patch_type* patch = m_Surface.get_patch( ip, jp );
+            // Each derivative primes its own chain and skips it when the degree is too low
+            patch->f_u( 0, 0 );
+            patch->f_v( 0, 0 );
+            patch->f_uu( 0, 0 );
+            patch->f_uv( 0, 0 );
+            patch->f_vv( 0, 0 );
+            patch->f_uuu( 0, 0 );
+            patch->f_uuv( 0, 0 );
+            patch->f_uvv( 0, 0 );
+            patch->f_vvv( 0, 0 );
+        }
+    }
+}
+
+void VspSurf::CompCurvature01( double u01, double w01, double& k1, double& k2, double& ka, double& kg ) const
+{
+    CompCurvature( u01 * GetUMax(), w01 * GetWMax(), k1, k2, ka, kg );
+}
+
 void VspSurf::ResetUWSkip()
 {
     piecewise_surface_type::index_type ip, jp, nupatch, nwpatch;
@@ -973,14 +1063,275 @@ void VspSurf::SplitTesselate( const vector<int> &num_u, int num_v, std::vector<
     SplitTesselate( m_UFeature, m_WFeature, u, v, pnts, norms );
 }
 
+//==== Bernstein Basis And First Derivative Of Degree n At t ====//
+static void BernsteinBasis( int n, double t, double* b, double* db )
+{
+    double mt = 1.0 - t;
+
+    // Build degree n - 1 basis in place by repeated elevation
+    b[0] = 1.0;
+    for ( int d = 1; d < n; d++ )
+    {
+        double save = 0.0;
+        for ( int k = 0; k < d; k++ )
+        {
+            double tmp = b[k];
+            b[k] = save + mt * tmp;
+            save = t * tmp;
+        }
+        b[d] = save;
+    }
+
+    // Derivative from degree n - 1 basis
+    if ( n == 0 )
+    {
+        db[0] = 0.0;
+        return;
+    }
+    db[0] = -n * b[0];
+    for ( int k = 1; k < n; k++ )
+    {
+        db[k] = n * ( b[k - 1] - b[k] );
+    }
+    db[n] = n * b[n - 1];
+
+    // Final elevation to degree n
+    double save = 0.0;
+    for ( int k = 0; k < n; k++ )
+    {
+        double tmp = b[k];
+        b[k] = save + mt * tmp;
+        save = t * tmp;
+    }
+    b[n] = save;
+}
+
+//==== Assign Tess Parameters To Patches, Matching piecewise::f_pt_normal_grid ====//
+static void BinTessParms( const vector<double> &t, const vector<double> &tstart, const vector<double> &dt, vector< vector<int> > &bin, vector<double> &tloc )
+{
+    int npatch = tstart.size();
+    int nt = t.size();
+
+    tloc.resize( nt );
+    for ( int i = 0; i < nt; i++ )
+    {
+        int k = ( int )( std::upper_bound( tstart.begin(), tstart.end(), t[i] ) - tstart.begin() ) - 1;
+        k = Clamp( k, 0, npatch - 1 );
+
+        // Last parameter on a patch boundary belongs to the patch it closes
+        if ( i == nt - 1 && k > 0 && t[i] == tstart[k] )
+        {
+            k--;
+        }
+
+        tloc[i] = Clamp( ( t[i] - tstart[k] ) / dt[k], 0.0, 1.0 );
+        bin[k].push_back( i );
+    }
+}
+
+//==== Evaluate Points And Normals Patch By Patch Into Flat Buffers ====//
+void VspSurf::TesselateGrid( const vector<double> &u, const vector<double> &v, vector<double> & pnts, vector<double> & norms ) const
+{
+    int nu = u.size();
+    int nv = v.size();
+
+    pnts.assign( 3 * nu * nv, 0.0 );
+    norms.assign( 3 * nu * nv, 0.0 );
+
+    int nupatch = m_Surface.number_u_patches();
+    int nvpatch = m_Surface.number_v_patches();
+
+    if ( nupatch == 0 || nvpatch == 0 )
+    {
+        return;
+    }
+
+    vector < double > ustart( nupatch ), du( nupatch ), vstart( nvpatch ), dv( nvpatch );
+    vector < const surface_patch_type* > patches( nupatch * nvpatch );
+    for ( int ip = 0; ip < nupatch; ip++ )
+    {
+        for ( int jp = 0; jp < nvpatch; jp++ )
+        {
+            patches[ ip * nvpatch + jp ] = m_Surface.get_patch( ip, jp, ustart[ip], du[ip], vstart[jp], dv[jp] );
+        }
+    }
+
+    vector < vector < int > > ubin( nupatch ), vbin( nvpatch );
+    vector < double > uloc, vloc;
+    BinTessParms( u, ustart, du, ubin, uloc );
+    BinTessParms( v, vstart, dv, vbin, vloc );
+
+    // Each patch is visited by one thread only, so the lazily built derivative
+    // patches used by the degenerate normal fallback are never shared.
+    #pragma omp parallel for schedule( dynamic )
+    for ( int ip = 0; ip < nupatch; ip++ )
+    {
+        int nus = ubin[ip].size();
+        if ( nus == 0 )
+        {
+            continue;
+        }
+
+        surface_tolerance_type tol;
+        vector < double > cp, bu, dbu, bv, dbv, q, qv;
+
+        for ( int jp = 0; jp < nvpatch; jp++ )
+        {
+            if ( vbin[jp].empty() )
+            {
+                continue;
+            }
+
+            const surface_patch_type* patch = patches[ ip * nvpatch + jp ];
+            int n = patch->degree_u();
+            int m = patch->degree_v();
+
+            //==== Flatten Control Net ====//
+            cp.resize( 3 * ( n + 1 ) * ( m + 1 ) );
+            for ( int a = 0; a <= n; a++ )
+            {
+                for ( int b = 0; b <= m; b++ )
+                {
+                    surface_point_type p = patch->get_control_point( a, b );
+                    double* c = &cp[ 3 * ( a * ( m + 1 ) + b ) ];
+                    c[0] = p.x();
+                    c[1] = p.y();
+                    c[2] = p.z();
+                }
+            }
+
+            //==== U Basis For Every Sample On This Patch ====//
+            bu.resize( nus * ( n + 1 ) );
+            dbu.resize( nus * ( n + 1 ) );
+            for ( int s = 0; s < nus; s++ )
+            {
+                BernsteinBasis( n, uloc[ ubin[ip][s] ], &bu[ s * ( n + 1 ) ], &dbu[ s * ( n + 1 ) ] );
+            }
+
+            bv.resize( m + 1 );
+            dbv.resize( m + 1 );
+            q.resize( 3 * ( n + 1 ) );
+            qv.resize( 3 * ( n + 1 ) );
+
+            for ( int jj = 0; jj < ( int )vbin[jp].size(); jj++ )
+            {
+                int j = vbin[jp][jj];
+                BernsteinBasis( m, vloc[j], &bv[0], &dbv[0] );
+
+                //==== Contract Control Net Along V For This Row ====//
+                for ( int a = 0; a <= n; a++ )
+                {
+                    double qa[3] = { 0.0, 0.0, 0.0 };
+                    double qva[3] = { 0.0, 0.0, 0.0 };
+                    for ( int b = 0; b <= m; b++ )
+                    {
+                        const double* c = &cp[ 3 * ( a * ( m + 1 ) + b ) ];
+                        for ( int k = 0; k < 3; k++ )
+                        {
+                            qa[k] += bv[b] * c[k];
+                            qva[k] += dbv[b] * c[k];
+                        }
+                    }
+                    for ( int k = 0; k < 3; k++ )
+                    {
+                        q[ 3 * a + k ] = qa[k];
+                        qv[ 3 * a + k ] = qva[k];
+                    }
+                }
+
+                //==== Sweep All U Samples Of The Row ====//
+                for ( int s = 0; s < nus; s++ )
+                {
+                    const double* b = &bu[ s * ( n + 1 ) ];
+                    const double* db = &dbu[ s * ( n + 1 ) ];
+
+                    double S[3] = { 0.0, 0.0, 0.0 };
+                    double Su[3] = { 0.0, 0.0, 0.0 };
+                    double Sv[3] = { 0.0, 0.0, 0.0 };
+                    for ( int a = 0; a <= n; a++ )
+                    {
+                        for ( int k = 0; k < 3; k++ )
+                        {
+                            S[k] += b[a] * q[ 3 * a + k ];
+                            Su[k] += db[a] * q[ 3 * a + k ];
+                            Sv[k] += b[a] * qv[ 3 * a + k ];
+                        }
+                    }
+
+                    int i = ubin[ip][s];
+                    double* p = &pnts[ 3 * ( i * nv + j ) ];
+                    double* nrm = &norms[ 3 * ( i * nv + j ) ];
+
+                    p[0] = S[0];
+                    p[1] = S[1];
+                    p[2] = S[2];
+
+                    nrm[0] = Su[1] * Sv[2] - Su[2] * Sv[1];
+                    nrm[1] = Su[2] * Sv[0] - Su[0] * Sv[2];
+                    nrm[2] = Su[0] * Sv[1] - Su[1] * Sv[0];
+
+                    double len = sqrt( nrm[0] * nrm[0] + nrm[1] * nrm[1] + nrm[2] * nrm[2] );
+                    if ( tol.approximately_equal( len, 0 ) )
+                    {
+                        // Collapsed edge - higher order expansion from the patch itself
+                        surface_point_type pn = patch->normal( uloc[i], vloc[j] );
+                        nrm[0] = pn.x();
+                        nrm[1] = pn.y();
+                        nrm[2] = pn.z();
+                    }
+                    else
+                    {
+                        nrm[0] /= len;
+                        nrm[1] /= len;
+                        nrm[2] /= len;
+                    }
+                }
+            }
+        }
+    }
+}
+
+//==== Return Cached Tesselation When Built From The Same Parameters Since Last Revision ====//
 void VspSurf::Tesselate( const vector<double> &u, const vector<double> &v, std::vector< vector< vec3d > > & pnts,  std::vector< vector< vec3d > > & norms,  std::vector< vector< vec3d > > & uw_pnts ) const
+{
+    for ( int i = 0; i < ( int )m_TessCache.size(); i++ )
+    {
+        if ( m_TessCache[i].m_U == u && m_TessCache[i].m_V == v )
+        {
+            const VspSurfTessCacheEntry & entry = m_TessCache[i];
+            pnts = entry.m_Pnts;
+            norms = entry.m_Norms;
+            uw_pnts = entry.m_UWPnts;
+            m_TessCacheHits++;
+            return;
+        }
+    }
+
+    m_TessCacheMisses++;
+    EvalTesselate( u, v, pnts, norms, uw_pnts );
+
+    VspSurfTessCacheEntry entry;
+    entry.m_U = u;
+    entry.m_V = v;
+    entry.m_Pnts = pnts;
+    entry.m_Norms = norms;
+    entry.m_UWPnts = uw_pnts;
+
+    m_TessCache.insert( m_TessCache.begin(), entry );
+    if ( ( int )m_TessCache.size() > NUM_TESS_CACHE )
+    {
+        m_TessCache.pop_back();
+    }
+}
+
+void VspSurf::EvalTesselate( const vector<double> &u, const vector<double> &v, std::vector< vector< vec3d > > & pnts,  std::vector< vector< vec3d > > & norms,  std::vector< vector< vec3d > > & uw_pnts ) const
 {
     int nu = u.size();
     int nv = v.size();
 
-    vector < vector < surface_point_type > > ptmat, nmat;
+    vector < double > pbuf, nbuf;
 
-    m_Surface.f_pt_normal_grid( u, v, ptmat, nmat);
+    TesselateGrid( u, v, pbuf, nbuf );
 
     // resize pnts and norms
     pnts.resize( nu );
@@ -994,9 +1345,12 @@ void VspSurf::Tesselate( const vector<double> &u, const vector<double> &v, std::
 
         for ( surface_index_type j = 0; j < nv; j++ )
         {
-            pnts[i][j] = ptmat[i][j];
+            const double* p = &pbuf[ 3 * ( i * nv + j ) ];
+            const double* n = &nbuf[ 3 * ( i * nv + j ) ];
+
+            pnts[i][j].set_xyz( p[0], p[1], p[2] );
 
-            vec3d norm = nmat[i][j];
+            vec3d norm( n[0], n[1], n[2] );
             if ( norm.mag() < 1e-6 ) // Zero normal vector
             {
                 double tmax = GetWMax();
@@ -1034,6 +1388,38 @@ void VspSurf::Tesselate( const vector<double> &u, const vector<double> &v, std::
 }
 
 void VspSurf::SplitTesselate( const vector<double> &usplit, const vector<double> &vsplit, const vector<double> &u, const vector<double> &v, std::vector< vector< vector< vec3d > > > & pnts,  std::vector< vector< vector< vec3d > > > & norms ) const
+{
+    for ( int i = 0; i < ( int )m_SplitTessCache.size(); i++ )
+    {
+        const VspSurfTessCacheEntry & entry = m_SplitTessCache[i];
+        if ( entry.m_U == u && entry.m_V == v && entry.m_USplit == usplit && entry.m_VSplit == vsplit )
+        {
+            pnts = entry.m_SplitPnts;
+            norms = entry.m_SplitNorms;
+            m_TessCacheHits++;
+            return;
+        }
+    }
+
+    m_TessCacheMisses++;
+    EvalSplitTesselate( usplit, vsplit, u, v, pnts, norms );
+
+    VspSurfTessCacheEntry entry;
+    entry.m_USplit = usplit;
+    entry.m_VSplit = vsplit;
+    entry.m_U = u;
+    entry.m_V = v;
+    entry.m_SplitPnts = pnts;
+    entry.m_SplitNorms = norms;
+
+    m_SplitTessCache.insert( m_SplitTessCache.begin(), entry );
+    if ( ( int )m_SplitTessCache.size() > NUM_TESS_CACHE )
+    {
+        m_SplitTessCache.pop_back();
+    }
+}
+
+void VspSurf::EvalSplitTesselate( const vector<double> &usplit, const vector<double> &vsplit, const vector<double> &u, const vector<double> &v, std::vector< vector< vector< vec3d > > > & pnts,  std::vector< vector< vector< vec3d > > > & norms ) const
 {
     vector < int > iusplit;
     iusplit.resize( usplit.size() );
@@ -1100,7 +1486,7 @@ void VspSurf::SplitTesselate( const vector<double> &usplit, const vector<double>
         {
             vector < double > vsubs( v.begin() + ivsplit[j], v.begin() + ivsplit[j+1] + 1 );
 
-            Tesselate( usubs, vsubs, pnts[k], norms[k], uw_pnts );
+            EvalTesselate( usubs, vsubs, pnts[k], norms[k], uw_pnts );
             k++;
         }
     }
@@ -1271,6 +1657,8 @@ void VspSurf::BuildFeatureLines()
 
 bool VspSurf::CapUMin(int CapType, double len, double str, double offset, bool swflag)
 {
+    BumpRevision();
+
     if (CapType == vsp::NO_END_CAP)
     {
         ResetUWSkip();
@@ -1319,6 +1707,8 @@ bool VspSurf::CapUMin(int CapType, double len, double str, double offset, bool s
 
 bool VspSurf::CapUMax(int CapType, double len, double str, double offset, bool swflag)
 {
+    BumpRevision();
+
     if (CapType == vsp::NO_END_CAP)
     {
       ResetUWSkip();
@@ -1577,7 +1967,8 @@ void VspSurf::ExtractCPts( piecewise_surface_type &s, vector< vector< int > > &p
 }
 
 
-void VspSurf::ToSTEP_BSpline_Quilt( STEPutil * step, vector<SdaiB_spline_surface_with_knots *> &surfs, bool splitsurf, bool mergepts, bool tocubic, double tol )
+//==== Surfaces To Write As STEP B-Spline Quilts, Shared By Both STEP Writers ====//
+void VspSurf::PrepSTEPSurfs( vector< piecewise_surface_type > &surfvec, bool splitsurf, bool tocubic, double tol )
 {
     // Make copy for local changes.
     piecewise_surface_type s( m_Surface );
@@ -1593,25 +1984,35 @@ void VspSurf::ToSTEP_BSpline_Quilt( STEPutil * step, vector<SdaiB_spline_surface
         s.to_cubic_v( tol );
     }
 
-    vector < piecewise_surface_type > surfvec;
+    surfvec.clear();
     if ( splitsurf )
     {
-        SplitSurfs( s, surfvec );
+        vector < piecewise_surface_type > splitvec;
+        SplitSurfs( s, splitvec );
+
+        for ( int isurf = 0; isurf < splitvec.size(); isurf++ )
+        {
+            // Don't export degenerate split patches
+            if ( CheckValidPatch( splitvec[isurf] ) )
+            {
+                surfvec.push_back( splitvec[isurf] );
+            }
+        }
     }
     else
     {
         surfvec.push_back( s );
     }
+}
+
+void VspSurf::ToSTEP_BSpline_Quilt( STEPutil * step, vector<SdaiB_spline_surface_with_knots *> &surfs, bool splitsurf, bool mergepts, bool tocubic, double tol )
+{
+    vector < piecewise_surface_type > surfvec;
+    PrepSTEPSurfs( surfvec, splitsurf, tocubic, tol );
 
     for ( int isurf = 0; isurf < surfvec.size(); isurf++ )
     {
-        s = surfvec[isurf];
-
-        // Don't export degenerate split patches
-        if ( splitsurf && !CheckValidPatch( s ) )
-        {
-            continue;
-        }
+        piecewise_surface_type s = surfvec[isurf];
 
         piecewise_surface_type::index_type ip, jp;
         piecewise_surface_type::index_type nupatch, nvpatch;
@@ -1738,6 +2139,127 @@ void VspSurf::ToSTEP_BSpline_Quilt( STEPutil * step, vector<SdaiB_spline_surface
     }
 }
 
+void VspSurf::ToSTEP_BSpline_Quilt( STEPStreamWriter * step, vector< int > &surfs, bool splitsurf, bool mergepts, bool tocubic, double tol )
+{
+    vector < piecewise_surface_type > surfvec;
+    PrepSTEPSurfs( surfvec, splitsurf, tocubic, tol );
+
+    for ( int isurf = 0; isurf < surfvec.size(); isurf++ )
+    {
+        piecewise_surface_type s = surfvec[isurf];
+
+        piecewise_surface_type::index_type ip, jp;
+        piecewise_surface_type::index_type nupatch, nvpatch;
+        piecewise_surface_type::index_type maxu, maxv;
+        piecewise_surface_type::index_type nupts, nvpts;
+
+        vector< vector< int > > ptindxs;
+        vector< vec3d > allPntVec;
+
+        ExtractCPts( s, ptindxs, allPntVec, maxu, maxv, nupatch, nvpatch, nupts, nvpts );
+
+        PntNodeCloud pnCloud;
+        vector < int > usedPts;
+
+        // Points are written before the surface that references them, same
+        // as the SDAI writer.
+        if ( mergepts )
+        {
+            //==== Build Map ====//
+            pnCloud.AddPntNodes( allPntVec );
+
+            //==== Use NanoFlann to Find Close Points and Group ====//
+            IndexPntNodes( pnCloud, 1e-6 );
+
+            //==== Write Used Points ====//
+            for ( int i = 0 ; i < ( int )allPntVec.size() ; i++ )
+            {
+                if ( pnCloud.UsedNode( i ) )
+                {
+                    vec3d p = allPntVec[i];
+                    usedPts.push_back( step->MakePoint( p.x(), p.y(), p.z() ) );
+                }
+            }
+        }
+        else
+        {
+            for ( int i = 0 ; i < ( int )allPntVec.size() ; i++ )
+            {
+                vec3d p = allPntVec[i];
+                usedPts.push_back( step->MakePoint( p.x(), p.y(), p.z() ) );
+            }
+        }
+
+        std::ostringstream ss;
+        ss << "B_SPLINE_SURFACE_WITH_KNOTS(''," << maxu << "," << maxv << ",(";
+
+        for( int i = 0; i < nupts; ++i )
+        {
+            ss << "(";
+            for( int j = 0; j < nvpts; j++ )
+            {
+                int pindx = ptindxs[i][j];
+
+                if ( mergepts )
+                {
+                    ss << "#" << usedPts[ pnCloud.GetNodeUsedIndex( pindx ) ];
+                }
+                else
+                {
+                    ss << "#" << usedPts[ pindx ];
+                }
+
+                if( j < nvpts - 1 )
+                {
+                    ss << ",";
+                }
+            }
+            ss << ")";
+
+            if( i < nupts - 1 )
+            {
+                ss << ",";
+            }
+        }
+
+        ss << "),.UNSPECIFIED.,";
+        ss << ( s.closed_u() ? ".T.," : ".F.," );
+        ss << ( s.closed_v() ? ".T.," : ".F.," );
+        ss << ".F.,";
+
+        // Multiplicities, then knots, for piecewise Bezier knot vectors.
+        ss << "(" << maxu + 1;
+        for( ip = 1; ip < nupatch; ++ip )
+        {
+            ss << "," << maxu;
+        }
+        ss << "," << maxu + 1 << "),";
+
+        ss << "(" << maxv + 1;
+        for( jp = 1; jp < nvpatch; ++jp )
+        {
+            ss << "," << maxv;
+        }
+        ss << "," << maxv + 1 << "),";
+
+        ss << "(0.";
+        for( ip = 1; ip <= nupatch; ++ip )
+        {
+            ss << "," << STEPStreamWriter::FormatReal( ip );
+        }
+        ss << "),";
+
+        ss << "(0.";
+        for( jp = 1; jp <= nvpatch; ++jp )
+        {
+            ss << "," << STEPStreamWriter::FormatReal( jp );
+        }
+        ss << "),.PIECEWISE_BEZIER_KNOTS.)";
+
+        surfs.push_back( step->AddEntity( ss.str() ) );
+    }
+}
+
 void VspSurf::ToSTEP_Bez_Patches( STEPutil * step, vector<SdaiBezier_surface *> &surfs )
 {
     piecewise_surface_type::index_type ip, jp, nupatch, nvpatch;
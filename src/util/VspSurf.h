@@ -18,6 +18,7 @@
 #include "XferSurf.h"
 
 #include "STEPutil.h"
+#include "STEPStream.h"
 
 #include <api/dll_iges.h>
 #include <api/dll_entity128.h>
@@ -39,10 +40,27 @@ typedef eli::geom::surface::connection_data<double, 3, surface_tolerance_type> r
 
 #include <vector>
 #include <string>
+#include <atomic>
 using std::vector;
 
 double Cluster( const double &t, const double &a, const double &b );
 
+//==== One Cached Tesselation, Keyed By The Parameter Vectors It Was Built From ====//
+struct VspSurfTessCacheEntry
+{
+    vector < double > m_USplit;
+    vector < double > m_VSplit;
+    vector < double > m_U;
+    vector < double > m_V;
+
+    vector< vector< vec3d > > m_Pnts;
+    vector< vector< vec3d > > m_Norms;
+    vector< vector< vec3d > > m_UWPnts;
+
+    vector< vector< vector< vec3d > > > m_SplitPnts;
+    vector< vector< vector< vec3d > > > m_SplitNorms;
+};
+
 class VspSurf
 {
 public:
@@ -79,8 +97,17 @@ public:
     bool IsClosedW() const;
 
     bool GetFlipNormal() { return m_FlipNormal; }
-    void FlipNormal() { m_FlipNormal = !m_FlipNormal; }
-    void ResetFlipNormal( ) { m_FlipNormal = false; }
+    void FlipNormal() { m_FlipNormal = !m_FlipNormal; BumpRevision(); }
+    void ResetFlipNormal( ) { m_FlipNormal = false; BumpRevision(); }
+
+    // Revision changes whenever the surface may have changed and drops cached tesselations
+    long long GetRevision() const { return m_Revision; }
+    void BumpRevision();
+
+    // Tesselation cache counters, shared by all surfaces
+    static long long GetTessCacheHits() { return m_TessCacheHits; }
+    static long long GetTessCacheMisses() { return m_TessCacheMisses; }
+    static void ResetTessCacheCounters() { m_TessCacheHits = 0; m_TessCacheMisses = 0; }
 
     bool IsMagicVParm() const { return m_MagicVParm; }
     void SetMagicVParm( bool t ) { m_MagicVParm = t; }
@@ -124,6 +151,12 @@ public:
     vec3d CompNorm( double u, double v ) const;
     vec3d CompNorm01( double u, double v ) const;
 
+    void CompCurvature( double u, double w, double& k1, double& k2, double& ka, double& kg ) const;
+    void CompCurvature01( double u, double w, double& k1, double& k2, double& ka, double& kg ) const;
+
+    // Build the lazily cached derivative patches so Comp* may be called from several threads at once
+    void ValidateDerivs() const;
+
     int GetNumUFeature()
     {
         return m_UFeature.size();
@@ -154,6 +187,9 @@ public:
     void Tesselate( int num_u, int num_v, std::vector< vector< vec3d > > & pnts,  std::vector< vector< vec3d > > & norms,  std::vector< vector< vec3d > > & uw_pnts, const int &n_cap, bool degen ) const;
     void Tesselate( const vector<int> &num_u, int num_v, std::vector< vector< vec3d > > & pnts,  std::vector< vector< vec3d > > & norms,  std::vector< vector< vec3d > > & uw_pnts, const int &n_cap, bool degen, const std::vector<int> & umerge = std::vector<int>() ) const;
 
+    // Points and unit normals on a utess x vtess grid, 3 doubles per node at ( i * vtess.size() + j ) * 3
+    void TesselateGrid( const vector<double> &utess, const vector<double> &vtess, vector<double> & pnts, vector<double> & norms ) const;
+
     void SplitTesselate( int num_u, int num_v, std::vector< vector< vector< vec3d > > > & pnts,  std::vector< vector< vector< vec3d > > > & norms, const int &n_cap ) const;
     void SplitTesselate( const vector<int> &num_u, int num_v, std::vector< vector< vector< vec3d > > > & pnts,  std::vector< vector< vector< vec3d > > > & norms, const int &n_cap, const std::vector<int> & umerge = std::vector<int>() ) const;
 
@@ -171,7 +207,9 @@ public:
                       piecewise_surface_type::index_type &nupts, piecewise_surface_type::index_type &nvpts );
 
     void ToSTEP_Bez_Patches( STEPutil * step, vector<SdaiBezier_surface *> &surfs );
+    void PrepSTEPSurfs( vector< piecewise_surface_type > &surfvec, bool splitsurf, bool tocubic, double tol );
     void ToSTEP_BSpline_Quilt( STEPutil * step, vector<SdaiB_spline_surface_with_knots *> &surfs, bool splitsurf, bool mergepts, bool tocubic, double tol );
+    void ToSTEP_BSpline_Quilt( STEPStreamWriter * step, vector< int > &surfs, bool splitsurf, bool mergepts, bool tocubic, double tol );
 
     void ToIGES( DLL_IGES &model, bool splitsurf, bool tocubic, double tol );
 
@@ -188,6 +226,9 @@ protected:
     void Tesselate( const vector<double> &utess, const vector<double> &vtess, std::vector< vector< vec3d > > & pnts,  std::vector< vector< vec3d > > & norms,  std::vector< vector< vec3d > > & uw_pnts ) const;
     void SplitTesselate( const vector<double> &usplit, const vector<double> &vsplit, const vector<double> &u, const vector<double> &v, std::vector< vector< vector< vec3d > > > & pnts,  std::vector< vector< vector< vec3d > > > & norms ) const;
 
+    void EvalTesselate( const vector<double> &utess, const vector<double> &vtess, std::vector< vector< vec3d > > & pnts,  std::vector< vector< vec3d > > & norms,  std::vector< vector< vec3d > > & uw_pnts ) const;
+    void EvalSplitTesselate( const vector<double> &usplit, const vector<double> &vsplit, const vector<double> &u, const vector<double> &v, std::vector< vector< vector< vec3d > > > & pnts,  std::vector< vector< vector< vec3d > > > & norms ) const;
+
     static void IGESKnots( int deg, int npatch, vector< double > &knot );
 
     bool CheckValidPatch( const piecewise_surface_type &surf );
@@ -210,5 +251,15 @@ protected:
     vector < double > m_RootCluster;
     vector < double > m_TipCluster;
 
+    //==== Tesselation Cache - Most Recent First, Cleared By BumpRevision ====//
+    // One surface must not be tesselated from several threads at once
+    long long m_Revision;
+    mutable vector< VspSurfTessCacheEntry > m_TessCache;
+    mutable vector< VspSurfTessCacheEntry > m_SplitTessCache;
+
+    static std::atomic< long long > m_NextRevision;
+    static std::atomic< long long > m_TessCacheHits;
+    static std::atomic< long long > m_TessCacheMisses;
+
 };
 #endif
@@ -7,6 +7,7 @@
 //#include "vld.h"
 
 #include <stdio.h>
+#include <string.h>
 
 #ifdef WIN32
 #include <windows.h>
@@ -24,12 +25,16 @@ void vsp_exit()
     exit( 0 );
 }
 
-bool run_tests()
+bool run_tests( bool benchmark )
 {
     // Add desired suites to parent suite
     Test::Suite ts;
     ts.add(std::auto_ptr<Test::Suite>(new APITestSuite));    //This line can be copied to add new test suites
     ts.add(std::auto_ptr<Test::Suite>(new APITestSuiteVSPAERO));
+    if ( benchmark )
+    {
+        ts.add(std::auto_ptr<Test::Suite>(new APIBenchmarkSuite));  // Large timing runs, only with -benchmark
+    }
     
     // Test Suite run parameters
     Test::TextOutput output(Test::TextOutput::Verbose);
@@ -45,7 +50,15 @@ bool run_tests()
 int main( int argc, char** argv )
 {
 //==== Use CPPTest =====//
-    run_tests();
+    bool benchmark = false;
+    for ( int i = 1 ; i < argc ; i++ )
+    {
+        if ( strcmp( argv[i], "-benchmark" ) == 0 )
+        {
+            benchmark = true;
+        }
+    }
+    run_tests( benchmark );
     printf("\n\n");
 
 //==== Use Case 1 ====//